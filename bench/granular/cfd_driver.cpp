@@ -0,0 +1,146 @@
+/* ----------------------------------------------------------------------
+   dummy CFD solver for the in.cfd benchmark
+
+   reads the input script given with -in, then does the timed run in
+   chunks of couple_every steps. after each chunk, the particle positions,
+   velocities and radii are pulled from LIGGGHTS, a Stokes drag of a
+   uniform upward gas flow is computed and pushed back as dragforce, as
+   a CFD solver coupled via fix couple/cfd would do
+
+   the timing summary of all chunks is printed in the format of the
+   LIGGGHTS log file, with the time spent in the data exchange as an
+   extra "Cfd" line, so run_bench.py can read it
+
+   build, e.g. with the library in ../../src/build:
+     mpicxx -O2 -I../../src cfd_driver.cpp -L../../src/build -lliggghts -o cfd_driver
+------------------------------------------------------------------------- */
+
+#include <mpi.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <vector>
+#include "lammps.h"
+#include "input.h"
+#include "variable.h"
+#include "atom.h"
+#include "modify.h"
+#include "fix.h"
+#include "memory.h"
+#include "timer.h"
+#include "library_cfd_coupling.h"
+
+using namespace LAMMPS_NS;
+
+static int int_variable(LAMMPS *lmp, const char *name)
+{
+  char *str = lmp->input->variable->retrieve(const_cast<char*>(name));
+  if (!str) {
+    fprintf(stderr,"cfd_driver: variable %s not defined in input script\n",name);
+    MPI_Abort(MPI_COMM_WORLD,1);
+  }
+  return atoi(str);
+}
+
+int main(int argc, char **argv)
+{
+  MPI_Init(&argc,&argv);
+
+  int me,nprocs;
+  MPI_Comm_rank(MPI_COMM_WORLD,&me);
+  MPI_Comm_size(MPI_COMM_WORLD,&nprocs);
+
+  LAMMPS *lmp = new LAMMPS(argc,argv,MPI_COMM_WORLD);
+  lmp->input->file();
+
+  const int nsteps = int_variable(lmp,"nsteps");
+  const int couple_every = int_variable(lmp,"couple_every");
+  const int nchunks = nsteps/couple_every;
+
+  // gas properties
+  const double mu = 1.8e-5;
+  const double ugas[3] = {0.0, 0.0, 0.5};
+
+  double **x = NULL, **v = NULL, **radius = NULL, **drag = NULL;
+  allocate_external_double(x,3,"nparticles",0.0,lmp);
+  allocate_external_double(v,3,"nparticles",0.0,lmp);
+  allocate_external_double(radius,1,"nparticles",0.0,lmp);
+  allocate_external_double(drag,3,"nparticles",0.0,lmp);
+  const int ntags = liggghts_get_maxtag(lmp);
+
+  double time[TIME_N+1] = {0.0};
+  std::vector<double> fixtime(lmp->modify->nfix,0.0);
+  double time_cfd = 0.0;
+
+  char cmd[128];
+  for (int k = 0; k < nchunks; k++) {
+    snprintf(cmd,sizeof(cmd),"run %d pre %s post no",couple_every,k == 0 ? "yes" : "no");
+    lmp->input->one(cmd);
+
+    for (int t = 0; t < TIME_N; t++)
+      time[t] += lmp->timer->array[t];
+    for (int i = 0; i < lmp->modify->nfix; i++)
+      fixtime[i] += lmp->modify->fix[i]->get_recorded_time();
+
+    double t0 = MPI_Wtime();
+
+    data_liggghts_to_of("x","vector-atom",lmp,(void*&)x,"double");
+    data_liggghts_to_of("v","vector-atom",lmp,(void*&)v,"double");
+    data_liggghts_to_of("radius","scalar-atom",lmp,(void*&)radius,"double");
+
+    for (int t = 0; t < ntags; t++) {
+      const double coeff = 6.0*M_PI*mu*radius[t][0];
+      for (int dim = 0; dim < 3; dim++)
+        drag[t][dim] = radius[t][0] > 0.0 ? coeff*(ugas[dim]-v[t][dim]) : 0.0;
+    }
+
+    data_of_to_liggghts("dragforce","vector-atom",lmp,drag,"double");
+
+    time_cfd += MPI_Wtime() - t0;
+  }
+
+  // summary, averaged over procs as in Finish
+
+  double modify = 0.0;
+  for (size_t i = 0; i < fixtime.size(); i++)
+    modify += fixtime[i];
+  time[TIME_MODIFY] = modify;
+  time[TIME_N] = time_cfd;
+
+  double time_all[TIME_N+1];
+  MPI_Allreduce(time,time_all,TIME_N+1,MPI_DOUBLE,MPI_SUM,MPI_COMM_WORLD);
+  std::vector<double> fixtime_all(fixtime.size());
+  MPI_Allreduce(&fixtime[0],&fixtime_all[0],fixtime.size(),MPI_DOUBLE,MPI_SUM,MPI_COMM_WORLD);
+
+  if (me == 0) {
+    for (int t = 0; t <= TIME_N; t++)
+      time_all[t] /= nprocs;
+    const double loop = time_all[TIME_LOOP] + time_all[TIME_N];
+    const double other = loop - (time_all[TIME_PAIR] + time_all[TIME_NEIGHBOR] + time_all[TIME_COMM] +
+                                 time_all[TIME_OUTPUT] + time_all[TIME_MODIFY] + time_all[TIME_N]);
+
+    printf("Loop time of %g on %d procs for %d steps with %.0f atoms\n\n",
+           loop,nprocs,nchunks*couple_every,(double)lmp->atom->natoms);
+    printf("Pair  time (%%) = %g (%g)\n",time_all[TIME_PAIR],100.0*time_all[TIME_PAIR]/loop);
+    printf("Neigh time (%%) = %g (%g)\n",time_all[TIME_NEIGHBOR],100.0*time_all[TIME_NEIGHBOR]/loop);
+    printf("Comm  time (%%) = %g (%g)\n",time_all[TIME_COMM],100.0*time_all[TIME_COMM]/loop);
+    printf("Outpt time (%%) = %g (%g)\n",time_all[TIME_OUTPUT],100.0*time_all[TIME_OUTPUT]/loop);
+    printf("Modfy time (%%) = %g (%g)\n",time_all[TIME_MODIFY],100.0*time_all[TIME_MODIFY]/loop);
+    for (int i = 0; i < lmp->modify->nfix; i++) {
+      const double t = fixtime_all[i]/nprocs;
+      if (t > 0.0)
+        printf("  Fix %s (%s) time (%%) = %g (%g)\n",lmp->modify->fix[i]->id,lmp->modify->fix[i]->style,
+               t,100.0*t/loop);
+    }
+    printf("Cfd   time (%%) = %g (%g)\n",time_all[TIME_N],100.0*time_all[TIME_N]/loop);
+    printf("Other time (%%) = %g (%g)\n",other,100.0*other/loop);
+  }
+
+  lmp->memory->destroy(x);
+  lmp->memory->destroy(v);
+  lmp->memory->destroy(radius);
+  lmp->memory->destroy(drag);
+
+  delete lmp;
+  MPI_Finalize();
+}
@@ -0,0 +1,42 @@
+#!/usr/bin/env python
+# writes trough.stl, a V-shaped trough of length 0.1 along x made of
+# many small triangles, used by ../in.trough
+#
+# usage: python make_trough.py [nx] [ns]
+#   nx = # of segments along x, ns = # of segments along each plate
+
+import sys
+
+nx = int(sys.argv[1]) if len(sys.argv) > 1 else 40
+ns = int(sys.argv[2]) if len(sys.argv) > 2 else 16
+length = 0.1
+
+# cross section in the y-z plane: left plate, bottom, right plate
+profile = [(0.0, 0.1), (0.04, 0.0), (0.06, 0.0), (0.1, 0.1)]
+
+def facet(out, a, b, c):
+    u = [b[k]-a[k] for k in range(3)]
+    v = [c[k]-a[k] for k in range(3)]
+    n = [u[1]*v[2]-u[2]*v[1], u[2]*v[0]-u[0]*v[2], u[0]*v[1]-u[1]*v[0]]
+    l = sum(x*x for x in n) ** 0.5
+    n = [x/l for x in n]
+    out.write("  facet normal %g %g %g\n    outer loop\n" % tuple(n))
+    for p in (a, b, c):
+        out.write("      vertex %.10g %.10g %.10g\n" % tuple(p))
+    out.write("    endloop\n  endfacet\n")
+
+with open("trough.stl", "w") as out:
+    out.write("solid trough\n")
+    for s in range(len(profile)-1):
+        (y0, z0), (y1, z1) = profile[s], profile[s+1]
+        for j in range(ns):
+            ya = y0 + (y1-y0)*j/ns
+            za = z0 + (z1-z0)*j/ns
+            yb = y0 + (y1-y0)*(j+1)/ns
+            zb = z0 + (z1-z0)*(j+1)/ns
+            for i in range(nx):
+                xa = length*i/nx
+                xb = length*(i+1)/nx
+                facet(out, (xa, ya, za), (xb, ya, za), (xb, yb, zb))
+                facet(out, (xa, ya, za), (xb, yb, zb), (xa, yb, zb))
+    out.write("endsolid trough\n")
@@ -0,0 +1,310 @@
+#!/usr/bin/env python
+"""
+run the granular benchmarks and collect per-phase timings
+
+usage:
+  run_bench.py run [options]
+      runs the benchmarks and writes the results as JSON
+  run_bench.py compare old.json new.json [--tolerance 5]
+      compares the throughput of two result files, e.g. of two commits
+
+options of run:
+  --lmp PATH          LIGGGHTS executable (default: liggghts in PATH)
+  --cfd-driver PATH   cfd_driver executable, in.cfd is skipped without it
+  --mpirun CMD        MPI launcher, {np} is replaced by the # of procs
+                      (default: "mpirun -np {np}")
+  --np LIST           comma separated # of procs (default: 1)
+  --mode MODE         strong: same problem on all # of procs
+                      weak: problem grows with the # of procs (default: strong)
+  --scale N           problem size factor on 1 proc (default: 1)
+  --nsteps N          # of timed steps (default: 1000)
+  --cases LIST        comma separated benchmarks (default: all)
+  --repeat N          run each benchmark N times, keep the fastest (default: 1)
+  --out FILE          result file (default: bench.json)
+
+each benchmark is an in.* script in this directory. the timed part is the
+last run of the script, whose timing breakdown is read from the log file:
+pair, neigh, comm, output, modify and other as printed by LIGGGHTS, plus
+wall = time of all fix wall/gran and fix neighlist/mesh instances,
+cfd = time of the data exchange (in.cfd only). throughput is given in
+particle-steps per second
+
+results contain the git commit and host, so runs of different commits
+can be compared with the compare command
+"""
+
+from __future__ import print_function
+import json
+import os
+import platform
+import re
+import shlex
+import subprocess
+import sys
+import time
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+CASES = ["box", "trough", "multisphere", "superquadric", "cfd"]
+
+# fix styles whose time counts as wall time
+WALL_STYLES = ("wall/gran", "neighlist/mesh")
+
+PHASES = {
+    "Pair": "pair",
+    "Neigh": "neigh",
+    "Comm": "comm",
+    "Outpt": "output",
+    "Modfy": "modify",
+    "Cfd": "cfd",
+    "Other": "other",
+}
+
+RE_LOOP = re.compile(r"^Loop time of (\S+) on (\d+) procs.* for (\d+) steps with (\d+) atoms")
+RE_PHASE = re.compile(r"^(\w+)\s+time \(%\) = (\S+) \((\S+)\)")
+RE_FIX = re.compile(r"^\s+Fix (\S+) \((\S+)\) time \(%\) = (\S+) \((\S+)\)")
+RE_PAIRS = re.compile(r"^Candidate pairs checked = (\d+), accepted = (\d+)")
+
+
+def parse_log(text):
+    """timing breakdown of the last run in a log"""
+
+    lines = text.splitlines()
+    start = None
+    for i, line in enumerate(lines):
+        if RE_LOOP.match(line):
+            start = i
+    if start is None:
+        return None
+
+    m = RE_LOOP.match(lines[start])
+    result = {
+        "loop": float(m.group(1)),
+        "procs": int(m.group(2)),
+        "steps": int(m.group(3)),
+        "atoms": int(m.group(4)),
+        "phases": {},
+        "fixes": {},
+    }
+
+    wall = 0.0
+    for line in lines[start+1:]:
+        m = RE_FIX.match(line)
+        if m:
+            fixid, style, t = m.group(1), m.group(2), float(m.group(3))
+            result["fixes"][fixid] = {"style": style, "time": t}
+            if style.startswith(WALL_STYLES):
+                wall += t
+            continue
+        m = RE_PHASE.match(line)
+        if m and m.group(1) in PHASES:
+            result["phases"][PHASES[m.group(1)]] = float(m.group(2))
+            continue
+        m = RE_PAIRS.match(line)
+        if m:
+            result["pairs_checked"] = int(m.group(1))
+            result["pairs_accepted"] = int(m.group(2))
+        if RE_LOOP.match(line):
+            break
+
+    result["phases"]["wall"] = wall
+    if result["loop"] > 0.0:
+        result["throughput"] = result["atoms"] * result["steps"] / result["loop"]
+    else:
+        result["throughput"] = 0.0
+    return result
+
+
+def find_error(text):
+    for line in text.splitlines():
+        if line.startswith("ERROR"):
+            return line.strip()
+    return None
+
+
+def git_commit():
+    try:
+        out = subprocess.check_output(["git", "rev-parse", "HEAD"], cwd=HERE)
+        commit = out.decode().strip()
+        dirty = subprocess.call(["git", "diff", "--quiet", "HEAD"], cwd=HERE) != 0
+        return commit + ("-dirty" if dirty else "")
+    except (OSError, subprocess.CalledProcessError):
+        return "unknown"
+
+
+def prepare(case):
+    """generate input files that are not kept in the repository"""
+
+    if case == "trough" and not os.path.exists(os.path.join(HERE, "meshes", "trough.stl")):
+        subprocess.check_call([sys.executable, "make_trough.py"], cwd=os.path.join(HERE, "meshes"))
+
+
+def run_case(opts, case, np, scale):
+    prepare(case)
+
+    log = "log.%s.%s.%d" % (case, opts["mode"], np)
+    launcher = shlex.split(opts["mpirun"].replace("{np}", str(np)))
+    if case == "cfd":
+        exe = [opts["cfd_driver"]]
+    else:
+        exe = [opts["lmp"]]
+    args = ["-in", "in." + case, "-var", "scale", str(scale), "-var", "nsteps", str(opts["nsteps"]),
+            "-echo", "none", "-screen", "none", "-log", log]
+
+    start = time.time()
+    proc = subprocess.Popen(launcher + exe + args, cwd=HERE, stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+    out = proc.communicate()[0].decode("utf-8", "replace")
+    elapsed = time.time() - start
+
+    logtext = ""
+    if os.path.exists(os.path.join(HERE, log)):
+        with open(os.path.join(HERE, log)) as f:
+            logtext = f.read()
+
+    # the cfd driver prints its summary to stdout
+    text = out if case == "cfd" else logtext
+
+    entry = {"case": case, "np": np, "scale": scale, "mode": opts["mode"], "log": log, "elapsed": elapsed}
+    error = find_error(logtext) or find_error(out)
+    result = parse_log(text) if proc.returncode == 0 and not error else None
+    if result is None:
+        entry["status"] = "failed"
+        entry["error"] = error or ("exit code %d" % proc.returncode)
+    else:
+        entry["status"] = "ok"
+        entry.update(result)
+    return entry
+
+
+def cmd_run(argv):
+    opts = {
+        "lmp": "liggghts",
+        "cfd_driver": None,
+        "mpirun": "mpirun -np {np}",
+        "np": "1",
+        "mode": "strong",
+        "scale": "1",
+        "nsteps": "1000",
+        "cases": ",".join(CASES),
+        "repeat": "1",
+        "out": "bench.json",
+    }
+    i = 0
+    while i < len(argv):
+        key = argv[i]
+        if not key.startswith("--") or key[2:].replace("-", "_") not in opts or i+1 >= len(argv):
+            sys.exit("unknown or incomplete option %s, see %s --help" % (key, sys.argv[0]))
+        opts[key[2:].replace("-", "_")] = argv[i+1]
+        i += 2
+
+    if opts["mode"] not in ("strong", "weak"):
+        sys.exit("--mode must be strong or weak")
+    if opts["lmp"] and os.sep in opts["lmp"]:
+        opts["lmp"] = os.path.abspath(opts["lmp"])
+    if opts["cfd_driver"]:
+        opts["cfd_driver"] = os.path.abspath(opts["cfd_driver"])
+
+    nps = [int(n) for n in opts["np"].split(",")]
+    cases = opts["cases"].split(",")
+    for case in cases:
+        if case not in CASES:
+            sys.exit("unknown benchmark %s, available: %s" % (case, ", ".join(CASES)))
+
+    results = {
+        "commit": git_commit(),
+        "host": platform.node(),
+        "date": time.strftime("%Y-%m-%d %H:%M:%S"),
+        "mpirun": opts["mpirun"],
+        "nsteps": int(opts["nsteps"]),
+        "runs": [],
+    }
+
+    for case in cases:
+        if case == "cfd" and not opts["cfd_driver"]:
+            results["runs"].append({"case": case, "status": "skipped", "error": "no --cfd-driver given"})
+            continue
+        for np in nps:
+            scale = int(opts["scale"]) * (np if opts["mode"] == "weak" else 1)
+            best = None
+            for _ in range(int(opts["repeat"])):
+                entry = run_case(opts, case, np, scale)
+                if entry["status"] != "ok":
+                    best = entry
+                    break
+                if best is None or entry["loop"] < best["loop"]:
+                    best = entry
+            results["runs"].append(best)
+            print_entry(best)
+
+    with open(opts["out"], "w") as f:
+        json.dump(results, f, indent=2, sort_keys=True)
+    print("results written to %s" % opts["out"])
+
+
+def print_entry(e):
+    if e["status"] != "ok":
+        print("%-12s np %3d  %s: %s" % (e["case"], e.get("np", 0), e["status"], e.get("error", "")))
+        return
+    p = e["phases"]
+    print("%-12s np %3d  %9d atoms  %10.4g particle-steps/s  loop %8.3f  pair %8.3f  wall %8.3f  "
+          "neigh %8.3f  comm %8.3f  modify %8.3f" %
+          (e["case"], e["np"], e["atoms"], e["throughput"], e["loop"], p.get("pair", 0.0), p.get("wall", 0.0),
+           p.get("neigh", 0.0), p.get("comm", 0.0), p.get("modify", 0.0)))
+
+
+def cmd_compare(argv):
+    tolerance = 5.0
+    files = []
+    i = 0
+    while i < len(argv):
+        if argv[i] == "--tolerance" and i+1 < len(argv):
+            tolerance = float(argv[i+1])
+            i += 2
+        else:
+            files.append(argv[i])
+            i += 1
+    if len(files) != 2:
+        sys.exit("compare needs two result files")
+
+    with open(files[0]) as f:
+        old = json.load(f)
+    with open(files[1]) as f:
+        new = json.load(f)
+
+    print("old: %s (%s)" % (old["commit"], old["date"]))
+    print("new: %s (%s)" % (new["commit"], new["date"]))
+
+    def key(e):
+        return (e["case"], e.get("mode"), e.get("np"), e.get("scale"))
+
+    oldruns = dict((key(e), e) for e in old["runs"] if e["status"] == "ok")
+    nregress = 0
+    for e in new["runs"]:
+        if e["status"] != "ok" or key(e) not in oldruns:
+            continue
+        o = oldruns[key(e)]
+        change = 100.0 * (e["throughput"] / o["throughput"] - 1.0) if o["throughput"] > 0.0 else 0.0
+        flag = ""
+        if change < -tolerance:
+            flag = "  REGRESSION"
+            nregress += 1
+        print("%-12s %-6s np %3d  %10.4g -> %10.4g particle-steps/s  %+6.1f%%%s" %
+              (e["case"], e["mode"], e["np"], o["throughput"], e["throughput"], change, flag))
+
+    return 1 if nregress else 0
+
+
+def main():
+    if len(sys.argv) < 2 or sys.argv[1] in ("-h", "--help"):
+        print(__doc__)
+        return 0
+    if sys.argv[1] == "run":
+        cmd_run(sys.argv[2:])
+        return 0
+    if sys.argv[1] == "compare":
+        return cmd_compare(sys.argv[2:])
+    sys.exit("unknown command %s, see %s --help" % (sys.argv[1], sys.argv[0]))
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -15,6 +15,7 @@
 #define MPI_STUBS
 
 #include <stdlib.h>
+#include <stdio.h>
 
 /* use C bindings for MPI interface */
 
@@ -59,6 +60,15 @@ extern "C" {
 
 #define MPI_MAX_PROCESSOR_NAME 128
 
+#define MPI_File FILE*
+#define MPI_Offset long long
+#define MPI_Info int
+#define MPI_INFO_NULL 0
+
+#define MPI_MODE_RDONLY 1
+#define MPI_MODE_WRONLY 2
+#define MPI_MODE_CREATE 4
+
 /* MPI data structs */
 
 struct _MPI_Status {
@@ -94,6 +104,7 @@ int MPI_Wait(MPI_Request *request, MPI_Status *status);
 int MPI_Waitall(int n, MPI_Request *request, MPI_Status *status);
 int MPI_Waitany(int count, MPI_Request *request, int *index,
                 MPI_Status *status);
+int MPI_Testall(int n, MPI_Request *request, int *flag, MPI_Status *status);
 int MPI_Sendrecv(void *sbuf, int scount, MPI_Datatype sdatatype,
                   int dest, int stag, void *rbuf, int rcount,
                   MPI_Datatype rdatatype, int source, int rtag,
@@ -139,6 +150,16 @@ int MPI_Scatterv(void *sendbuf, int *sendcounts, int *displs,
                  MPI_Datatype sendtype, void *recvbuf, int recvcount,
                  MPI_Datatype recvtype, int root, MPI_Comm comm);
 
+int MPI_File_open(MPI_Comm comm, char *filename, int amode, MPI_Info info,
+                  MPI_File *fh);
+int MPI_File_close(MPI_File *fh);
+int MPI_File_write_at_all(MPI_File fh, MPI_Offset offset, void *buf,
+                          int count, MPI_Datatype datatype,
+                          MPI_Status *status);
+int MPI_File_read_at_all(MPI_File fh, MPI_Offset offset, void *buf,
+                         int count, MPI_Datatype datatype,
+                         MPI_Status *status);
+
 #ifdef __cplusplus
 }
 #endif
@@ -48,6 +48,8 @@ using namespace FixConst;
 FixNeighlistMeshOMP::FixNeighlistMeshOMP(LAMMPS *lmp, int narg, char **arg)
 : FixNeighlistMesh(lmp,narg,arg)
 {
+    if(incremental_)
+        error->fix_error(FLERR,this,"incremental build not available with OMP");
 }
 
 /* ---------------------------------------------------------------------- */
@@ -66,6 +68,8 @@ void FixNeighlistMeshOMP::initializeNeighlist()
   trilist.clear();
   trilist.reserve(nall);
 
+  tri_contacts.resize(nall);
+
   for(int iTri = 0; iTri < nall; iTri++) {
     trilist.push_back(iTri);
   }
@@ -240,15 +244,30 @@ void FixNeighlistMeshOMP::pre_force(int vflag)
 
   std::fill(thread_offsets.begin(), thread_offsets.end(), 0);
 
-  // update nneighs
+  // update nneighs and store the lists of all triangles in one array
+  vectorZeroizeN(stats_,6);
+  stats_reduced_ = false;
+  if(!(changingMesh || changingDomain))
+  {
+    stats_[4] = nbins_box_;
+    stats_[5] = nbins_used_;
+  }
+  contacts_.clear();
+  contacts_offset_.resize(nall+1);
   for(size_t iTri = 0; iTri < nall; ++iTri) {
-    std::vector<int> & neighbors = triangles[iTri].contacts;
+    std::vector<int> & neighbors = tri_contacts[iTri];
+    contacts_offset_[iTri] = contacts_.size();
     for(std::vector<int>::iterator it = neighbors.begin(); it != neighbors.end(); ++it) {
       const int i =  *it;
       ++partition_global_triangles[i];
     }
-    numAllContacts_ += neighbors.size();
+    contacts_.insert(contacts_.end(), neighbors.begin(), neighbors.end());
+    stats_[0] += triangles[iTri].nchecked;
   }
+  contacts_offset_[nall] = contacts_.size();
+  numAllContacts_ = contacts_.size();
+  stats_[1] = stats_[2] = nall;
+  stats_[3] = numAllContacts_;
 
   for(int i = 0; i < nlocal; ++i) {
     const int ntriangles = partition_global_triangles[i];
@@ -342,7 +361,7 @@ void FixNeighlistMeshOMP::pre_force(int vflag)
 void FixNeighlistMeshOMP::handleTriangle(int iTri)
 {
     TriangleNeighlist & triangle = triangles[iTri];
-    std::vector<int> & neighbors = triangle.contacts;
+    std::vector<int> & neighbors = tri_contacts[iTri];
     int & nchecked = triangle.nchecked;
     int *mask = atom->mask;
     int ixMin(0),ixMax(0),iyMin(0),iyMax(0),izMin(0),izMax(0);
@@ -77,6 +77,9 @@ class FixNeighlistMeshOMP : public FixNeighlistMesh
     void sort_triangles_by_nchecked();
 
     std::vector<int> trilist;
+
+    // per-triangle lists filled by the threads, copied to contacts_ afterwards
+    std::vector< std::vector<int> > tri_contacts;
     int sortfreq;
     bigint nextsort;
 };
@@ -278,8 +278,8 @@ void FixWallGranOMP::post_force_mesh(int vflag)
         // loop owned and ghost triangles
         for(int iTri = 0; iTri < nTriAll; iTri++)
         {
-          const std::vector<int> & neighborList = meshNeighlist->get_contact_list(iTri);
-          const int numneigh = neighborList.size();
+          const int * neighborList;
+          const int numneigh = meshNeighlist->get_contact_list(iTri,neighborList);
           for(int iCont = 0; iCont < numneigh; iCont++)
           {
             const int iPart = neighborList[iCont];
@@ -320,8 +320,8 @@ void FixWallGranOMP::post_force_mesh(int vflag)
         // loop owned and ghost particles
         for(int iTri = 0; iTri < nTriAll; iTri++)
         {
-          const std::vector<int> & neighborList = meshNeighlist->get_contact_list(iTri);
-          const int numneigh = neighborList.size();
+          const int * neighborList;
+          const int numneigh = meshNeighlist->get_contact_list(iTri,neighborList);
           for(int iCont = 0; iCont < numneigh; iCont++)
           {
             const int iPart = neighborList[iCont];
@@ -76,9 +76,6 @@ void Neighbor::granular_nsq_no_newton_omp(NeighList *list)
   const int ito = nlocal;
 #endif
 
-  int *  npartner = NULL;
-  int **  partner = NULL;
-
   double ** contacthistory = NULL;
   int **        firsttouch = NULL;
   double **     firstshear = NULL;
@@ -104,8 +101,6 @@ void Neighbor::granular_nsq_no_newton_omp(NeighList *list)
   ipage.reset();
 
   if (fix_history) {
-    npartner = fix_history->npartner_;
-    partner = fix_history->partner_;
     contacthistory = fix_history->contacthistory_;
     listgranhistory = list->listgranhistory;
     firsttouch = listgranhistory->firstneigh;
@@ -156,12 +151,8 @@ void Neighbor::granular_nsq_no_newton_omp(NeighList *list)
         if (fix_history) {
           if (rsq < radsum*radsum)
           {
-            int m = 0;
-
-            for (m = 0; m < npartner[i]; m++)
-              if (partner[i][m] == tag[j]) break;
-
-            if (m < npartner[i]) {
+            const int m = fix_history->find_partner(i,tag[j]);
+            if (m >= 0) {
               touchptr[n] = 1;
               for (int d = 0; d < dnum; d++) {
                 shearptr[nn++] = contacthistory[i][m*dnum+d];
@@ -344,9 +335,6 @@ void Neighbor::granular_bin_no_newton_omp(NeighList *list)
   MyPage<int> *    ipage_touch = NULL;
   MyPage<double> * dpage_shear = NULL;
 
-  int *  npartner = NULL;
-  int ** partner  = NULL;
-
   double ** contacthistory = NULL;
   int **     firsttouch    = NULL;
   double **     firstshear = NULL;
@@ -372,8 +360,6 @@ void Neighbor::granular_bin_no_newton_omp(NeighList *list)
   ipage.reset();
 
   if (fix_history) {
-    npartner = fix_history->npartner_;
-    partner = fix_history->partner_;
     contacthistory = fix_history->contacthistory_;
     firsttouch = listgranhistory->firstneigh;
     firstshear = listgranhistory->firstdouble;
@@ -427,10 +413,8 @@ void Neighbor::granular_bin_no_newton_omp(NeighList *list)
           if (fix_history) {
             if (rsq < radsum*radsum)
             {
-              int m = 0;
-              for (m = 0; m < npartner[i]; m++)
-                if (partner[i][m] == tag[j]) break;
-              if (m < npartner[i]) {
+              const int m = fix_history->find_partner(i,tag[j]);
+              if (m >= 0) {
                 touchptr[n] = 1;
                 for (int d = 0; d < dnum; d++) {
                   shearptr[nn++] = contacthistory[i][m*dnum+d];
@@ -141,6 +141,12 @@ public:
     return cmodel.stressStrainExponent();
   }
 
+  // the threaded pass does not run the surface check, nothing to report
+  int nstatistics()
+  {
+    return 0;
+  }
+
   void apply_patchup(Pair * pair, ThrData* thr) {
     std::vector<ForceUpdate> & forceUpdates = thr->patchupForceUpdates;
     std::vector<VatomUpdate> & vatomUpdates = thr->patchupVatomUpdates;
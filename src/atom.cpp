@@ -46,6 +46,7 @@
 #include "atom_masks.h"
 #include "memory.h"
 #include "error.h"
+#include "space_filling_curve.h"
 #include <vector>
 #include <set>
 #include <map>
@@ -63,6 +64,8 @@ using namespace std;
 #define CUDA_CHUNK 3000
 #define MAXBODY 20       // max # of lines in one body, also in ReadData class
 
+enum{SORT_ROW,SORT_HILBERT};
+
 /* ---------------------------------------------------------------------- */
 
 Atom::Atom(LAMMPS *lmp) : Pointers(lmp)
@@ -78,9 +81,11 @@ Atom::Atom(LAMMPS *lmp) : Pointers(lmp)
   firstgroupname = NULL;
   sortfreq = 1000;
   nextsort = 0;
+  sortorder = SORT_ROW;
+  sortcheck = 0.0;
   userbinsize = 0.0;
   maxbin = maxnext = 0;
-  binhead = NULL;
+  binhead = binorder = NULL;
   next = permute = NULL;
 
   // initialize atom arrays
@@ -217,6 +222,7 @@ Atom::~Atom()
 
   delete [] firstgroupname;
   memory->destroy(binhead);
+  memory->destroy(binorder);
   memory->destroy(next);
   memory->destroy(permute);
 
@@ -595,6 +601,18 @@ void Atom::modify_params(int narg, char **arg)
         error->all(FLERR,"Atom_modify sort and first options "
                    "cannot be used together");
       iarg += 3;
+    } else if (strcmp(arg[iarg],"sortorder") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal atom_modify command");
+      if (strcmp(arg[iarg+1],"row") == 0) sortorder = SORT_ROW;
+      else if (strcmp(arg[iarg+1],"hilbert") == 0) sortorder = SORT_HILBERT;
+      else error->all(FLERR,"Illegal atom_modify command");
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"sortcheck") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal atom_modify command");
+      sortcheck = force->numeric(FLERR,arg[iarg+1]);
+      if (sortcheck < 0.0 || sortcheck > 1.0)
+        error->all(FLERR,"Illegal atom_modify command");
+      iarg += 2;
     } else error->all(FLERR,"Illegal atom_modify command");
   }
 }
@@ -1402,6 +1420,11 @@ void Atom::spatial_sort(){
   if (domain->box_change) setup_sort_bins();
   if (nbins == 1) return;
 
+  // skip sort while atoms in the list are still close in space
+  // new or migrated atoms of threaded styles always need a sort
+
+  if (sortcheck > 0.0 && !dirty && sort_scatter() < sortcheck) return;
+
   // reallocate per-atom vectors if needed
 
   if (nlocal > maxnext) {
@@ -1440,7 +1463,7 @@ void Atom::spatial_sort(){
 
   n = 0;
   for (m = 0; m < nbins; m++) {
-    i = binhead[m];
+    i = binhead[binorder[m]];
     while (i >= 0) {
       permute[n++] = i;
       i = next[i];
@@ -1540,7 +1563,7 @@ void Atom::fill_permute_by_spatial_sorted_bins(std::vector<int> & ilist, int * t
 
   int n = 0;
   for (int m = 0; m < nbins; m++) {
-    int i = binhead[m];
+    int i = binhead[binorder[m]];
     while (i >= 0) {
       target_permute[n++] = i;
       i = next[i];
@@ -1749,11 +1772,69 @@ void Atom::setup_sort_bins()
 
   if (nbins > maxbin) {
     memory->destroy(binhead);
+    memory->destroy(binorder);
     maxbin = nbins;
     memory->create(binhead,maxbin,"atom:binhead");
+    memory->create(binorder,maxbin,"atom:binorder");
+  }
+
+  // order in which bins are visited when sorting
+  // row-major, or along a Hilbert curve so consecutive bins are neighbors
+  // bins beyond 2^MAXBITS per dim are grouped, row-major inside a group
+
+  for (int m = 0; m < nbins; m++) binorder[m] = m;
+
+  if (sortorder == SORT_HILBERT) {
+    int bits = SpaceFillingCurve::bits_for(MAX(nbinx,MAX(nbiny,nbinz)));
+    const int shift = MAX(bits-SpaceFillingCurve::MAXBITS,0);
+    bits -= shift;
+
+    std::vector<uint64_t> keys(nbins);
+    for (int m = 0; m < nbins; m++) {
+      const uint32_t ix = (m % nbinx) >> shift;
+      const uint32_t iy = ((m / nbinx) % nbiny) >> shift;
+      const uint32_t iz = (m / (nbinx*nbiny)) >> shift;
+      const uint32_t key = SpaceFillingCurve::hilbert_key(ix,iy,iz,bits);
+      keys[m] = (static_cast<uint64_t>(key) << 32) | static_cast<uint32_t>(m);
+    }
+    std::sort(keys.begin(),keys.end());
+    for (int m = 0; m < nbins; m++)
+      binorder[m] = static_cast<int>(keys[m] & 0xffffffff);
   }
 }
 
+/* ----------------------------------------------------------------------
+   fraction of owned atoms whose successor in the atom list is more than
+     2 sort bins away in some dim, i.e. beyond the neighbor cutoff for
+     the default bin size
+   small right after a sort, grows as atoms of a flowing system mix
+------------------------------------------------------------------------- */
+
+double Atom::sort_scatter()
+{
+  if (nlocal < 2) return 0.0;
+
+  int ix,iy,iz;
+  int jx = 0,jy = 0,jz = 0;
+  int nscatter = 0;
+
+  for (int i = 0; i < nlocal; i++) {
+    ix = static_cast<int> ((x[i][0]-bboxlo[0])*bininvx);
+    iy = static_cast<int> ((x[i][1]-bboxlo[1])*bininvy);
+    iz = static_cast<int> ((x[i][2]-bboxlo[2])*bininvz);
+    ix = MIN(MAX(ix,0),nbinx-1);
+    iy = MIN(MAX(iy,0),nbiny-1);
+    iz = MIN(MAX(iz,0),nbinz-1);
+    if (i > 0 && (abs(ix-jx) > 2 || abs(iy-jy) > 2 || abs(iz-jz) > 2))
+      nscatter++;
+    jx = ix;
+    jy = iy;
+    jz = iz;
+  }
+
+  return static_cast<double>(nscatter)/(nlocal-1);
+}
+
 /* ----------------------------------------------------------------------
    register a callback to a fix so it can manage atom-based arrays
    happens when fix is created
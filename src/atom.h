@@ -154,6 +154,8 @@ class Atom : protected Pointers {
 
   int sortfreq;             // sort atoms every this many steps, 0 = off
   bigint nextsort;          // next timestep to sort on
+  int sortorder;            // visit sort bins row by row or along a curve
+  double sortcheck;         // only sort if sort_scatter() exceeds this
 
   // indices of atoms with same ID
 
@@ -201,6 +203,7 @@ class Atom : protected Pointers {
 
   void first_reorder();
   void sort();
+  double sort_scatter();
 
   void add_callback(int);
   void delete_callback(const char *, int);
@@ -268,6 +271,7 @@ class Atom : protected Pointers {
   int maxbin;                     // max # of bins
   int maxnext;                    // max size of next,permute
   int *binhead;                   // 1st atom in each bin
+  int *binorder;                  // bins in the order atoms are sorted
   int *next;                      // next atom in bin
   int *permute;                   // permutation vector
   double userbinsize;             // requested sort bin size
@@ -27,6 +27,7 @@ AtomVec::AtomVec(LAMMPS *lmp) : Pointers(lmp)
   nmax = 0;
   bonds_allow = angles_allow = dihedrals_allow = impropers_allow = 0;
   mass_type = dipole_type = 0;
+  threadsafe_exchange = 0;
   size_data_bonus = 0;
   cudable = false;
 }
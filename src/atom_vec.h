@@ -29,6 +29,9 @@ class AtomVec : protected Pointers {
 
   int comm_x_only;                     // 1 if only exchange x in forward comm
   int comm_f_only;                     // 1 if only exchange f in reverse comm
+  int threadsafe_exchange;             // 1 if pack_exchange() only reads
+                                       // per-atom data, so Comm may call it
+                                       // from several threads at once
 
   int size_forward;                    // # of values per atom in comm
   int size_reverse;                    // # in reverse comm
@@ -33,6 +33,7 @@ See the README file in the top-level LAMMPS directory.
 using namespace LAMMPS_NS;
 
 #define DELTA 10000
+#define OMP_MIN_ATOMS 1000   // shorter pack/unpack loops are not threaded
 #define BOND_GRAN_USE_MOLECULE_ID
 
 /* ---------------------------------------------------------------------- */
@@ -45,6 +46,7 @@ AtomVecBondGran::AtomVecBondGran(LAMMPS *lmp) :
   mass_type = 1;
 
   comm_x_only = comm_f_only = 1;
+  threadsafe_exchange = 1;
   size_forward = 3;
   size_reverse = 3;
 
@@ -230,8 +232,12 @@ int AtomVecBondGran::pack_comm(int n, int *list, double *buf,
 
   m = 0;
   if (pbc_flag == 0) {
+    #if defined(_OPENMP)
+    #pragma omp parallel for num_threads(comm->nthreads) private(j,m) if(n > OMP_MIN_ATOMS)
+    #endif
     for (i = 0; i < n; i++) {
       j = list[i];
+      m = 9*i;
       buf[m++] = x[j][0];
       buf[m++] = x[j][1];
       buf[m++] = x[j][2];
@@ -242,6 +248,7 @@ int AtomVecBondGran::pack_comm(int n, int *list, double *buf,
       buf[m++] = v_mol[j][1];
       buf[m++] = v_mol[j][2];
     }
+    m = 9*n;
   } else {
     if (domain->triclinic == 0) {
       dx = pbc[0]*domain->xprd;
@@ -252,8 +259,12 @@ int AtomVecBondGran::pack_comm(int n, int *list, double *buf,
       dy = pbc[1]*domain->yprd + pbc[3]*domain->yz;
       dz = pbc[2]*domain->zprd;
     }
+    #if defined(_OPENMP)
+    #pragma omp parallel for num_threads(comm->nthreads) private(j,m) if(n > OMP_MIN_ATOMS)
+    #endif
     for (i = 0; i < n; i++) {
       j = list[i];
+      m = 9*i;
       buf[m++] = x[j][0] + dx;
       buf[m++] = x[j][1] + dy;
       buf[m++] = x[j][2] + dz;
@@ -264,6 +275,7 @@ int AtomVecBondGran::pack_comm(int n, int *list, double *buf,
       buf[m++] = v_mol[j][1];
       buf[m++] = v_mol[j][2];
     }
+    m = 9*n;
   }
   return m;
 }
@@ -278,8 +290,12 @@ int AtomVecBondGran::pack_comm_vel(int n, int *list, double *buf,
 
   m = 0;
   if (pbc_flag == 0) {
+    #if defined(_OPENMP)
+    #pragma omp parallel for num_threads(comm->nthreads) private(j,m) if(n > OMP_MIN_ATOMS)
+    #endif
     for (i = 0; i < n; i++) {
       j = list[i];
+      m = 12*i;
       buf[m++] = x[j][0];
       buf[m++] = x[j][1];
       buf[m++] = x[j][2];
@@ -293,6 +309,7 @@ int AtomVecBondGran::pack_comm_vel(int n, int *list, double *buf,
       buf[m++] = v_mol[j][1];
       buf[m++] = v_mol[j][2];
     }
+    m = 12*n;
   } else {
     if (domain->triclinic == 0) {
       dx = pbc[0]*domain->xprd;
@@ -304,8 +321,12 @@ int AtomVecBondGran::pack_comm_vel(int n, int *list, double *buf,
       dz = pbc[2]*domain->zprd;
     }
     if (!deform_vremap) {
+      #if defined(_OPENMP)
+      #pragma omp parallel for num_threads(comm->nthreads) private(j,m) if(n > OMP_MIN_ATOMS)
+      #endif
       for (i = 0; i < n; i++) {
         j = list[i];
+        m = 12*i;
         buf[m++] = x[j][0] + dx;
         buf[m++] = x[j][1] + dy;
         buf[m++] = x[j][2] + dz;
@@ -319,12 +340,17 @@ int AtomVecBondGran::pack_comm_vel(int n, int *list, double *buf,
         buf[m++] = v_mol[j][1];
         buf[m++] = v_mol[j][2];
       }
+      m = 12*n;
     } else {
       dvx = pbc[0]*h_rate[0] + pbc[5]*h_rate[5] + pbc[4]*h_rate[4];
       dvy = pbc[1]*h_rate[1] + pbc[3]*h_rate[3];
       dvz = pbc[2]*h_rate[2];
+      #if defined(_OPENMP)
+      #pragma omp parallel for num_threads(comm->nthreads) private(j,m) if(n > OMP_MIN_ATOMS)
+      #endif
       for (i = 0; i < n; i++) {
         j = list[i];
+        m = 12*i;
         buf[m++] = x[j][0] + dx;
         buf[m++] = x[j][1] + dy;
         buf[m++] = x[j][2] + dz;
@@ -347,6 +373,7 @@ int AtomVecBondGran::pack_comm_vel(int n, int *list, double *buf,
           buf[m++] = v_mol[j][2];
         }
       }
+      m = 12*n;
     }
   }
   return m;
@@ -360,7 +387,11 @@ void AtomVecBondGran::unpack_comm(int n, int first, double *buf)
 
   m = 0;
   last = first + n;
+  #if defined(_OPENMP)
+  #pragma omp parallel for num_threads(comm->nthreads) private(m) if(n > OMP_MIN_ATOMS)
+  #endif
   for (i = first; i < last; i++) {
+    m = 9*(i-first);
     x[i][0] = buf[m++];
     x[i][1] = buf[m++];
     x[i][2] = buf[m++];
@@ -371,6 +402,7 @@ void AtomVecBondGran::unpack_comm(int n, int first, double *buf)
     v_mol[i][1] = buf[m++];
     v_mol[i][2] = buf[m++];
   }
+  m = 9*n;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -381,7 +413,11 @@ void AtomVecBondGran::unpack_comm_vel(int n, int first, double *buf)
 
   m = 0;
   last = first + n;
+  #if defined(_OPENMP)
+  #pragma omp parallel for num_threads(comm->nthreads) private(m) if(n > OMP_MIN_ATOMS)
+  #endif
   for (i = first; i < last; i++) {
+    m = 12*(i-first);
     x[i][0] = buf[m++];
     x[i][1] = buf[m++];
     x[i][2] = buf[m++];
@@ -395,6 +431,7 @@ void AtomVecBondGran::unpack_comm_vel(int n, int first, double *buf)
     v_mol[i][1] = buf[m++];
     v_mol[i][2] = buf[m++];
   }
+  m = 12*n;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -405,11 +442,16 @@ int AtomVecBondGran::pack_reverse(int n, int first, double *buf)
 
   m = 0;
   last = first + n;
+  #if defined(_OPENMP)
+  #pragma omp parallel for num_threads(comm->nthreads) private(m) if(n > OMP_MIN_ATOMS)
+  #endif
   for (i = first; i < last; i++) {
+    m = 3*(i-first);
     buf[m++] = f[i][0];
     buf[m++] = f[i][1];
     buf[m++] = f[i][2];
   }
+  m = 3*n;
   return m;
 }
 
@@ -420,12 +462,17 @@ void AtomVecBondGran::unpack_reverse(int n, int *list, double *buf)
   int i,j,m;
 
   m = 0;
+  #if defined(_OPENMP)
+  #pragma omp parallel for num_threads(comm->nthreads) private(j,m) if(n > OMP_MIN_ATOMS)
+  #endif
   for (i = 0; i < n; i++) {
     j = list[i];
+    m = 3*i;
     f[j][0] += buf[m++];
     f[j][1] += buf[m++];
     f[j][2] += buf[m++];
   }
+  m = 3*n;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -438,8 +485,12 @@ int AtomVecBondGran::pack_border(int n, int *list, double *buf,
 
   m = 0;
   if (pbc_flag == 0) {
+    #if defined(_OPENMP)
+    #pragma omp parallel for num_threads(comm->nthreads) private(j,m) if(n > OMP_MIN_ATOMS)
+    #endif
     for (i = 0; i < n; i++) {
       j = list[i];
+      m = 13*i;
       buf[m++] = x[j][0];
       buf[m++] = x[j][1];
       buf[m++] = x[j][2];
@@ -454,6 +505,7 @@ int AtomVecBondGran::pack_border(int n, int *list, double *buf,
       buf[m++] = v_mol[j][1];
       buf[m++] = v_mol[j][2];
     }
+    m = 13*n;
   } else {
     if (domain->triclinic == 0) {
       dx = pbc[0]*domain->xprd;
@@ -464,8 +516,12 @@ int AtomVecBondGran::pack_border(int n, int *list, double *buf,
       dy = pbc[1];
       dz = pbc[2];
     }
+    #if defined(_OPENMP)
+    #pragma omp parallel for num_threads(comm->nthreads) private(j,m) if(n > OMP_MIN_ATOMS)
+    #endif
     for (i = 0; i < n; i++) {
       j = list[i];
+      m = 13*i;
       buf[m++] = x[j][0] + dx;
       buf[m++] = x[j][1] + dy;
       buf[m++] = x[j][2] + dz;
@@ -480,6 +536,7 @@ int AtomVecBondGran::pack_border(int n, int *list, double *buf,
       buf[m++] = v_mol[j][1];
       buf[m++] = v_mol[j][2];
     }
+    m = 13*n;
   }
 
   if (atom->nextra_border)
@@ -499,8 +556,12 @@ int AtomVecBondGran::pack_border_vel(int n, int *list, double *buf,
 
   m = 0;
   if (pbc_flag == 0) {
+    #if defined(_OPENMP)
+    #pragma omp parallel for num_threads(comm->nthreads) private(j,m) if(n > OMP_MIN_ATOMS)
+    #endif
     for (i = 0; i < n; i++) {
       j = list[i];
+      m = 16*i;
       buf[m++] = x[j][0];
       buf[m++] = x[j][1];
       buf[m++] = x[j][2];
@@ -518,6 +579,7 @@ int AtomVecBondGran::pack_border_vel(int n, int *list, double *buf,
       buf[m++] = v_mol[j][1];
       buf[m++] = v_mol[j][2];
     }
+    m = 16*n;
   } else {
     if (domain->triclinic == 0) {
       dx = pbc[0]*domain->xprd;
@@ -529,8 +591,12 @@ int AtomVecBondGran::pack_border_vel(int n, int *list, double *buf,
       dz = pbc[2];
     }
     if (!deform_vremap) {
+      #if defined(_OPENMP)
+      #pragma omp parallel for num_threads(comm->nthreads) private(j,m) if(n > OMP_MIN_ATOMS)
+      #endif
       for (i = 0; i < n; i++) {
         j = list[i];
+        m = 16*i;
         buf[m++] = x[j][0] + dx;
         buf[m++] = x[j][1] + dy;
         buf[m++] = x[j][2] + dz;
@@ -548,12 +614,17 @@ int AtomVecBondGran::pack_border_vel(int n, int *list, double *buf,
         buf[m++] = v_mol[j][1];
         buf[m++] = v_mol[j][2];
       }
+      m = 16*n;
     } else {
       dvx = pbc[0]*h_rate[0] + pbc[5]*h_rate[5] + pbc[4]*h_rate[4];
       dvy = pbc[1]*h_rate[1] + pbc[3]*h_rate[3];
       dvz = pbc[2]*h_rate[2];
+      #if defined(_OPENMP)
+      #pragma omp parallel for num_threads(comm->nthreads) private(j,m) if(n > OMP_MIN_ATOMS)
+      #endif
       for (i = 0; i < n; i++) {
         j = list[i];
+        m = 16*i;
         buf[m++] = x[j][0] + dx;
         buf[m++] = x[j][1] + dy;
         buf[m++] = x[j][2] + dz;
@@ -580,6 +651,7 @@ int AtomVecBondGran::pack_border_vel(int n, int *list, double *buf,
           buf[m++] = v_mol[j][2];
         }
       }
+      m = 16*n;
     }
   }
 
@@ -620,8 +692,12 @@ void AtomVecBondGran::unpack_border(int n, int first, double *buf)
 
   m = 0;
   last = first + n;
+  while (last > nmax) grow(0);
+  #if defined(_OPENMP)
+  #pragma omp parallel for num_threads(comm->nthreads) private(m) if(n > OMP_MIN_ATOMS)
+  #endif
   for (i = first; i < last; i++) {
-    if (i == nmax) grow(0);
+    m = 13*(i-first);
     x[i][0] = buf[m++];
     x[i][1] = buf[m++];
     x[i][2] = buf[m++];
@@ -636,6 +712,7 @@ void AtomVecBondGran::unpack_border(int n, int first, double *buf)
     v_mol[i][1] = buf[m++];
     v_mol[i][2] = buf[m++];
   }
+  m = 13*n;
 
   if (atom->nextra_border)
     for (int iextra = 0; iextra < atom->nextra_border; iextra++)
@@ -651,8 +728,12 @@ void AtomVecBondGran::unpack_border_vel(int n, int first, double *buf)
 
   m = 0;
   last = first + n;
+  while (last > nmax) grow(0);
+  #if defined(_OPENMP)
+  #pragma omp parallel for num_threads(comm->nthreads) private(m) if(n > OMP_MIN_ATOMS)
+  #endif
   for (i = first; i < last; i++) {
-    if (i == nmax) grow(0);
+    m = 16*(i-first);
     x[i][0] = buf[m++];
     x[i][1] = buf[m++];
     x[i][2] = buf[m++];
@@ -670,6 +751,7 @@ void AtomVecBondGran::unpack_border_vel(int n, int first, double *buf)
     v_mol[i][1] = buf[m++];
     v_mol[i][2] = buf[m++];
   }
+  m = 16*n;
 
   if (atom->nextra_border)
     for (int iextra = 0; iextra < atom->nextra_border; iextra++)
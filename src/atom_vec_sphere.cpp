@@ -41,6 +41,7 @@ using namespace LAMMPS_NS;
 using namespace MathConst;
 
 #define DELTA 10000
+#define OMP_MIN_ATOMS 1000   // shorter pack/unpack loops are not threaded
 
 /* ---------------------------------------------------------------------- */
 
@@ -49,6 +50,7 @@ AtomVecSphere::AtomVecSphere(LAMMPS *lmp) : AtomVec(lmp)
   molecular = 0;
 
   comm_x_only = 1;
+  threadsafe_exchange = 1;
   comm_f_only = 0;
   size_forward = 3;
   size_reverse = 6;
@@ -175,12 +177,17 @@ int AtomVecSphere::pack_comm(int n, int *list, double *buf,
   if (radvary == 0) {
     m = 0;
     if (pbc_flag == 0) {
+      #if defined(_OPENMP)
+      #pragma omp parallel for num_threads(comm->nthreads) private(j,m) if(n > OMP_MIN_ATOMS)
+      #endif
       for (i = 0; i < n; i++) {
         j = list[i];
+        m = 3*i;
         buf[m++] = x[j][0];
         buf[m++] = x[j][1];
         buf[m++] = x[j][2];
       }
+      m = 3*n;
     } else {
       if (domain->triclinic == 0) {
         dx = pbc[0]*domain->xprd;
@@ -191,19 +198,28 @@ int AtomVecSphere::pack_comm(int n, int *list, double *buf,
         dy = pbc[1]*domain->yprd + pbc[3]*domain->yz;
         dz = pbc[2]*domain->zprd;
       }
+      #if defined(_OPENMP)
+      #pragma omp parallel for num_threads(comm->nthreads) private(j,m) if(n > OMP_MIN_ATOMS)
+      #endif
       for (i = 0; i < n; i++) {
         j = list[i];
+        m = 3*i;
         buf[m++] = x[j][0] + dx;
         buf[m++] = x[j][1] + dy;
         buf[m++] = x[j][2] + dz;
       }
+      m = 3*n;
     }
 
   } else {
     m = 0;
     if (pbc_flag == 0) {
+      #if defined(_OPENMP)
+      #pragma omp parallel for num_threads(comm->nthreads) private(j,m) if(n > OMP_MIN_ATOMS)
+      #endif
       for (i = 0; i < n; i++) {
         j = list[i];
+        m = 6*i;
         buf[m++] = x[j][0];
         buf[m++] = x[j][1];
         buf[m++] = x[j][2];
@@ -211,6 +227,7 @@ int AtomVecSphere::pack_comm(int n, int *list, double *buf,
         buf[m++] = rmass[j];
         buf[m++] = density[j]; //NP modified C.K.
       }
+      m = 6*n;
     } else {
       if (domain->triclinic == 0) {
         dx = pbc[0]*domain->xprd;
@@ -221,8 +238,12 @@ int AtomVecSphere::pack_comm(int n, int *list, double *buf,
         dy = pbc[1]*domain->yprd + pbc[3]*domain->yz;
         dz = pbc[2]*domain->zprd;
       }
+      #if defined(_OPENMP)
+      #pragma omp parallel for num_threads(comm->nthreads) private(j,m) if(n > OMP_MIN_ATOMS)
+      #endif
       for (i = 0; i < n; i++) {
         j = list[i];
+        m = 6*i;
         buf[m++] = x[j][0] + dx;
         buf[m++] = x[j][1] + dy;
         buf[m++] = x[j][2] + dz;
@@ -230,6 +251,7 @@ int AtomVecSphere::pack_comm(int n, int *list, double *buf,
         buf[m++] = rmass[j];
         buf[m++] = density[j]; //NP modified C.K.
       }
+      m = 6*n;
     }
   }
 
@@ -251,8 +273,12 @@ int AtomVecSphere::pack_comm_vel(int n, int *list, double *buf,
   if (radvary == 0) {
     m = 0;
     if (pbc_flag == 0) {
+      #if defined(_OPENMP)
+      #pragma omp parallel for num_threads(comm->nthreads) private(j,m) if(n > OMP_MIN_ATOMS)
+      #endif
       for (i = 0; i < n; i++) {
         j = list[i];
+        m = 9*i;
         buf[m++] = x[j][0];
         buf[m++] = x[j][1];
         buf[m++] = x[j][2];
@@ -263,6 +289,7 @@ int AtomVecSphere::pack_comm_vel(int n, int *list, double *buf,
         buf[m++] = omega[j][1];
         buf[m++] = omega[j][2];
       }
+      m = 9*n;
     } else {
       if (domain->triclinic == 0) {
         dx = pbc[0]*domain->xprd;
@@ -274,8 +301,12 @@ int AtomVecSphere::pack_comm_vel(int n, int *list, double *buf,
         dz = pbc[2]*domain->zprd;
       }
       if (!deform_vremap) {
+        #if defined(_OPENMP)
+        #pragma omp parallel for num_threads(comm->nthreads) private(j,m) if(n > OMP_MIN_ATOMS)
+        #endif
         for (i = 0; i < n; i++) {
           j = list[i];
+          m = 9*i;
           buf[m++] = x[j][0] + dx;
           buf[m++] = x[j][1] + dy;
           buf[m++] = x[j][2] + dz;
@@ -286,12 +317,17 @@ int AtomVecSphere::pack_comm_vel(int n, int *list, double *buf,
           buf[m++] = omega[j][1];
           buf[m++] = omega[j][2];
         }
+        m = 9*n;
       } else {
         dvx = pbc[0]*h_rate[0] + pbc[5]*h_rate[5] + pbc[4]*h_rate[4];
         dvy = pbc[1]*h_rate[1] + pbc[3]*h_rate[3];
         dvz = pbc[2]*h_rate[2];
+        #if defined(_OPENMP)
+        #pragma omp parallel for num_threads(comm->nthreads) private(j,m) if(n > OMP_MIN_ATOMS)
+        #endif
         for (i = 0; i < n; i++) {
           j = list[i];
+          m = 9*i;
           buf[m++] = x[j][0] + dx;
           buf[m++] = x[j][1] + dy;
           buf[m++] = x[j][2] + dz;
@@ -308,14 +344,19 @@ int AtomVecSphere::pack_comm_vel(int n, int *list, double *buf,
           buf[m++] = omega[j][1];
           buf[m++] = omega[j][2];
         }
+        m = 9*n;
       }
     }
 
   } else {
     m = 0;
     if (pbc_flag == 0) {
+      #if defined(_OPENMP)
+      #pragma omp parallel for num_threads(comm->nthreads) private(j,m) if(n > OMP_MIN_ATOMS)
+      #endif
       for (i = 0; i < n; i++) {
         j = list[i];
+        m = 12*i;
         buf[m++] = x[j][0];
         buf[m++] = x[j][1];
         buf[m++] = x[j][2];
@@ -329,6 +370,7 @@ int AtomVecSphere::pack_comm_vel(int n, int *list, double *buf,
         buf[m++] = omega[j][1];
         buf[m++] = omega[j][2];
       }
+      m = 12*n;
     } else {
       if (domain->triclinic == 0) {
         dx = pbc[0]*domain->xprd;
@@ -340,8 +382,12 @@ int AtomVecSphere::pack_comm_vel(int n, int *list, double *buf,
         dz = pbc[2]*domain->zprd;
       }
       if (!deform_vremap) {
+        #if defined(_OPENMP)
+        #pragma omp parallel for num_threads(comm->nthreads) private(j,m) if(n > OMP_MIN_ATOMS)
+        #endif
         for (i = 0; i < n; i++) {
           j = list[i];
+          m = 12*i;
           buf[m++] = x[j][0] + dx;
           buf[m++] = x[j][1] + dy;
           buf[m++] = x[j][2] + dz;
@@ -355,12 +401,17 @@ int AtomVecSphere::pack_comm_vel(int n, int *list, double *buf,
           buf[m++] = omega[j][1];
           buf[m++] = omega[j][2];
         }
+        m = 12*n;
       } else {
         dvx = pbc[0]*h_rate[0] + pbc[5]*h_rate[5] + pbc[4]*h_rate[4];
         dvy = pbc[1]*h_rate[1] + pbc[3]*h_rate[3];
         dvz = pbc[2]*h_rate[2];
+        #if defined(_OPENMP)
+        #pragma omp parallel for num_threads(comm->nthreads) private(j,m) if(n > OMP_MIN_ATOMS)
+        #endif
         for (i = 0; i < n; i++) {
           j = list[i];
+          m = 12*i;
           buf[m++] = x[j][0] + dx;
           buf[m++] = x[j][1] + dy;
           buf[m++] = x[j][2] + dz;
@@ -380,6 +431,7 @@ int AtomVecSphere::pack_comm_vel(int n, int *list, double *buf,
           buf[m++] = omega[j][1];
           buf[m++] = omega[j][2];
         }
+        m = 12*n;
       }
     }
   }
@@ -414,15 +466,24 @@ void AtomVecSphere::unpack_comm(int n, int first, double *buf)
   if (radvary == 0) {
     m = 0;
     last = first + n;
+    #if defined(_OPENMP)
+    #pragma omp parallel for num_threads(comm->nthreads) private(m) if(n > OMP_MIN_ATOMS)
+    #endif
     for (i = first; i < last; i++) {
+      m = 3*(i-first);
       x[i][0] = buf[m++];
       x[i][1] = buf[m++];
       x[i][2] = buf[m++];
     }
+    m = 3*n;
   } else {
     m = 0;
     last = first + n;
+    #if defined(_OPENMP)
+    #pragma omp parallel for num_threads(comm->nthreads) private(m) if(n > OMP_MIN_ATOMS)
+    #endif
     for (i = first; i < last; i++) {
+      m = 6*(i-first);
       x[i][0] = buf[m++];
       x[i][1] = buf[m++];
       x[i][2] = buf[m++];
@@ -430,6 +491,7 @@ void AtomVecSphere::unpack_comm(int n, int first, double *buf)
       rmass[i] = buf[m++];
       density[i] = buf[m++]; //NP modified C.K.
     }
+    m = 6*n;
   }
 }
 
@@ -442,7 +504,11 @@ void AtomVecSphere::unpack_comm_vel(int n, int first, double *buf)
   if (radvary == 0) {
     m = 0;
     last = first + n;
+    #if defined(_OPENMP)
+    #pragma omp parallel for num_threads(comm->nthreads) private(m) if(n > OMP_MIN_ATOMS)
+    #endif
     for (i = first; i < last; i++) {
+      m = 9*(i-first);
       x[i][0] = buf[m++];
       x[i][1] = buf[m++];
       x[i][2] = buf[m++];
@@ -454,10 +520,15 @@ void AtomVecSphere::unpack_comm_vel(int n, int first, double *buf)
       omega[i][2] = buf[m++];
       /*NL*/ //if (screen) printVec3D(screen,"FW comm: ghost x",x[i]);
     }
+    m = 9*n;
   } else {
     m = 0;
     last = first + n;
+    #if defined(_OPENMP)
+    #pragma omp parallel for num_threads(comm->nthreads) private(m) if(n > OMP_MIN_ATOMS)
+    #endif
     for (i = first; i < last; i++) {
+      m = 12*(i-first);
       x[i][0] = buf[m++];
       x[i][1] = buf[m++];
       x[i][2] = buf[m++];
@@ -471,6 +542,7 @@ void AtomVecSphere::unpack_comm_vel(int n, int first, double *buf)
       omega[i][1] = buf[m++];
       omega[i][2] = buf[m++];
     }
+    m = 12*n;
   }
 }
 
@@ -500,7 +572,11 @@ int AtomVecSphere::pack_reverse(int n, int first, double *buf)
 
   m = 0;
   last = first + n;
+  #if defined(_OPENMP)
+  #pragma omp parallel for num_threads(comm->nthreads) private(m) if(n > OMP_MIN_ATOMS)
+  #endif
   for (i = first; i < last; i++) {
+    m = 6*(i-first);
     buf[m++] = f[i][0];
     buf[m++] = f[i][1];
     buf[m++] = f[i][2];
@@ -508,6 +584,7 @@ int AtomVecSphere::pack_reverse(int n, int first, double *buf)
     buf[m++] = torque[i][1];
     buf[m++] = torque[i][2];
   }
+  m = 6*n;
   return m;
 }
 
@@ -534,8 +611,12 @@ void AtomVecSphere::unpack_reverse(int n, int *list, double *buf)
   int i,j,m;
 
   m = 0;
+  #if defined(_OPENMP)
+  #pragma omp parallel for num_threads(comm->nthreads) private(j,m) if(n > OMP_MIN_ATOMS)
+  #endif
   for (i = 0; i < n; i++) {
     j = list[i];
+    m = 6*i;
     /*NL*/ //if (screen) fprintf(screen,"Unpacking at tag %d\n",atom->tag[j]);
     /*NL*/ //if (screen) printVec3D(screen," f_add",&buf[m]);
     f[j][0] += buf[m++];
@@ -545,6 +626,7 @@ void AtomVecSphere::unpack_reverse(int n, int *list, double *buf)
     torque[j][1] += buf[m++];
     torque[j][2] += buf[m++];
   }
+  m = 6*n;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -573,8 +655,12 @@ int AtomVecSphere::pack_border(int n, int *list, double *buf,
 
   m = 0;
   if (pbc_flag == 0) {
+    #if defined(_OPENMP)
+    #pragma omp parallel for num_threads(comm->nthreads) private(j,m) if(n > OMP_MIN_ATOMS)
+    #endif
     for (i = 0; i < n; i++) {
       j = list[i];
+      m = 9*i;
       buf[m++] = x[j][0];
       buf[m++] = x[j][1];
       buf[m++] = x[j][2];
@@ -585,6 +671,7 @@ int AtomVecSphere::pack_border(int n, int *list, double *buf,
       buf[m++] = rmass[j];
       buf[m++] = density[j]; //NP modified C.K.
     }
+    m = 9*n;
   } else {
     if (domain->triclinic == 0) {
       dx = pbc[0]*domain->xprd;
@@ -595,8 +682,12 @@ int AtomVecSphere::pack_border(int n, int *list, double *buf,
       dy = pbc[1];
       dz = pbc[2];
     }
+    #if defined(_OPENMP)
+    #pragma omp parallel for num_threads(comm->nthreads) private(j,m) if(n > OMP_MIN_ATOMS)
+    #endif
     for (i = 0; i < n; i++) {
       j = list[i];
+      m = 9*i;
       buf[m++] = x[j][0] + dx;
       buf[m++] = x[j][1] + dy;
       buf[m++] = x[j][2] + dz;
@@ -607,6 +698,7 @@ int AtomVecSphere::pack_border(int n, int *list, double *buf,
       buf[m++] = rmass[j];
       buf[m++] = density[j]; //NP modified C.K.
     }
+    m = 9*n;
   }
 
   if (atom->nextra_border)
@@ -629,8 +721,12 @@ int AtomVecSphere::pack_border_vel(int n, int *list, double *buf,
 
   m = 0;
   if (pbc_flag == 0) {
+    #if defined(_OPENMP)
+    #pragma omp parallel for num_threads(comm->nthreads) private(j,m) if(n > OMP_MIN_ATOMS)
+    #endif
     for (i = 0; i < n; i++) {
       j = list[i];
+      m = 15*i;
       buf[m++] = x[j][0];
       buf[m++] = x[j][1];
       buf[m++] = x[j][2];
@@ -647,6 +743,7 @@ int AtomVecSphere::pack_border_vel(int n, int *list, double *buf,
       buf[m++] = omega[j][1];
       buf[m++] = omega[j][2];
     }
+    m = 15*n;
   } else {
     if (domain->triclinic == 0) {
       dx = pbc[0]*domain->xprd;
@@ -658,8 +755,12 @@ int AtomVecSphere::pack_border_vel(int n, int *list, double *buf,
       dz = pbc[2];
     }
     if (!deform_vremap) {
+      #if defined(_OPENMP)
+      #pragma omp parallel for num_threads(comm->nthreads) private(j,m) if(n > OMP_MIN_ATOMS)
+      #endif
       for (i = 0; i < n; i++) {
         j = list[i];
+        m = 15*i;
         buf[m++] = x[j][0] + dx;
         buf[m++] = x[j][1] + dy;
         buf[m++] = x[j][2] + dz;
@@ -676,12 +777,17 @@ int AtomVecSphere::pack_border_vel(int n, int *list, double *buf,
         buf[m++] = omega[j][1];
         buf[m++] = omega[j][2];
       }
+      m = 15*n;
     } else {
       dvx = pbc[0]*h_rate[0] + pbc[5]*h_rate[5] + pbc[4]*h_rate[4];
       dvy = pbc[1]*h_rate[1] + pbc[3]*h_rate[3];
       dvz = pbc[2]*h_rate[2];
+      #if defined(_OPENMP)
+      #pragma omp parallel for num_threads(comm->nthreads) private(j,m) if(n > OMP_MIN_ATOMS)
+      #endif
       for (i = 0; i < n; i++) {
         j = list[i];
+        m = 15*i;
         buf[m++] = x[j][0] + dx;
         buf[m++] = x[j][1] + dy;
         buf[m++] = x[j][2] + dz;
@@ -704,6 +810,7 @@ int AtomVecSphere::pack_border_vel(int n, int *list, double *buf,
         buf[m++] = omega[j][1];
         buf[m++] = omega[j][2];
       }
+      m = 15*n;
     }
   }
 
@@ -738,8 +845,12 @@ void AtomVecSphere::unpack_border(int n, int first, double *buf)
 
   m = 0;
   last = first + n;
+  while (last > nmax) grow(0);
+  #if defined(_OPENMP)
+  #pragma omp parallel for num_threads(comm->nthreads) private(m) if(n > OMP_MIN_ATOMS)
+  #endif
   for (i = first; i < last; i++) {
-    if (i == nmax) grow(0);
+    m = 9*(i-first);
     x[i][0] = buf[m++];
     x[i][1] = buf[m++];
     x[i][2] = buf[m++];
@@ -750,6 +861,7 @@ void AtomVecSphere::unpack_border(int n, int first, double *buf)
     rmass[i] = buf[m++];
     density[i] = buf[m++]; //NP modified C.K.
   }
+  m = 9*n;
 
   if (atom->nextra_border)
     for (int iextra = 0; iextra < atom->nextra_border; iextra++)
@@ -766,8 +878,12 @@ void AtomVecSphere::unpack_border_vel(int n, int first, double *buf)
 
   m = 0;
   last = first + n;
+  while (last > nmax) grow(0);
+  #if defined(_OPENMP)
+  #pragma omp parallel for num_threads(comm->nthreads) private(m) if(n > OMP_MIN_ATOMS)
+  #endif
   for (i = first; i < last; i++) {
-    if (i == nmax) grow(0);
+    m = 15*(i-first);
     x[i][0] = buf[m++];
     x[i][1] = buf[m++];
     x[i][2] = buf[m++];
@@ -785,6 +901,7 @@ void AtomVecSphere::unpack_border_vel(int n, int first, double *buf)
     omega[i][2] = buf[m++];
     /*NL*/ //if (screen) printVec3D(screen,"creating ghost at",x[i]);
   }
+  m = 15*n;
   if (atom->nextra_border)
     for (int iextra = 0; iextra < atom->nextra_border; iextra++)
       m += modify->fix[atom->extra_border[iextra]]->
@@ -53,6 +53,7 @@ using namespace MathConst;
 #include "math_extra_liggghts_superquadric.h"
 
 #define DELTA 10000
+#define OMP_MIN_ATOMS 1000   // shorter pack/unpack loops are not threaded
 
 /* ---------------------------------------------------------------------- */
 
@@ -61,6 +62,7 @@ AtomVecSuperquadric::AtomVecSuperquadric(LAMMPS *lmp) : AtomVec(lmp)
   molecular = 0;
 
   comm_x_only = 0; comm_f_only = 0;
+  threadsafe_exchange = 1;
   size_forward = 7;
   size_reverse = 6;
   size_border = 23;
@@ -203,8 +205,12 @@ int AtomVecSuperquadric::pack_comm(int n, int *list, double *buf,
 
   m = 0;
   if (pbc_flag == 0) {
+    #if defined(_OPENMP)
+    #pragma omp parallel for num_threads(comm->nthreads) private(j,m) if(n > OMP_MIN_ATOMS)
+    #endif
     for (i = 0; i < n; i++) {
       j = list[i];
+      m = 7*i;
       buf[m++] = x[j][0];
       buf[m++] = x[j][1];
       buf[m++] = x[j][2];
@@ -215,6 +221,7 @@ int AtomVecSuperquadric::pack_comm(int n, int *list, double *buf,
       buf[m++] = quaternion[j][3];
 //----------------------------------------------------
     }
+    m = 7*n;
   } else {
     if (domain->triclinic == 0) {
       dx = pbc[0]*domain->xprd;
@@ -225,8 +232,12 @@ int AtomVecSuperquadric::pack_comm(int n, int *list, double *buf,
       dy = pbc[1]*domain->yprd + pbc[3]*domain->yz;
       dz = pbc[2]*domain->zprd;
     }
+    #if defined(_OPENMP)
+    #pragma omp parallel for num_threads(comm->nthreads) private(j,m) if(n > OMP_MIN_ATOMS)
+    #endif
     for (i = 0; i < n; i++) {
       j = list[i];
+      m = 7*i;
       buf[m++] = x[j][0] + dx;
       buf[m++] = x[j][1] + dy;
       buf[m++] = x[j][2] + dz;
@@ -237,6 +248,7 @@ int AtomVecSuperquadric::pack_comm(int n, int *list, double *buf,
       buf[m++] = quaternion[j][3];
 //----------------------------------------------------
     }
+    m = 7*n;
   }
   return m;
 }
@@ -252,8 +264,12 @@ int AtomVecSuperquadric::pack_comm_vel(int n, int *list, double *buf,
   if(radvary == 1)
       error->one(FLERR,"the case of radvary=1 for superquadrics is not implemented");
   if (pbc_flag == 0) {
+    #if defined(_OPENMP)
+    #pragma omp parallel for num_threads(comm->nthreads) private(j,m) if(n > OMP_MIN_ATOMS)
+    #endif
     for (i = 0; i < n; i++) {
       j = list[i];
+      m = 13*i;
       buf[m++] = x[j][0];
       buf[m++] = x[j][1];
       buf[m++] = x[j][2];
@@ -270,6 +286,7 @@ int AtomVecSuperquadric::pack_comm_vel(int n, int *list, double *buf,
       buf[m++] = quaternion[j][3];
 //----------------------------------------------------
     }
+    m = 13*n;
   } else {
     if (domain->triclinic == 0) {
       dx = pbc[0]*domain->xprd;
@@ -281,8 +298,12 @@ int AtomVecSuperquadric::pack_comm_vel(int n, int *list, double *buf,
       dz = pbc[2]*domain->zprd;
     }
     if (!deform_vremap) {
+      #if defined(_OPENMP)
+      #pragma omp parallel for num_threads(comm->nthreads) private(j,m) if(n > OMP_MIN_ATOMS)
+      #endif
       for (i = 0; i < n; i++) {
         j = list[i];
+        m = 13*i;
         buf[m++] = x[j][0] + dx;
         buf[m++] = x[j][1] + dy;
         buf[m++] = x[j][2] + dz;
@@ -300,12 +321,17 @@ int AtomVecSuperquadric::pack_comm_vel(int n, int *list, double *buf,
         buf[m++] = quaternion[j][3];
 //-----------------------------------------------------
       }
+      m = 13*n;
     } else {
       dvx = pbc[0]*h_rate[0] + pbc[5]*h_rate[5] + pbc[4]*h_rate[4];
       dvy = pbc[1]*h_rate[1] + pbc[3]*h_rate[3];
       dvz = pbc[2]*h_rate[2];
+      #if defined(_OPENMP)
+      #pragma omp parallel for num_threads(comm->nthreads) private(j,m) if(n > OMP_MIN_ATOMS)
+      #endif
       for (i = 0; i < n; i++) {
         j = list[i];
+        m = 13*i;
         buf[m++] = x[j][0] + dx;
         buf[m++] = x[j][1] + dy;
         buf[m++] = x[j][2] + dz;
@@ -328,6 +354,7 @@ int AtomVecSuperquadric::pack_comm_vel(int n, int *list, double *buf,
         buf[m++] = quaternion[j][3];
 //----------------------------------------------------
       }
+      m = 13*n;
     }
   }
   return m;
@@ -350,7 +377,11 @@ void AtomVecSuperquadric::unpack_comm(int n, int first, double *buf)
   if(radvary == 1)
       error->one(FLERR,"the case of radvary=1 for superquadrics is not implemented");
   last = first + n;
+  #if defined(_OPENMP)
+  #pragma omp parallel for num_threads(comm->nthreads) private(m) if(n > OMP_MIN_ATOMS)
+  #endif
   for (i = first; i < last; i++) {
+    m = 7*(i-first);
     x[i][0] = buf[m++];
     x[i][1] = buf[m++];
     x[i][2] = buf[m++];
@@ -361,6 +392,7 @@ void AtomVecSuperquadric::unpack_comm(int n, int first, double *buf)
     quaternion[i][3] = buf[m++];
 //------------------------------------------
   }
+  m = 7*n;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -372,7 +404,11 @@ void AtomVecSuperquadric::unpack_comm_vel(int n, int first, double *buf)
   if(radvary == 1)
       error->one(FLERR,"the case of radvary=1 for superquadrics is not implemented");
   last = first + n;
+  #if defined(_OPENMP)
+  #pragma omp parallel for num_threads(comm->nthreads) private(m) if(n > OMP_MIN_ATOMS)
+  #endif
   for (i = first; i < last; i++) {
+    m = 13*(i-first);
     x[i][0] = buf[m++];
     x[i][1] = buf[m++];
     x[i][2] = buf[m++];
@@ -389,6 +425,7 @@ void AtomVecSuperquadric::unpack_comm_vel(int n, int first, double *buf)
     quaternion[i][3] = buf[m++];
 //---------------------------------------------------
   }
+  m = 13*n;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -407,7 +444,11 @@ int AtomVecSuperquadric::pack_reverse(int n, int first, double *buf)
 
   m = 0;
   last = first + n;
+  #if defined(_OPENMP)
+  #pragma omp parallel for num_threads(comm->nthreads) private(m) if(n > OMP_MIN_ATOMS)
+  #endif
   for (i = first; i < last; i++) {
+    m = 6*(i-first);
     buf[m++] = f[i][0];
     buf[m++] = f[i][1];
     buf[m++] = f[i][2];
@@ -415,6 +456,7 @@ int AtomVecSuperquadric::pack_reverse(int n, int first, double *buf)
     buf[m++] = torque[i][1];
     buf[m++] = torque[i][2];
   }
+  m = 6*n;
   return m;
 }
 
@@ -433,8 +475,12 @@ void AtomVecSuperquadric::unpack_reverse(int n, int *list, double *buf)
   int i,j,m;
 
   m = 0;
+  #if defined(_OPENMP)
+  #pragma omp parallel for num_threads(comm->nthreads) private(j,m) if(n > OMP_MIN_ATOMS)
+  #endif
   for (i = 0; i < n; i++) {
     j = list[i];
+    m = 6*i;
     f[j][0] += buf[m++];
     f[j][1] += buf[m++];
     f[j][2] += buf[m++];
@@ -442,6 +488,7 @@ void AtomVecSuperquadric::unpack_reverse(int n, int *list, double *buf)
     torque[j][1] += buf[m++];
     torque[j][2] += buf[m++];
   }
+  m = 6*n;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -462,8 +509,12 @@ int AtomVecSuperquadric::pack_border(int n, int *list, double *buf,
 
   m = 0;
   if (pbc_flag == 0) {
+    #if defined(_OPENMP)
+    #pragma omp parallel for num_threads(comm->nthreads) private(j,m) if(n > OMP_MIN_ATOMS)
+    #endif
     for (i = 0; i < n; i++) {
       j = list[i];
+      m = 23*i;
       buf[m++] = x[j][0];
       buf[m++] = x[j][1];
       buf[m++] = x[j][2];
@@ -494,6 +545,7 @@ int AtomVecSuperquadric::pack_border(int n, int *list, double *buf,
       buf[m++] = quaternion[j][3];
 //----------------------------------------
     }
+    m = 23*n;
   } else {
     if (domain->triclinic == 0) {
       dx = pbc[0]*domain->xprd;
@@ -504,8 +556,12 @@ int AtomVecSuperquadric::pack_border(int n, int *list, double *buf,
       dy = pbc[1];
       dz = pbc[2];
     }
+    #if defined(_OPENMP)
+    #pragma omp parallel for num_threads(comm->nthreads) private(j,m) if(n > OMP_MIN_ATOMS)
+    #endif
     for (i = 0; i < n; i++) {
       j = list[i];
+      m = 23*i;
       buf[m++] = x[j][0] + dx;
       buf[m++] = x[j][1] + dy;
       buf[m++] = x[j][2] + dz;
@@ -536,6 +592,7 @@ int AtomVecSuperquadric::pack_border(int n, int *list, double *buf,
       buf[m++] = quaternion[j][3];
 //----------------------------------------
     }
+    m = 23*n;
   }
 
   if (atom->nextra_border)
@@ -559,8 +616,12 @@ int AtomVecSuperquadric::pack_border_vel(int n, int *list, double *buf,
 
   m = 0;
   if (pbc_flag == 0) {
+    #if defined(_OPENMP)
+    #pragma omp parallel for num_threads(comm->nthreads) private(j,m) if(n > OMP_MIN_ATOMS)
+    #endif
     for (i = 0; i < n; i++) {
       j = list[i];
+      m = 29*i;
       buf[m++] = x[j][0];
       buf[m++] = x[j][1];
       buf[m++] = x[j][2];
@@ -597,6 +658,7 @@ int AtomVecSuperquadric::pack_border_vel(int n, int *list, double *buf,
       buf[m++] = quaternion[j][3];
 //----------------------------------------
     }
+    m = 29*n;
   } else {
     if (domain->triclinic == 0) {
       dx = pbc[0]*domain->xprd;
@@ -608,8 +670,12 @@ int AtomVecSuperquadric::pack_border_vel(int n, int *list, double *buf,
       dz = pbc[2];
     }
     if (!deform_vremap) {
+      #if defined(_OPENMP)
+      #pragma omp parallel for num_threads(comm->nthreads) private(j,m) if(n > OMP_MIN_ATOMS)
+      #endif
       for (i = 0; i < n; i++) {
         j = list[i];
+        m = 29*i;
         buf[m++] = x[j][0] + dx;
         buf[m++] = x[j][1] + dy;
         buf[m++] = x[j][2] + dz;
@@ -646,12 +712,17 @@ int AtomVecSuperquadric::pack_border_vel(int n, int *list, double *buf,
         buf[m++] = quaternion[j][3];
 //----------------------------------------
       }
+      m = 29*n;
     } else {
       dvx = pbc[0]*h_rate[0] + pbc[5]*h_rate[5] + pbc[4]*h_rate[4];
       dvy = pbc[1]*h_rate[1] + pbc[3]*h_rate[3];
       dvz = pbc[2]*h_rate[2];
+      #if defined(_OPENMP)
+      #pragma omp parallel for num_threads(comm->nthreads) private(j,m) if(n > OMP_MIN_ATOMS)
+      #endif
       for (i = 0; i < n; i++) {
         j = list[i];
+        m = 29*i;
         buf[m++] = x[j][0] + dx;
         buf[m++] = x[j][1] + dy;
         buf[m++] = x[j][2] + dz;
@@ -694,6 +765,7 @@ int AtomVecSuperquadric::pack_border_vel(int n, int *list, double *buf,
         buf[m++] = quaternion[j][3];
 //----------------------------------------
       }
+      m = 29*n;
     }
   }
 
@@ -720,8 +792,12 @@ void AtomVecSuperquadric::unpack_border(int n, int first, double *buf)
 
   m = 0;
   last = first + n;
+  while (last > nmax) grow(0);
+  #if defined(_OPENMP)
+  #pragma omp parallel for num_threads(comm->nthreads) private(m) if(n > OMP_MIN_ATOMS)
+  #endif
   for (i = first; i < last; i++) {
-    if (i == nmax) grow(0);
+    m = 23*(i-first);
     x[i][0] = buf[m++];
     x[i][1] = buf[m++];
     x[i][2] = buf[m++];
@@ -752,6 +828,7 @@ void AtomVecSuperquadric::unpack_border(int n, int first, double *buf)
     quaternion[i][3] = buf[m++];
 //----------------------------------------
   }
+  m = 23*n;
 
   if (atom->nextra_border)
     for (int iextra = 0; iextra < atom->nextra_border; iextra++)
@@ -767,8 +844,12 @@ void AtomVecSuperquadric::unpack_border_vel(int n, int first, double *buf)
 
   m = 0;
   last = first + n;
+  while (last > nmax) grow(0);
+  #if defined(_OPENMP)
+  #pragma omp parallel for num_threads(comm->nthreads) private(m) if(n > OMP_MIN_ATOMS)
+  #endif
   for (i = first; i < last; i++) {
-    if (i == nmax) grow(0);
+    m = 29*(i-first);
     x[i][0] = buf[m++];
     x[i][1] = buf[m++];
     x[i][2] = buf[m++];
@@ -806,6 +887,7 @@ void AtomVecSuperquadric::unpack_border_vel(int n, int first, double *buf)
 //----------------------------------------
 
   }
+  m = 29*n;
   if (atom->nextra_border)
     for (int iextra = 0; iextra < atom->nextra_border; iextra++)
       m += modify->fix[atom->extra_border[iextra]]->
@@ -39,6 +39,9 @@
 #include "neighbor.h" //NP modified C.K.
 #include "vector_liggghts.h" //NP modified C.K.
 #include "modify.h" //NP modified C.K.
+#include "timer.h"
+#include "neigh_list.h"
+#include "fix_property_atom.h"
 
 using namespace LAMMPS_NS;
 
@@ -56,6 +59,16 @@ Balance::Balance(LAMMPS *lmp) : Pointers(lmp)
 
   memory->create(proccount,nprocs,"balance:proccount");
   memory->create(allproccount,nprocs,"balance:allproccount");
+  memory->create(procweight,nprocs,"balance:procweight");
+  memory->create(allprocweight,nprocs,"balance:allprocweight");
+
+  wflag = NONE_WEIGHT;
+  wneigh = wcontact = wmesh = 0.0;
+  weight = NULL;
+  nmax_weight = 0;
+  wtotal = 0.0;
+  wtime_last = 0.0;
+  imbsplits = 1.0;
 
   user_xsplit = user_ysplit = user_zsplit = NULL;
   dflag = 0;
@@ -70,6 +83,9 @@ Balance::~Balance()
 {
   memory->destroy(proccount);
   memory->destroy(allproccount);
+  memory->destroy(procweight);
+  memory->destroy(allprocweight);
+  memory->destroy(weight);
 
   delete [] user_xsplit;
   delete [] user_ysplit;
@@ -197,6 +213,8 @@ void Balance::command(int narg, char **arg)
         if (fp == NULL) error->one(FLERR,"Cannot open balance output file");
       }
       iarg += 2;
+    } else if (strcmp(arg[iarg],"weight") == 0) {
+      iarg = weight_args(iarg,narg,arg);
     } else error->all(FLERR,"Illegal balance command");
   }
 
@@ -241,6 +259,7 @@ void Balance::command(int narg, char **arg)
   // imbinit = initial imbalance
   // use current splits instead of nlocal since atoms may not be in sub-box
 
+  compute_weights();
   domain->x2lamda(atom->nlocal);
   int maxinit;
   double imbinit = imbalance_splits(maxinit);
@@ -309,6 +328,17 @@ void Balance::command(int narg, char **arg)
     }
   }
 
+  // per-particle costs do not migrate with the particles,
+  // so the final weighted imbalance is evaluated on the new splits
+
+  int maxfinal;
+  double imbfinal_weighted = 1.0;
+  if (weighted()) {
+    domain->x2lamda(atom->nlocal);
+    imbfinal_weighted = imbalance_splits(maxfinal);
+    domain->lamda2x(atom->nlocal);
+  }
+
   // reset proc sub-domains
 
   if (domain->triclinic) domain->set_lamda_box();
@@ -337,23 +367,23 @@ void Balance::command(int narg, char **arg)
 
   // imbfinal = final imbalance based on final nlocal
 
-  int maxfinal;
   double imbfinal = imbalance_nlocal(maxfinal);
+  if (weighted()) imbfinal = imbfinal_weighted;
 
   if (me == 0) {
     if (screen) {
       fprintf(screen,"  iteration count = %d\n",niter);
       fprintf(screen,"  initial/final max atoms/proc = %d %d\n",
               maxinit,maxfinal);
-      fprintf(screen,"  initial/final imbalance factor = %g %g\n",
-              imbinit,imbfinal);
+      fprintf(screen,"  initial/final %simbalance factor = %g %g\n",
+              weighted() ? "weighted " : "",imbinit,imbfinal);
     }
     if (logfile) {
       fprintf(logfile,"  iteration count = %d\n",niter);
       fprintf(logfile,"  initial/final max atoms/proc = %d %d\n",
               maxinit,maxfinal);
-      fprintf(logfile,"  initial/final imbalance factor = %g %g\n",
-              imbinit,imbfinal);
+      fprintf(logfile,"  initial/final %simbalance factor = %g %g\n",
+              weighted() ? "weighted " : "",imbinit,imbfinal);
     }
   }
 
@@ -393,12 +423,24 @@ void Balance::command(int narg, char **arg)
    calculate imbalance based on nlocal
    return max = max atom per proc
    return imbalance factor = max atom per proc / ave atom per proc
+   if weighted, imbalance factor = max cost per proc / ave cost per proc
+     with the weights of the last call to compute_weights()
 ------------------------------------------------------------------------- */
 
 double Balance::imbalance_nlocal(int &max)
 {
   MPI_Allreduce(&atom->nlocal,&max,1,MPI_INT,MPI_MAX,world);
   double imbalance = 1.0;
+
+  if (weighted()) {
+    double mycost = 0.0;
+    for (int i = 0; i < atom->nlocal; i++) mycost += weight[i];
+    double maxcost;
+    MPI_Allreduce(&mycost,&maxcost,1,MPI_DOUBLE,MPI_MAX,world);
+    if (wtotal > 0.0) imbalance = maxcost / (wtotal / nprocs);
+    return imbalance;
+  }
+
   if (max) imbalance = max / (1.0 * atom->natoms / nprocs);
   return imbalance;
 }
@@ -409,6 +451,7 @@ double Balance::imbalance_nlocal(int &max)
    map atoms to 3d grid of procs
    return max = max atom per proc
    return imbalance factor = max atom per proc / ave atom per proc
+   if weighted, imbalance factor = max cost per proc / ave cost per proc
 ------------------------------------------------------------------------- */
 
 double Balance::imbalance_splits(int &max)
@@ -422,22 +465,34 @@ double Balance::imbalance_splits(int &max)
   int nz = comm->procgrid[2];
 
   for (int i = 0; i < nprocs; i++) proccount[i] = 0;
+  for (int i = 0; i < nprocs; i++) procweight[i] = 0.0;
 
   double **x = atom->x;
   int nlocal = atom->nlocal;
-  int ix,iy,iz;
+  int ix,iy,iz,iproc;
 
   for (int i = 0; i < nlocal; i++) {
     ix = binary(x[i][0],nx,xsplit);
     iy = binary(x[i][1],ny,ysplit);
     iz = binary(x[i][2],nz,zsplit);
-    proccount[iz*nx*ny + iy*nx + ix]++;
+    iproc = iz*nx*ny + iy*nx + ix;
+    proccount[iproc]++;
+    if (weighted()) procweight[iproc] += weight[i];
   }
 
   MPI_Allreduce(proccount,allproccount,nprocs,MPI_INT,MPI_SUM,world);
   max = 0;
   for (int i = 0; i < nprocs; i++) max = MAX(max,allproccount[i]);
   double imbalance = 1.0;
+
+  if (weighted()) {
+    MPI_Allreduce(procweight,allprocweight,nprocs,MPI_DOUBLE,MPI_SUM,world);
+    double maxcost = 0.0;
+    for (int i = 0; i < nprocs; i++) maxcost = MAX(maxcost,allprocweight[i]);
+    if (wtotal > 0.0) imbalance = maxcost / (wtotal / nprocs);
+    return imbalance;
+  }
+
   if (max) imbalance = max / (1.0 * atom->natoms / nprocs);
   return imbalance;
 }
@@ -462,14 +517,14 @@ void Balance::static_setup(char *str)
   int max = MAX(comm->procgrid[0],comm->procgrid[1]);
   max = MAX(max,comm->procgrid[2]);
 
-  count = new bigint[max];
-  onecount = new bigint[max];
-  sum = new bigint[max+1];
-  target = new bigint[max+1];
+  count = new double[max];
+  onecount = new double[max];
+  sum = new double[max+1];
+  target = new double[max+1];
   lo = new double[max+1];
   hi = new double[max+1];
-  losum = new bigint[max+1];
-  hisum = new bigint[max+1];
+  losum = new double[max+1];
+  hisum = new double[max+1];
 
   rho = 0;
 }
@@ -490,6 +545,132 @@ void Balance::dynamic_setup(char *str, int nitermax_in, double thresh_in)
   rho = 1;
 }
 
+/* ----------------------------------------------------------------------
+   parse weight keyword of balance command or fix balance
+   arg[iarg] = "weight"
+   return index of next unparsed arg
+------------------------------------------------------------------------- */
+
+int Balance::weight_args(int iarg, int narg, char **arg)
+{
+  if (iarg+2 > narg) error->all(FLERR,"Illegal balance weight option");
+
+  if (strcmp(arg[iarg+1],"none") == 0) {
+    wflag = NONE_WEIGHT;
+    return iarg+2;
+  }
+
+  if (strcmp(arg[iarg+1],"time") == 0) {
+    wflag = TIME_WEIGHT;
+    wtime_last = 0.0;
+    return iarg+2;
+  }
+
+  if (strcmp(arg[iarg+1],"counts") == 0) {
+    if (iarg+5 > narg) error->all(FLERR,"Illegal balance weight option");
+    wflag = COUNTS_WEIGHT;
+    wneigh = force->numeric(FLERR,arg[iarg+2]);
+    wcontact = force->numeric(FLERR,arg[iarg+3]);
+    wmesh = force->numeric(FLERR,arg[iarg+4]);
+    if (wneigh < 0.0 || wcontact < 0.0 || wmesh < 0.0)
+      error->all(FLERR,"Illegal balance weight option");
+    return iarg+5;
+  }
+
+  error->all(FLERR,"Illegal balance weight option");
+  return iarg;
+}
+
+/* ----------------------------------------------------------------------
+   set cost of each owned particle for weighted balancing
+   COUNTS_WEIGHT: 1 + wneigh * pair neighbors + wcontact * pairs in contact
+                    + wmesh * mesh neighbors
+     neighbor and contact counts come from the last build of the pair list,
+     particles that were not in that build count 1
+   TIME_WEIGHT: pair, neighbor and modify time spent on this proc since
+     the last call, divided evenly among the owned particles
+     every particle counts 1 if no time was measured yet
+------------------------------------------------------------------------- */
+
+void Balance::compute_weights()
+{
+  if (!weighted()) return;
+
+  const int nlocal = atom->nlocal;
+  if (nlocal > nmax_weight) {
+    nmax_weight = atom->nmax;
+    memory->destroy(weight);
+    memory->create(weight,nmax_weight,"balance:weight");
+  }
+
+  for (int i = 0; i < nlocal; i++) weight[i] = 1.0;
+
+  if (wflag == TIME_WEIGHT) {
+    double *array = timer->array;
+    double wtime = array[TIME_PAIR] + array[TIME_NEIGHBOR] + array[TIME_MODIFY];
+
+    // timers are reset at the start of each run
+
+    double elapsed = wtime - wtime_last;
+    if (elapsed < 0.0) elapsed = wtime;
+    wtime_last = wtime;
+
+    double minelapsed;
+    MPI_Allreduce(&elapsed,&minelapsed,1,MPI_DOUBLE,MPI_MIN,world);
+    if (minelapsed > 0.0 && nlocal > 0)
+      for (int i = 0; i < nlocal; i++) weight[i] = elapsed / nlocal;
+
+  } else if (wflag == COUNTS_WEIGHT) {
+    NeighList *list = force->pair ? force->pair->list : NULL;
+    if (list && (wneigh > 0.0 || wcontact > 0.0)) {
+      double **x = atom->x;
+      double *radius = atom->radius;
+      const int inum = list->inum;
+      int *ilist = list->ilist;
+      int *numneigh = list->numneigh;
+      int **firstneigh = list->firstneigh;
+
+      for (int ii = 0; ii < inum; ii++) {
+        const int i = ilist[ii];
+        if (i >= nlocal) continue;
+        const int jnum = numneigh[i];
+        weight[i] += wneigh * jnum;
+
+        if (wcontact == 0.0 || !radius) continue;
+        const int *jlist = firstneigh[i];
+        int ncontact = 0;
+        for (int jj = 0; jj < jnum; jj++) {
+          const int j = jlist[jj] & NEIGHMASK;
+          if (j >= atom->nlocal + atom->nghost) continue;
+          const double delx = x[i][0] - x[j][0];
+          const double dely = x[i][1] - x[j][1];
+          const double delz = x[i][2] - x[j][2];
+          const double radsum = radius[i] + radius[j];
+          if (delx*delx + dely*dely + delz*delz < radsum*radsum) ncontact++;
+        }
+        weight[i] += wcontact * ncontact;
+      }
+    }
+
+    // # of mesh neighbors is stored by each fix neighlist/mesh
+    // in a fix property/atom with id n_neighs_mesh_(mesh id)
+
+    if (wmesh > 0.0) {
+      for (int ifix = 0; ifix < modify->nfix; ifix++) {
+        Fix *fix = modify->fix[ifix];
+        if (strcmp(fix->style,"property/atom") || strncmp(fix->id,"n_neighs_mesh_",14))
+          continue;
+        double *nneighs = static_cast<FixPropertyAtom*>(fix)->vector_atom;
+        for (int i = 0; i < nlocal; i++) weight[i] += wmesh * nneighs[i];
+      }
+    }
+  }
+
+  double mytotal = 0.0;
+  for (int i = 0; i < nlocal; i++) mytotal += weight[i];
+  MPI_Allreduce(&mytotal,&wtotal,1,MPI_DOUBLE,MPI_SUM,world);
+}
+
 /* ----------------------------------------------------------------------
    load balance by changing xyz split proc boundaries in Comm
    called one time from input script command or many times from fix balance
@@ -506,6 +687,11 @@ int Balance::dynamic()
   bigint natoms = atom->natoms;
   if (natoms == 0) return 0;
 
+  // total = sum to distribute, # of atoms or their total cost
+
+  double total = weighted() ? wtotal : natoms;
+  if (total <= 0.0) return 0;
+
   // set delta for 1d balancing = root of threshhold
   // root = # of dimensions being balanced on
 
@@ -540,9 +726,14 @@ int Balance::dynamic()
 
     // target[i] = desired sum at split I
 
-    for (i = 0; i < np; i++)
-      target[i] = static_cast<int> (1.0*natoms/np * i + 0.5);
-    target[np] = natoms;
+    if (weighted()) {
+      for (i = 0; i < np; i++)
+        target[i] = total/np * i;
+    } else {
+      for (i = 0; i < np; i++)
+        target[i] = static_cast<bigint> (1.0*natoms/np * i + 0.5);
+    }
+    target[np] = total;
 
     // lo[i] = closest split <= split[i] with a sum <= target
     // hi[i] = closest split >= split[i] with a sum >= target
@@ -550,7 +741,7 @@ int Balance::dynamic()
     lo[0] = hi[0] = 0.0;
     lo[np] = hi[np] = 1.0;
     losum[0] = hisum[0] = 0;
-    losum[np] = hisum[np] = natoms;
+    losum[np] = hisum[np] = total;
 
     for (i = 1; i < np; i++) {
       for (j = i; j >= 0; j--)
@@ -596,7 +787,7 @@ int Balance::dynamic()
 
       doneflag = 1;
       for (i = 1; i < np; i++)
-        if (fabs(1.0*(sum[i]-target[i]))/target[i] > delta) doneflag = 0;
+        if (fabs(sum[i]-target[i])/target[i] > delta) doneflag = 0;
       if (doneflag) break;
     }
 
@@ -677,6 +868,10 @@ int Balance::dynamic()
 
   memory->destroy(split_old);   //NP modified C.K.
 
+  // imbalance factor of the final splits
+
+  imbsplits = imbalance_splits(max);
+
   // restore real coords
 
   domain->lamda2x(atom->nlocal);
@@ -686,6 +881,7 @@ int Balance::dynamic()
 
 /* ----------------------------------------------------------------------
    count atoms in each slice, based on their dim coordinate
+   if weighted, sum up the cost of the atoms instead
    N = # of slices
    split = N+1 cuts between N slices
    return updated count = particles per slice
@@ -695,18 +891,25 @@ int Balance::dynamic()
 
 void Balance::tally(int dim, int n, double *split)
 {
-  for (int i = 0; i < n; i++) onecount[i] = 0;
+  for (int i = 0; i < n; i++) onecount[i] = 0.0;
 
   double **x = atom->x;
   int nlocal = atom->nlocal;
   int index;
 
-  for (int i = 0; i < nlocal; i++) {
-    index = binary(x[i][dim],n,split);
-    onecount[index]++;
+  if (weighted()) {
+    for (int i = 0; i < nlocal; i++) {
+      index = binary(x[i][dim],n,split);
+      onecount[index] += weight[i];
+    }
+  } else {
+    for (int i = 0; i < nlocal; i++) {
+      index = binary(x[i][dim],n,split);
+      onecount[index] += 1.0;
+    }
   }
 
-  MPI_Allreduce(onecount,count,n,MPI_LMP_BIGINT,MPI_SUM,world);
+  MPI_Allreduce(onecount,count,n,MPI_DOUBLE,MPI_SUM,world);
 
   sum[0] = 0;
   for (int i = 1; i < n+1; i++)
@@ -782,7 +985,7 @@ int Balance::adjust(int n, double *split)
      by moving cut closer to sender, further from receiver
 ------------------------------------------------------------------------- */
 
-void Balance::old_adjust(int iter, int n, bigint *count, double *split)
+void Balance::old_adjust(int iter, int n, double *count, double *split)
 {
   // need to allocate this if start using it again
 
@@ -798,7 +1001,7 @@ void Balance::old_adjust(int iter, int n, bigint *count, double *split)
   // for a cut between 2 slices, only slice with larger count adjusts it
   // special treatment of end slices with only 1 neighbor
 
-  bigint leftcount,mycount,rightcount;
+  double leftcount,mycount,rightcount;
   double rho,target; //NP modified R.B.
 
   for (int i = 0; i < n; i++) {
@@ -1042,13 +1245,13 @@ void Balance::debug_output(int idim, int m, int np, double *split)
   printf("Dimension %s, Iteration %d\n",dim,m);
 
   printf("  Count:");
-  for (i = 0; i < np; i++) printf(" " BIGINT_FORMAT,count[i]);
+  for (i = 0; i < np; i++) printf(" %g",count[i]);
   printf("\n");
   printf("  Sum:");
-  for (i = 0; i <= np; i++) printf(" " BIGINT_FORMAT,sum[i]);
+  for (i = 0; i <= np; i++) printf(" %g",sum[i]);
   printf("\n");
   printf("  Target:");
-  for (i = 0; i <= np; i++) printf(" " BIGINT_FORMAT,target[i]);
+  for (i = 0; i <= np; i++) printf(" %g",target[i]);
   printf("\n");
   printf("  Actual cut:");
   for (i = 0; i <= np; i++)
@@ -1061,19 +1264,19 @@ void Balance::debug_output(int idim, int m, int np, double *split)
   for (i = 0; i <= np; i++) printf(" %g",lo[i]);
   printf("\n");
   printf("  Low-sum:");
-  for (i = 0; i <= np; i++) printf(" " BIGINT_FORMAT,losum[i]);
+  for (i = 0; i <= np; i++) printf(" %g",losum[i]);
   printf("\n");
   printf("  Hi:");
   for (i = 0; i <= np; i++) printf(" %g",hi[i]);
   printf("\n");
   printf("  Hi-sum:");
-  for (i = 0; i <= np; i++) printf(" " BIGINT_FORMAT,hisum[i]);
+  for (i = 0; i <= np; i++) printf(" %g",hisum[i]);
   printf("\n");
   printf("  Delta:");
   for (i = 0; i < np; i++) printf(" %g",split[i+1]-split[i]);
   printf("\n");
 
-  bigint max = 0;
+  double max = 0.0;
   for (i = 0; i < np; i++) max = MAX(max,count[i]);
   printf("  Imbalance factor: %g\n",1.0*max*np/target[np]);
 }
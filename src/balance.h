@@ -45,6 +45,11 @@ class Balance : protected Pointers {
   double imbalance_nlocal(int &);
   void dumpout(bigint, FILE *);
 
+  int weight_args(int, int, char **);
+  void compute_weights();
+  bool weighted() const { return wflag != NONE_WEIGHT; }
+  double imbalance_final() const { return imbsplits; }
+
   bool disallow_irregular();   //NP modified C.K.
 
  private:
@@ -60,18 +65,33 @@ class Balance : protected Pointers {
 
   int ndim;                  // length of balance string bstr
   int *bdim;                 // XYZ for each character in bstr
-  bigint *count;             // counts for slices in one dim
-  bigint *onecount;          // work vector of counts in one dim
-  bigint *sum;               // cummulative count for slices in one dim
-  bigint *target;            // target sum for slices in one dim
+  double *count;             // counts for slices in one dim
+  double *onecount;          // work vector of counts in one dim
+  double *sum;               // cummulative count for slices in one dim
+  double *target;            // target sum for slices in one dim
   double *lo,*hi;            // lo/hi split coords that bound each target
-  bigint *losum,*hisum;      // cummulative counts at lo/hi coords
+  double *losum,*hisum;      // cummulative counts at lo/hi coords
   int rho;                   // 0 for geometric recursion
                              // 1 for density weighted recursion
 
   int *proccount;            // particle count per processor
   int *allproccount;
 
+  // weighted balancing: counts above are sums of per-particle costs
+
+  enum{NONE_WEIGHT,COUNTS_WEIGHT,TIME_WEIGHT};
+  int wflag;                 // source of the per-particle cost
+  double wneigh;             // cost per pair neighbor, COUNTS_WEIGHT
+  double wcontact;           // cost per particle contact, COUNTS_WEIGHT
+  double wmesh;              // cost per mesh neighbor, COUNTS_WEIGHT
+  double *weight;            // cost of each owned particle
+  int nmax_weight;
+  double wtotal;             // sum of weight over all procs
+  double wtime_last;         // timer sum at last call of compute_weights()
+  double *procweight;        // cost per processor
+  double *allprocweight;
+  double imbsplits;          // imbalance factor of splits after dynamic()
+
   int outflag;               // for output of balance results to file
   FILE *fp;
   int firststep;
@@ -80,7 +100,7 @@ class Balance : protected Pointers {
   double imbalance_splits(int &);
   void tally(int, int, double *);
   int adjust(int, double *);
-  void old_adjust(int, int, bigint *, double *);
+  void old_adjust(int, int, double *, double *);
   int binary(double, int, double *);
   void debug_output(int, int, int, double *);
 };
@@ -119,6 +139,11 @@ E: Lost atoms via balance: original %ld current %ld
 
 This should not occur.  Report the problem to the developers.
 
+E: Illegal balance weight option
+
+Weight must be {none}, {time}, or {counts} followed by three
+non-negative costs.
+
 E: Balance produced bad splits
 
 This should not occur.  It means two or more cutting plane locations
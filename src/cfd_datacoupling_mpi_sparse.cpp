@@ -0,0 +1,323 @@
+/* ----------------------------------------------------------------------
+   LIGGGHTS - LAMMPS Improved for General Granular and Granular Heat
+   Transfer Simulations
+
+   LIGGGHTS is part of the CFDEMproject
+   www.liggghts.com | www.cfdem.com
+
+   Christoph Kloss, christoph.kloss@cfdem.com
+   Copyright 2009-2012 JKU Linz
+   Copyright 2012-     DCS Computing GmbH, Linz
+
+   LIGGGHTS is based on LAMMPS
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   This software is distributed under the GNU General Public License.
+
+   See the README file in the top-level directory.
+------------------------------------------------------------------------- */
+
+#include <string.h>
+#include <algorithm>
+#include "atom.h"
+#include "update.h"
+#include "error.h"
+#include "comm.h"
+#include "vector_liggghts.h"
+#include "fix_cfd_coupling.h"
+#include "cfd_datacoupling_mpi_sparse.h"
+
+using namespace LAMMPS_NS;
+using namespace std;
+
+#define BIG 1.0e20
+
+/* ---------------------------------------------------------------------- */
+
+CfdDatacouplingMPISparse::CfdDatacouplingMPISparse(LAMMPS *lmp,int iarg, int narg, char **arg,FixCfdCoupling* fc) :
+  CfdDatacouplingMPI(lmp, iarg, narg, arg,fc)
+{
+  cfdlo_[0] = cfdlo_[1] = cfdlo_[2] = -BIG;
+  cfdhi_[0] = cfdhi_[1] = cfdhi_[2] = BIG;
+}
+
+CfdDatacouplingMPISparse::~CfdDatacouplingMPISparse()
+{
+}
+
+/* ---------------------------------------------------------------------- */
+
+void CfdDatacouplingMPISparse::pull(const char *name,const char *type,void *&from,const char *datatype)
+{
+    if(strstr(type,"global"))
+    {
+        CfdDatacouplingMPI::pull(name,type,from,datatype);
+        return;
+    }
+
+    CfdDatacoupling::pull(name,type,from,datatype);
+
+    if(strcmp(datatype,"double") == 0)
+        pull_sparse<double>(name,type,from);
+    else if(strcmp(datatype,"int") == 0)
+        pull_sparse<int>(name,type,from);
+    else error->one(FLERR,"Illegal call to CfdDatacouplingMPISparse::pull, valid datatypes are 'int' and double'");
+}
+
+/* ---------------------------------------------------------------------- */
+
+void CfdDatacouplingMPISparse::push(const char *name,const char *type,void *&to,const char *datatype)
+{
+    if(strstr(type,"global"))
+    {
+        CfdDatacouplingMPI::push(name,type,to,datatype);
+        return;
+    }
+
+    CfdDatacoupling::push(name,type,to,datatype);
+
+    if(strcmp(datatype,"double") == 0)
+        push_sparse<double>(name,type,to);
+    else if(strcmp(datatype,"int") == 0)
+        push_sparse<int>(name,type,to);
+    else error->one(FLERR,"Illegal call to CfdDatacouplingMPISparse::push, valid datatypes are 'int' and double'");
+}
+
+/* ---------------------------------------------------------------------- */
+
+void CfdDatacouplingMPISparse::set_boundingbox(const double *lo, const double *hi)
+{
+    vectorCopy3D(lo,cfdlo_);
+    vectorCopy3D(hi,cfdhi_);
+
+    // force rebuild of the routing in the next push or pull
+    atoms_.step = bodies_.step = -1;
+}
+
+/* ---------------------------------------------------------------------- */
+
+int CfdDatacouplingMPISparse::received_tags(const char *type, int *&tags)
+{
+    RoutingTable &rt = routing(is_body(type));
+    tags = rt.recvtag.empty() ? NULL : &rt.recvtag[0];
+    return rt.recvtag.size();
+}
+
+/* ----------------------------------------------------------------------
+   routing table for atoms or bodies, rebuilt once per coupling step
+   collective, all ranks push and pull the same properties
+------------------------------------------------------------------------- */
+
+CfdDatacouplingMPISparse::RoutingTable& CfdDatacouplingMPISparse::routing(bool body)
+{
+    MultisphereParallel *ms_data = properties_->ms_data();
+
+    if(body && !ms_data)
+        error->one(FLERR,"Transferring a multisphere property from/to LIGGGHTS requires a fix multisphere");
+
+    RoutingTable &rt = body ? bodies_ : atoms_;
+    const bigint nglobal = body ? ms_data->n_body_all() : atom->natoms;
+
+    if(rt.step != update->ntimestep || rt.nglobal != nglobal)
+    {
+        build_routing(rt,body);
+        rt.step = update->ntimestep;
+        rt.nglobal = nglobal;
+    }
+
+    return rt;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void CfdDatacouplingMPISparse::build_routing(RoutingTable &rt, bool body)
+{
+    MultisphereParallel *ms_data = properties_->ms_data();
+    const int nitems = body ? ms_data->n_body() : atom->nlocal;
+    const int nprocs = comm->nprocs;
+    double **x = atom->x;
+    int *tag = atom->tag;
+
+    // positions of the items this rank owns
+
+    vector<double> pos(3*nitems+1);
+    vector<int> itemtag(nitems+1);
+    for(int i = 0; i < nitems; i++)
+    {
+        if(body)
+        {
+            ms_data->xcm(&pos[3*i],i);
+            itemtag[i] = ms_data->tag(i);
+        }
+        else
+        {
+            vectorCopy3D(x[i],&pos[3*i]);
+            itemtag[i] = tag[i];
+        }
+    }
+
+    // bounding box of the items and CFD box of every rank
+
+    double box[12];
+    box[0] = box[1] = box[2] = BIG;
+    box[3] = box[4] = box[5] = -BIG;
+    for(int i = 0; i < nitems; i++)
+        for(int dim = 0; dim < 3; dim++)
+        {
+            box[dim]   = min(box[dim],  pos[3*i+dim]);
+            box[3+dim] = max(box[3+dim],pos[3*i+dim]);
+        }
+    vectorCopy3D(cfdlo_,&box[6]);
+    vectorCopy3D(cfdhi_,&box[9]);
+
+    vector<double> allbox(12*nprocs);
+    MPI_Allgather(box,12,MPI_DOUBLE,&allbox[0],12,MPI_DOUBLE,world);
+
+    // send to every rank whose CFD box overlaps my items,
+    // receive from every rank whose items overlap my CFD box
+    // the test is symmetric so both sides agree on the messages
+
+    vector<int> sendprocs,recvprocs;
+    for(int p = 0; p < nprocs; p++)
+    {
+        const double *pbox = &allbox[12*p];
+        bool send = true, recv = true;
+        for(int dim = 0; dim < 3; dim++)
+        {
+            if(box[dim] > pbox[9+dim] || pbox[6+dim] > box[3+dim])
+                send = false;
+            if(pbox[dim] > cfdhi_[dim] || cfdlo_[dim] > pbox[3+dim])
+                recv = false;
+        }
+        if(send) sendprocs.push_back(p);
+        if(recv) recvprocs.push_back(p);
+    }
+
+    // assign items to ranks, grouped by rank
+
+    const int nsendprocs = sendprocs.size();
+    vector<int> sendcount(nsendprocs,0);
+    vector<int> senditem,sendtag;
+
+    for(int ip = 0; ip < nsendprocs; ip++)
+    {
+        const double *lo = &allbox[12*sendprocs[ip]+6];
+        const double *hi = &allbox[12*sendprocs[ip]+9];
+        for(int i = 0; i < nitems; i++)
+        {
+            const double *xi = &pos[3*i];
+            if(xi[0] >= lo[0] && xi[0] <= hi[0] &&
+               xi[1] >= lo[1] && xi[1] <= hi[1] &&
+               xi[2] >= lo[2] && xi[2] <= hi[2])
+            {
+                senditem.push_back(i);
+                sendtag.push_back(itemtag[i]);
+                sendcount[ip]++;
+            }
+        }
+    }
+
+    // a rank whose tag list did not change since the last coupling step
+    // gets -1 instead of the count and keeps its list
+
+    vector<int> sendflag(nsendprocs+1);
+    int offset = 0;
+    for(int ip = 0; ip < nsendprocs; ip++)
+    {
+        sendflag[ip] = sendcount[ip];
+
+        vector<int>::iterator it = find(rt.sendprocs.begin(),rt.sendprocs.end(),sendprocs[ip]);
+        if(it != rt.sendprocs.end())
+        {
+            const int iold = it - rt.sendprocs.begin();
+            int oldoffset = 0;
+            for(int k = 0; k < iold; k++)
+                oldoffset += rt.sendcount[k];
+            if(rt.sendcount[iold] == sendcount[ip] &&
+               equal(sendtag.begin()+offset,sendtag.begin()+offset+sendcount[ip],rt.sendtag.begin()+oldoffset))
+                sendflag[ip] = -1;
+        }
+        offset += sendcount[ip];
+    }
+
+    const int nrecvprocs = recvprocs.size();
+    vector<int> recvflag(nrecvprocs+1);
+    vector<int> one_s(nsendprocs,1),one_r(nrecvprocs,1);
+    exchange<int>(sendprocs,one_s,&sendflag[0],recvprocs,one_r,&recvflag[0],1);
+
+    // tag lists that changed
+
+    vector<int> changed_sendprocs,changed_sendcount,changed_sendtag;
+    offset = 0;
+    for(int ip = 0; ip < nsendprocs; ip++)
+    {
+        if(sendflag[ip] >= 0)
+        {
+            changed_sendprocs.push_back(sendprocs[ip]);
+            changed_sendcount.push_back(sendcount[ip]);
+            changed_sendtag.insert(changed_sendtag.end(),sendtag.begin()+offset,sendtag.begin()+offset+sendcount[ip]);
+        }
+        offset += sendcount[ip];
+    }
+
+    vector<int> changed_recvprocs,changed_recvcount;
+    int nchanged_recv = 0;
+    for(int ip = 0; ip < nrecvprocs; ip++)
+    {
+        if(recvflag[ip] >= 0)
+        {
+            changed_recvprocs.push_back(recvprocs[ip]);
+            changed_recvcount.push_back(recvflag[ip]);
+            nchanged_recv += recvflag[ip];
+        }
+    }
+
+    vector<int> changed_recvtag(nchanged_recv+1);
+    changed_sendtag.push_back(0);
+    exchange<int>(changed_sendprocs,changed_sendcount,&changed_sendtag[0],changed_recvprocs,changed_recvcount,&changed_recvtag[0],1);
+
+    // assemble the received tags, unchanged lists are taken from the old table
+
+    vector<int> recvcount(nrecvprocs);
+    vector<int> recvtag;
+    int changed_offset = 0;
+    for(int ip = 0; ip < nrecvprocs; ip++)
+    {
+        if(recvflag[ip] >= 0)
+        {
+            recvcount[ip] = recvflag[ip];
+            recvtag.insert(recvtag.end(),changed_recvtag.begin()+changed_offset,changed_recvtag.begin()+changed_offset+recvflag[ip]);
+            changed_offset += recvflag[ip];
+        }
+        else
+        {
+            vector<int>::iterator it = find(rt.recvprocs.begin(),rt.recvprocs.end(),recvprocs[ip]);
+            if(it == rt.recvprocs.end())
+                error->one(FLERR,"Internal error in CfdDatacouplingMPISparse: routing tables out of sync");
+            const int iold = it - rt.recvprocs.begin();
+            int oldoffset = 0;
+            for(int k = 0; k < iold; k++)
+                oldoffset += rt.recvcount[k];
+            recvcount[ip] = rt.recvcount[iold];
+            recvtag.insert(recvtag.end(),rt.recvtag.begin()+oldoffset,rt.recvtag.begin()+oldoffset+rt.recvcount[iold]);
+        }
+    }
+
+    // tags routed here before but not any more
+
+    vector<int> oldtags(rt.recvtag),newtags(recvtag);
+    sort(oldtags.begin(),oldtags.end());
+    sort(newtags.begin(),newtags.end());
+    rt.dropped.clear();
+    set_difference(oldtags.begin(),oldtags.end(),newtags.begin(),newtags.end(),back_inserter(rt.dropped));
+
+    rt.sendprocs.swap(sendprocs);
+    rt.sendcount.swap(sendcount);
+    rt.senditem.swap(senditem);
+    rt.sendtag.swap(sendtag);
+    rt.recvprocs.swap(recvprocs);
+    rt.recvcount.swap(recvcount);
+    rt.recvtag.swap(recvtag);
+}
@@ -0,0 +1,292 @@
+/* ----------------------------------------------------------------------
+   LIGGGHTS - LAMMPS Improved for General Granular and Granular Heat
+   Transfer Simulations
+
+   LIGGGHTS is part of the CFDEMproject
+   www.liggghts.com | www.cfdem.com
+
+   Christoph Kloss, christoph.kloss@cfdem.com
+   Copyright 2009-2012 JKU Linz
+   Copyright 2012-     DCS Computing GmbH, Linz
+
+   LIGGGHTS is based on LAMMPS
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   This software is distributed under the GNU General Public License.
+
+   See the README file in the top-level directory.
+------------------------------------------------------------------------- */
+
+#ifdef CFD_DATACOUPLING_CLASS
+
+   CfdDataCouplingStyle(mpi/sparse,CfdDatacouplingMPISparse)
+
+#else
+
+#ifndef LMP_CFD_DATACOUPLING_MPI_SPARSE_H
+#define LMP_CFD_DATACOUPLING_MPI_SPARSE_H
+
+#include "cfd_datacoupling_mpi.h"
+#include "atom.h"
+#include "comm.h"
+#include <string.h>
+#include <vector>
+
+namespace LAMMPS_NS {
+
+/* ----------------------------------------------------------------------
+   same interface as CfdDatacouplingMPI, but per-atom and per-body data
+   is not allreduced over arrays of length tag_max
+   instead, each rank sends the particles it owns only to the CFD ranks
+   whose bounding box (see sparse_set_boundingbox()) contains them, and
+   pulls the CFD data of these particles back from the same ranks
+
+   the routing table is built once per coupling step and used for all
+   properties pushed and pulled in that step
+   tag lists that did not change since the last coupling step are not
+   sent again
+
+   the caller's global arrays keep their tag_max length, but only the rows
+   of particles routed to this rank are written by a push, and only these
+   rows are read by a pull. rows of particles that left the box of this
+   rank are set to zero. global properties are allreduced as before
+------------------------------------------------------------------------- */
+
+class CfdDatacouplingMPISparse : public CfdDatacouplingMPI {
+ public:
+  CfdDatacouplingMPISparse(class LAMMPS *, int,int, char **,class FixCfdCoupling*);
+  ~CfdDatacouplingMPISparse();
+
+  virtual void pull(const char *name, const char *type, void *&ptr, const char *datatype);
+  virtual void push(const char *name, const char *type, void *&ptr, const char *datatype);
+
+  template <typename T> void pull_sparse(const char *,const char *,void *&);
+  template <typename T> void push_sparse(const char *,const char *,void *&);
+
+  // region of the CFD domain on this rank, particles outside are not sent
+  // default is everything
+  void set_boundingbox(const double *lo, const double *hi);
+
+  // tags of the particles (type "atom") or bodies (type "multisphere")
+  // routed to this rank in the current coupling step
+  int received_tags(const char *type, int *&tags);
+
+ private:
+
+  struct RoutingTable {
+    RoutingTable() : step(-1), nglobal(-1) {}
+
+    // coupling step and global # of items the table was built for
+    bigint step;
+    bigint nglobal;
+
+    // ranks this rank sends to in a push, with # of items each
+    // and local index and tag of the items, grouped by rank
+    std::vector<int> sendprocs;
+    std::vector<int> sendcount;
+    std::vector<int> senditem;
+    std::vector<int> sendtag;
+
+    // ranks this rank receives from in a push, with # of items each
+    // and tags of the items, grouped by rank
+    std::vector<int> recvprocs;
+    std::vector<int> recvcount;
+    std::vector<int> recvtag;
+
+    // tags that were routed to this rank in the previous coupling step
+    // but not in this one
+    std::vector<int> dropped;
+  };
+
+  RoutingTable& routing(bool body);
+  void build_routing(RoutingTable &rt, bool body);
+
+  template <typename T> void exchange(const std::vector<int> &sprocs, const std::vector<int> &scount, const T *sbuf,
+                                      const std::vector<int> &rprocs, const std::vector<int> &rcount, T *rbuf, int len2);
+
+  static bool is_body(const char *type)
+  { return strstr(type,"multisphere") != NULL; }
+
+  // CFD bounding box of this rank
+  double cfdlo_[3],cfdhi_[3];
+
+  RoutingTable atoms_;
+  RoutingTable bodies_;
+
+  std::vector<MPI_Request> requests_;
+  std::vector<MPI_Status> statuses_;
+};
+
+/* ----------------------------------------------------------------------
+   send rows of length len2 to sprocs, receive rows from rprocs
+   counts are # of rows, buffers are grouped by rank
+   rows for this rank itself are copied
+------------------------------------------------------------------------- */
+
+template <typename T>
+void CfdDatacouplingMPISparse::exchange(const std::vector<int> &sprocs, const std::vector<int> &scount, const T *sbuf,
+                                        const std::vector<int> &rprocs, const std::vector<int> &rcount, T *rbuf, int len2)
+{
+    const int me = comm->me;
+    const int nsend = sprocs.size();
+    const int nrecv = rprocs.size();
+
+    requests_.resize(nsend+nrecv);
+    statuses_.resize(nsend+nrecv);
+
+    int nrequest = 0;
+    T *rself = NULL;
+    int offset = 0;
+    for(int p = 0; p < nrecv; p++)
+    {
+        if(rprocs[p] == me)
+            rself = &rbuf[offset];
+        else if(rcount[p] > 0)
+            MPI_Irecv(&rbuf[offset],rcount[p]*len2,mpi_type_dc<T>(),rprocs[p],0,world,&requests_[nrequest++]);
+        offset += rcount[p]*len2;
+    }
+
+    offset = 0;
+    for(int p = 0; p < nsend; p++)
+    {
+        if(sprocs[p] == me)
+        {
+            if(rself)
+                memcpy(rself,&sbuf[offset],scount[p]*len2*sizeof(T));
+        }
+        else if(scount[p] > 0)
+            MPI_Isend(const_cast<T*>(&sbuf[offset]),scount[p]*len2,mpi_type_dc<T>(),sprocs[p],0,world,&requests_[nrequest++]);
+        offset += scount[p]*len2;
+    }
+
+    if(nrequest > 0)
+        MPI_Waitall(nrequest,&requests_[0],&statuses_[0]);
+}
+
+/* ---------------------------------------------------------------------- */
+//NP OF to LIGGGHTS, global to local
+//NP ptr to is local, ptr from is global
+
+template <typename T>
+void CfdDatacouplingMPISparse::pull_sparse(const char *name,const char *type,void *&from)
+{
+    int len1 = -1, len2 = -1;
+
+    // get reference where to write the data
+    void * to = find_pull_property(name,type,len1,len2);
+
+    if (atom->nlocal && (!to || len1 < 0 || len2 < 0))
+    {
+        if(screen) fprintf(screen,"LIGGGHTS could not find property %s to write data from calling program to.\n",name);
+        lmp->error->one(FLERR,"This is fatal");
+    }
+
+    // return if no data to transmit
+    if(len1*len2 < 1) return;
+
+    const bool body = is_body(type);
+    const bool scalar = strncmp(type,"scalar",6) == 0;
+    const int nitems = body ? properties_->ms_data()->n_body() : atom->nlocal;
+
+    RoutingTable &rt = routing(body);
+
+    // rows of the particles this rank got in the push go back to their owners
+    const int nrecv = rt.recvtag.size();
+    const int nsend = rt.senditem.size();
+    std::vector<T> buf_out(nrecv*len2+1);
+    std::vector<T> buf_in(nsend*len2+1);
+
+    const T *from_t = &(((T**)from)[0][0]);
+    for(int k = 0; k < nrecv; k++)
+        for(int j = 0; j < len2; j++)
+            buf_out[k*len2+j] = from_t[(rt.recvtag[k]-1)*len2+j];
+
+    exchange<T>(rt.recvprocs,rt.recvcount,&buf_out[0],rt.sendprocs,rt.sendcount,&buf_in[0],len2);
+
+    // sum up contributions, as MPI_SUM does in CfdDatacouplingMPI::pull_mpi
+    if(scalar)
+    {
+        T *to_t = (T*) to;
+        for(int i = 0; i < nitems; i++)
+            to_t[i] = 0;
+        for(int k = 0; k < nsend; k++)
+            to_t[rt.senditem[k]] += buf_in[k];
+    }
+    else
+    {
+        T **to_t = (T**) to;
+        for(int i = 0; i < nitems; i++)
+            for(int j = 0; j < len2; j++)
+                to_t[i][j] = 0;
+        for(int k = 0; k < nsend; k++)
+            for(int j = 0; j < len2; j++)
+                to_t[rt.senditem[k]][j] += buf_in[k*len2+j];
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+//NP LIGGGHTS to OF, local to global
+//NP ptr from is local, ptr to is global
+
+template <typename T>
+void CfdDatacouplingMPISparse::push_sparse(const char *name,const char *type,void *&to)
+{
+    int len1 = -1, len2 = -1;
+
+    // get reference where to read the data from
+    void * from = find_push_property(name,type,len1,len2);
+
+    if (atom->nlocal && (!from || len1 < 0 || len2 < 0))
+    {
+        if(screen) fprintf(screen,"LIGGGHTS could not find property %s to write data from calling program to.\n",name);
+        lmp->error->one(FLERR,"This is fatal");
+    }
+
+    // return if no data to transmit
+    if(len1*len2 < 1) return;
+
+    const bool body = is_body(type);
+    const bool scalar = strncmp(type,"scalar",6) == 0;
+
+    RoutingTable &rt = routing(body);
+
+    const int nsend = rt.senditem.size();
+    const int nrecv = rt.recvtag.size();
+    std::vector<T> buf_out(nsend*len2+1);
+    std::vector<T> buf_in(nrecv*len2+1);
+
+    if(scalar)
+    {
+        T *from_t = (T*) from;
+        for(int k = 0; k < nsend; k++)
+            buf_out[k] = from_t[rt.senditem[k]];
+    }
+    else
+    {
+        T **from_t = (T**) from;
+        for(int k = 0; k < nsend; k++)
+            for(int j = 0; j < len2; j++)
+                buf_out[k*len2+j] = from_t[rt.senditem[k]][j];
+    }
+
+    exchange<T>(rt.sendprocs,rt.sendcount,&buf_out[0],rt.recvprocs,rt.recvcount,&buf_in[0],len2);
+
+    T *to_t = &(((T**)to)[0][0]);
+
+    // particles no longer routed here must not keep stale values
+    const int ndropped = rt.dropped.size();
+    for(int k = 0; k < ndropped; k++)
+        for(int j = 0; j < len2; j++)
+            to_t[(rt.dropped[k]-1)*len2+j] = 0;
+
+    for(int k = 0; k < nrecv; k++)
+        for(int j = 0; j < len2; j++)
+            to_t[(rt.recvtag[k]-1)*len2+j] = buf_in[k*len2+j];
+}
+
+}
+
+#endif
+#endif
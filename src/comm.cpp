@@ -63,6 +63,9 @@ using namespace LAMMPS_NS;
 #define BUFMIN 1000
 #define BUFEXTRA 1000
 #define BIG 1.0e20
+#define OMP_MIN_ATOMS 1000   // shorter selection loops are not threaded
+
+#define TAG_OVERLAP 1101   // 2 tags, distinct from blocking comm
 
 enum{SINGLE,MULTI};
 enum{MULTIPLE};                   // same as in ProcMap
@@ -103,6 +106,18 @@ Comm::Comm(LAMMPS *lmp) : Pointers(lmp)
   cutghostmulti = NULL;
   cutghostuser = 0.0;
   ghost_velocity = 0;
+  overlap_flag = 0;
+
+  overlap_stage = overlap_nrequest = 0;
+  buf_overlap = NULL;
+  maxoverlap = 0;
+
+  exchange_index = exchange_leave = NULL;
+  maxexchange_index = 0;
+  buf_thread = NULL;
+  maxbuf_thread = NULL;
+  offset_thread = NULL;
+  nbuf_thread = 0;
 
   // use of OpenMP threads
   // query OpenMP for number of threads/process set by user at run-time
@@ -182,6 +197,14 @@ Comm::~Comm()
 
   memory->destroy(buf_send);
   memory->destroy(buf_recv);
+  memory->destroy(buf_overlap);
+
+  memory->destroy(exchange_index);
+  memory->destroy(exchange_leave);
+  for (int i = 0; i < nbuf_thread; i++) memory->destroy(buf_thread[i]);
+  delete [] buf_thread;
+  delete [] maxbuf_thread;
+  delete [] offset_thread;
 }
 
 /* ----------------------------------------------------------------------
@@ -814,6 +837,153 @@ void Comm::forward_comm(int dummy)
   }
 }
 
+/* ----------------------------------------------------------------------
+   nonblocking forward communication of atom coords
+   same result as forward_comm(), but the swaps of the first stage are
+     only posted, so the caller can compute forces on atoms without
+     ghost neighbors before calling forward_comm_finish()
+   forward_comm_progress() can be called in between to push later stages
+------------------------------------------------------------------------- */
+
+void Comm::forward_comm_start()
+{
+  // one buffer holds send and recv data of both swaps of a stage
+
+  int smax = 0, rmax = 0;
+  for (int iswap = 0; iswap < nswap; iswap++) {
+    smax = MAX(smax,sendnum[iswap]);
+    rmax = MAX(rmax,recvnum[iswap]);
+  }
+  overlap_send = smax*size_forward;
+  overlap_recv = rmax*size_forward;
+  if (2*(overlap_send+overlap_recv) > maxoverlap) {
+    maxoverlap = static_cast<int> (BUFFACTOR * 2*(overlap_send+overlap_recv));
+    memory->destroy(buf_overlap);
+    memory->create(buf_overlap,maxoverlap,"comm:buf_overlap");
+  }
+
+  overlap_stage = 0;
+  forward_comm_post(0);
+}
+
+/* ----------------------------------------------------------------------
+   complete all stages whose messages have arrived, post the next ones
+   return 1 if the forward comm is complete
+------------------------------------------------------------------------- */
+
+int Comm::forward_comm_progress()
+{
+  MPI_Status status[4];
+  int flag;
+  int nstage = (nswap+1)/2;
+
+  while (overlap_stage < nstage) {
+    if (overlap_nrequest) {
+      MPI_Testall(overlap_nrequest,overlap_request,&flag,status);
+      if (!flag) return 0;
+    }
+    forward_comm_unpack(overlap_stage);
+    if (++overlap_stage < nstage) forward_comm_post(overlap_stage);
+  }
+  return 1;
+}
+
+/* ----------------------------------------------------------------------
+   wait for all remaining stages of the nonblocking forward comm
+------------------------------------------------------------------------- */
+
+void Comm::forward_comm_finish()
+{
+  MPI_Status status[4];
+  int nstage = (nswap+1)/2;
+
+  while (overlap_stage < nstage) {
+    if (overlap_nrequest)
+      MPI_Waitall(overlap_nrequest,overlap_request,status);
+    forward_comm_unpack(overlap_stage);
+    if (++overlap_stage < nstage) forward_comm_post(overlap_stage);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   post recvs and sends of both swaps of a stage
+   swaps with self are done right away
+------------------------------------------------------------------------- */
+
+void Comm::forward_comm_post(int istage)
+{
+  int n,k;
+  AtomVec *avec = atom->avec;
+  double **x = atom->x;
+  double *buf;
+
+  overlap_nrequest = 0;
+
+  for (k = 0; k < 2; k++) {
+    int iswap = 2*istage + k;
+    if (iswap >= nswap) break;
+    double *bufsend = buf_overlap + k*overlap_send;
+    double *bufrecv = buf_overlap + 2*overlap_send + k*overlap_recv;
+
+    if (sendproc[iswap] != me) {
+      if (size_forward_recv[iswap]) {
+        if (comm_x_only) buf = x[firstrecv[iswap]];
+        else buf = bufrecv;
+        MPI_Irecv(buf,size_forward_recv[iswap],MPI_DOUBLE,recvproc[iswap],
+                  TAG_OVERLAP+k,world,&overlap_request[overlap_nrequest++]);
+      }
+      if (ghost_velocity)
+        n = avec->pack_comm_vel(sendnum[iswap],sendlist[iswap],
+                                bufsend,pbc_flag[iswap],pbc[iswap]);
+      else
+        n = avec->pack_comm(sendnum[iswap],sendlist[iswap],
+                            bufsend,pbc_flag[iswap],pbc[iswap]);
+      if (n)
+        MPI_Isend(bufsend,n,MPI_DOUBLE,sendproc[iswap],
+                  TAG_OVERLAP+k,world,&overlap_request[overlap_nrequest++]);
+
+    } else {
+      if (comm_x_only) {
+        if (sendnum[iswap])
+          n = avec->pack_comm(sendnum[iswap],sendlist[iswap],
+                              x[firstrecv[iswap]],pbc_flag[iswap],
+                              pbc[iswap]);
+      } else if (ghost_velocity) {
+        n = avec->pack_comm_vel(sendnum[iswap],sendlist[iswap],
+                                bufsend,pbc_flag[iswap],pbc[iswap]);
+        avec->unpack_comm_vel(recvnum[iswap],firstrecv[iswap],bufsend);
+      } else {
+        n = avec->pack_comm(sendnum[iswap],sendlist[iswap],
+                            bufsend,pbc_flag[iswap],pbc[iswap]);
+        avec->unpack_comm(recvnum[iswap],firstrecv[iswap],bufsend);
+      }
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   unpack recvd data of both swaps of a completed stage
+   if comm_x_only set, data was received directly into x
+------------------------------------------------------------------------- */
+
+void Comm::forward_comm_unpack(int istage)
+{
+  AtomVec *avec = atom->avec;
+
+  if (comm_x_only) return;
+
+  for (int k = 0; k < 2; k++) {
+    int iswap = 2*istage + k;
+    if (iswap >= nswap) break;
+    if (sendproc[iswap] == me) continue;
+    double *bufrecv = buf_overlap + 2*overlap_send + k*overlap_recv;
+    if (ghost_velocity)
+      avec->unpack_comm_vel(recvnum[iswap],firstrecv[iswap],bufrecv);
+    else
+      avec->unpack_comm(recvnum[iswap],firstrecv[iswap],bufrecv);
+  }
+}
+
 /* ----------------------------------------------------------------------
    reverse communication of forces on atoms every timestep
    other per-atom attributes may also be sent via pack/unpack routines
@@ -930,15 +1100,22 @@ void Comm::exchange()
     nlocal = atom->nlocal;
     i = nsend = 0;
 
-    while (i < nlocal) {
-      if (x[i][dim] < lo || x[i][dim] >= hi) {
-        if (nsend > maxsend) grow_send(nsend,1);
-        nsend += avec->pack_exchange(i,&buf_send[nsend]);
-        avec->copy(nlocal-1,i,1);
-        nlocal--;
-      } else i++;
+#if defined(_OPENMP)
+    if (nthreads > 1 && avec->threadsafe_exchange && nlocal > OMP_MIN_ATOMS)
+      nsend = exchange_pack_threaded(dim,lo,hi);
+    else
+#endif
+    {
+      while (i < nlocal) {
+        if (x[i][dim] < lo || x[i][dim] >= hi) {
+          if (nsend > maxsend) grow_send(nsend,1);
+          nsend += avec->pack_exchange(i,&buf_send[nsend]);
+          avec->copy(nlocal-1,i,1);
+          nlocal--;
+        } else i++;
+      }
+      atom->nlocal = nlocal;
     }
-    atom->nlocal = nlocal;
 
     // send/recv atoms in both directions
     // if 1 proc in dimension, no send/recv, set recv buf to send buf
@@ -1087,13 +1264,8 @@ void Comm::borders()
                   }
             }
             else //NP standard case
-            {
-                for (i = nfirst; i < nlast; i++)
-                  if (decide(i,dim,lo,hi,ineed)) {
-                    if (nsend == maxsendlist[iswap]) grow_list(iswap,nsend);
-                    sendlist[iswap][nsend++] = i;
-                  }
-            }
+                nsend = border_select(iswap,nfirst,nlast,nsend,
+                                      dim,lo,hi,ineed);
           } else {
             for (i = nfirst; i < nlast; i++) {
               itype = type[i];
@@ -1124,16 +1296,9 @@ void Comm::borders()
             else //NP standard case
             {
                 ngroup = atom->nfirst;
-                for (i = 0; i < ngroup; i++)
-                  if (decide(i,dim,lo,hi,ineed)) {
-                    if (nsend == maxsendlist[iswap]) grow_list(iswap,nsend);
-                    sendlist[iswap][nsend++] = i;
-                  }
-                for (i = atom->nlocal; i < nlast; i++)
-                  if (decide(i,dim,lo,hi,ineed)) {
-                    if (nsend == maxsendlist[iswap]) grow_list(iswap,nsend);
-                    sendlist[iswap][nsend++] = i;
-                  }
+                nsend = border_select(iswap,0,ngroup,nsend,dim,lo,hi,ineed);
+                nsend = border_select(iswap,atom->nlocal,nlast,nsend,
+                                      dim,lo,hi,ineed);
             }
           } else {
             ngroup = atom->nfirst;
@@ -1749,6 +1914,182 @@ int Comm::read_lines_from_file_universe(FILE *fp, int nlines, int maxline,
   return 0;
 }
 
+/* ----------------------------------------------------------------------
+   append atoms ifrom to ito-1 that are border atoms of swap iswap
+   to its sendlist, which already holds nsend atoms
+   return new # of atoms in sendlist
+   threaded via count, prefix sum, fill so the list is in index order
+     independent of the # of threads
+------------------------------------------------------------------------- */
+
+int Comm::border_select(int iswap, int ifrom, int ito, int nsend,
+                        int dim, double lo, double hi, int ineed)
+{
+#if defined(_OPENMP)
+  if (nthreads > 1 && ito-ifrom > OMP_MIN_ATOMS) {
+    grow_thread();
+    int *offset = offset_thread;
+    int ntotal = nsend;
+
+    #pragma omp parallel num_threads(nthreads)
+    {
+      const int tid = omp_get_thread_num();
+      const int nthr = omp_get_num_threads();
+      const int chunk = (ito-ifrom + nthr-1) / nthr;
+      const int cfrom = MIN(ifrom + tid*chunk,ito);
+      const int cto = MIN(cfrom + chunk,ito);
+
+      int n = 0;
+      for (int i = cfrom; i < cto; i++)
+        if (decide(i,dim,lo,hi,ineed)) n++;
+      offset[tid+1] = n;
+
+      #pragma omp barrier
+      #pragma omp single
+      {
+        offset[0] = nsend;
+        for (int t = 0; t < nthr; t++) offset[t+1] += offset[t];
+        ntotal = offset[nthr];
+        if (ntotal > maxsendlist[iswap]) grow_list(iswap,ntotal);
+      }
+
+      int *list = sendlist[iswap];
+      n = offset[tid];
+      for (int i = cfrom; i < cto; i++)
+        if (decide(i,dim,lo,hi,ineed)) list[n++] = i;
+    }
+
+    return ntotal;
+  }
+#endif
+
+  for (int i = ifrom; i < ito; i++)
+    if (decide(i,dim,lo,hi,ineed)) {
+      if (nsend == maxsendlist[iswap]) grow_list(iswap,nsend);
+      sendlist[iswap][nsend++] = i;
+    }
+  return nsend;
+}
+
+/* ----------------------------------------------------------------------
+   threaded version of the exchange() pack loop for one dim
+   the serial loop is replayed without packing to get the leaving atoms
+     in the order the serial loop packs them, i.e. with atoms filled in
+     from the end packed when their new slot is visited
+   threads then pack contiguous chunks of that list into their own buffer,
+     buffers are concatenated in thread order, so buf_send and the new
+     local order are the same as for the serial loop
+   only called if AtomVec::pack_exchange() is thread-safe
+   return # of datums in buf_send, atom->nlocal is reset
+------------------------------------------------------------------------- */
+
+int Comm::exchange_pack_threaded(int dim, double lo, double hi)
+{
+#if defined(_OPENMP)
+  AtomVec *avec = atom->avec;
+  double **x = atom->x;
+  int nlocal = atom->nlocal;
+  int i,n;
+
+  if (nlocal > maxexchange_index) {
+    maxexchange_index = static_cast<int> (BUFFACTOR * nlocal);
+    memory->destroy(exchange_index);
+    memory->destroy(exchange_leave);
+    memory->create(exchange_index,maxexchange_index,"comm:exchange_index");
+    memory->create(exchange_leave,maxexchange_index,"comm:exchange_leave");
+  }
+  grow_thread();
+
+  // exchange_index = atom that sits in a slot during the serial loop
+
+  int *index = exchange_index;
+  int *leave = exchange_leave;
+  int nleave = 0;
+
+  for (i = 0; i < nlocal; i++) index[i] = i;
+  i = 0;
+  n = nlocal;
+  while (i < n) {
+    const int j = index[i];
+    if (x[j][dim] < lo || x[j][dim] >= hi) {
+      leave[nleave++] = j;
+      index[i] = index[n-1];
+      n--;
+    } else i++;
+  }
+
+  int *offset = offset_thread;
+  for (int t = 0; t <= nthreads; t++) offset[t] = 0;
+
+  #pragma omp parallel num_threads(nthreads)
+  {
+    const int tid = omp_get_thread_num();
+    const int nthr = omp_get_num_threads();
+    const int chunk = (nleave + nthr-1) / nthr;
+    const int kfrom = MIN(tid*chunk,nleave);
+    const int kto = MIN(kfrom + chunk,nleave);
+
+    int m = 0;
+    for (int k = kfrom; k < kto; k++) {
+      if (m + bufextra > maxbuf_thread[tid]) {
+        maxbuf_thread[tid] = static_cast<int> (BUFFACTOR * (m + bufextra));
+        memory->grow(buf_thread[tid],maxbuf_thread[tid],"comm:buf_thread");
+      }
+      m += avec->pack_exchange(leave[k],&buf_thread[tid][m]);
+    }
+    offset[tid+1] = m;
+  }
+
+  for (int t = 0; t < nthreads; t++) offset[t+1] += offset[t];
+  int nsend = offset[nthreads];
+  if (nsend > maxsend) grow_send(nsend,0);
+
+  #pragma omp parallel for num_threads(nthreads)
+  for (int t = 0; t < nthreads; t++)
+    if (offset[t+1] > offset[t])
+      memcpy(&buf_send[offset[t]],buf_thread[t],
+             (offset[t+1]-offset[t])*sizeof(double));
+
+  // remove leaving atoms as the serial loop does
+
+  i = 0;
+  while (i < nlocal) {
+    if (x[i][dim] < lo || x[i][dim] >= hi) {
+      avec->copy(nlocal-1,i,1);
+      nlocal--;
+    } else i++;
+  }
+  atom->nlocal = nlocal;
+
+  return nsend;
+#else
+  return 0;
+#endif
+}
+
+/* ----------------------------------------------------------------------
+   allocate per-thread exchange buffers and the per-thread offsets used
+     by border_select() and exchange_pack_threaded()
+------------------------------------------------------------------------- */
+
+void Comm::grow_thread()
+{
+  if (nbuf_thread >= nthreads) return;
+
+  for (int t = 0; t < nbuf_thread; t++) memory->destroy(buf_thread[t]);
+  delete [] buf_thread;
+  delete [] maxbuf_thread;
+  delete [] offset_thread;
+  nbuf_thread = nthreads;
+  buf_thread = new double*[nbuf_thread];
+  maxbuf_thread = new int[nbuf_thread];
+  offset_thread = new int[nbuf_thread+1];
+  for (int t = 0; t < nbuf_thread; t++) {
+    buf_thread[t] = NULL;
+    maxbuf_thread[t] = 0;
+  }
+}
+
 /* ----------------------------------------------------------------------
    realloc the size of the send buffer as needed with BUFFACTOR and bufextra
    if flag = 1, realloc
@@ -1906,6 +2247,12 @@ void Comm::set(int narg, char **arg)
       else if (strcmp(arg[iarg+1],"no") == 0) ghost_velocity = 0;
       else error->all(FLERR,"Illegal communicate command");
       iarg += 2;
+    } else if (strcmp(arg[iarg],"overlap") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal communicate command");
+      if (strcmp(arg[iarg+1],"yes") == 0) overlap_flag = 1;
+      else if (strcmp(arg[iarg+1],"no") == 0) overlap_flag = 0;
+      else error->all(FLERR,"Illegal communicate command");
+      iarg += 2;
     } else error->all(FLERR,"Illegal communicate command");
   }
 }
@@ -2056,5 +2403,6 @@ bigint Comm::memory_usage()
     bytes += memory->usage(sendlist[i],maxsendlist[i]);
   bytes += memory->usage(buf_send,maxsend+bufextra);
   bytes += memory->usage(buf_recv,maxrecv);
+  bytes += memory->usage(buf_overlap,maxoverlap);
   return bytes;
 }
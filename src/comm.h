@@ -36,6 +36,7 @@ class Comm : protected Pointers {
   int myloc[3];                     // which proc I am in each dim
   int procneigh[3][2];              // my 6 neighboring procs, 0/1 = left/right
   int ghost_velocity;               // 1 if ghost atoms have velocity, 0 if not
+  int overlap_flag;                 // 1 if forward comm may overlap pair forces
   int uniform;                      // 1 = equal subdomains, 0 = load-balanced
   double *xsplit,*ysplit,*zsplit;   // fractional (0-1) sub-domain sizes
   double cutghost[3];               // cutoffs used for acquiring ghost atoms
@@ -57,6 +58,9 @@ class Comm : protected Pointers {
   virtual void set_proc_grid(int outflag = 1); // setup 3d grid of procs
   virtual void setup();                       // setup 3d comm pattern
   virtual void forward_comm(int dummy = 0);   // forward comm of atom coords
+  virtual void forward_comm_start();          // post nonblocking forward comm
+  virtual int forward_comm_progress();        // advance it, 1 if complete
+  virtual void forward_comm_finish();         // wait until it is complete
   virtual void reverse_comm();                // reverse comm of forces
   virtual void exchange();                    // move atoms to new procs
   virtual void borders();                     // setup list of atoms to comm
@@ -130,10 +134,37 @@ class Comm : protected Pointers {
   int maxsend,maxrecv;              // current size of send/recv buffer
   int maxforward,maxreverse;        // max # of datums in forward/reverse comm
 
+  // nonblocking forward comm, swaps 2k and 2k+1 form stage k since
+  // they send from the same atoms, later stages send ghosts of earlier ones
+
+  int overlap_stage;                // stage in flight, nstage if complete
+  int overlap_nrequest;             // # of requests posted for this stage
+  MPI_Request overlap_request[4];   // recv and send of both swaps
+  double *buf_overlap;              // send and recv buffers of both swaps
+  int maxoverlap;                   // current size of buf_overlap
+  int overlap_send,overlap_recv;    // size of one send/recv buffer
+
   int maxexchange;                  // max # of datums/atom in exchange comm
   int bufextra;                     // extra space beyond maxsend in send buffer
 
+  // OpenMP threaded exchange, each thread packs a chunk of the leaving
+  // atoms into its own buffer
+
+  int *exchange_index;              // atom in each slot of the serial loop
+  int *exchange_leave;              // leaving atoms in serial pack order
+  int maxexchange_index;            // current size of exchange arrays
+  double **buf_thread;              // per-thread exchange send buffers
+  int *maxbuf_thread;               // current size of each thread buffer
+  int *offset_thread;               // per-thread offsets, nbuf_thread+1
+  int nbuf_thread;                  // # of thread buffers allocated
+
   int updown(int, int, int, double, int, double *);
+  void forward_comm_post(int);              // post swaps of one stage
+  void forward_comm_unpack(int);            // unpack swaps of one stage
+  int border_select(int, int, int, int,     // add border atoms of a range
+                    int, double, double, int);  // to a sendlist
+  int exchange_pack_threaded(int, double, double);  // pack, remove leaving
+  void grow_thread();                       // allocate per-thread buffers
                                             // compare cutoff to procs
   virtual void grow_send(int,int);          // reallocate send buffer
   virtual void grow_recv(int);              // free/allocate recv buffer
@@ -0,0 +1,266 @@
+/* ----------------------------------------------------------------------
+   LIGGGHTS - LAMMPS Improved for General Granular and Granular Heat
+   Transfer Simulations
+
+   LIGGGHTS is part of the CFDEMproject
+   www.liggghts.com | www.cfdem.com
+
+   Christoph Kloss, christoph.kloss@cfdem.com
+   Copyright 2009-2012 JKU Linz
+   Copyright 2012-     DCS Computing GmbH, Linz
+
+   LIGGGHTS is based on LAMMPS
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   This software is distributed under the GNU General Public License.
+
+   See the README file in the top-level directory.
+------------------------------------------------------------------------- */
+
+#include <math.h>
+#include "contact_batch.h"
+#include "atom.h"
+#include "pair_gran.h"
+#include "neighbor.h"
+#include "neigh_list.h"
+
+using namespace LAMMPS_NS;
+using namespace LIGGGHTS::PairStyles;
+
+/* ---------------------------------------------------------------------- */
+
+void ContactBatch::begin(Atom *atom, PairGran *pg, bool keep_non_contacting,
+                         bool touched_only, int iifrom, int iito)
+{
+  atom_ = atom;
+  pg_ = pg;
+  keep_non_contacting_ = keep_non_contacting;
+  touched_only_ = touched_only;
+  ii_ = iifrom;
+  iito_ = iito;
+  jj_ = 0;
+  n = 0;
+  ncontact = 0;
+}
+
+/* ----------------------------------------------------------------------
+   continue the walk over the neighbor list where the last batch ended
+   pairs out of contact are dropped right after the distance check
+   unless one of the contact models handles noCollision(); with
+   touched_only, those whose contact flags are all clear are dropped too,
+   as there is nothing left to reset for them
+------------------------------------------------------------------------- */
+
+bool ContactBatch::gather()
+{
+  double **x = atom_->x;
+  double *radius = atom_->radius;
+
+  NeighList * const list = pg_->list;
+  int * const ilist = list->ilist;
+  int * const numneigh = list->numneigh;
+  int ** const firstneigh = list->firstneigh;
+  int ** const firsttouch = pg_->listgranhistory ? pg_->listgranhistory->firstneigh : NULL;
+  double ** const firstshear = pg_->listgranhistory ? pg_->listgranhistory->firstdouble : NULL;
+  const int dnum = pg_->dnum();
+  const bool keep_non_contacting = keep_non_contacting_;
+  const bool touched_only = touched_only_;
+
+  // the walk runs on local copies, stores into the batch arrays could
+  // otherwise alias the members and force a reload of them every pair
+
+  int nb = 0;
+  int nc = 0;
+  int iw = ii_;
+  int jw = jj_;
+
+  for (; iw < iito_; iw++) {
+    const int ii = ilist[iw];
+    const double xtmp = x[ii][0];
+    const double ytmp = x[ii][1];
+    const double ztmp = x[ii][2];
+    const double radi = radius[ii];
+    int * const itouch = firsttouch ? firsttouch[ii] : NULL;
+    double * const allshear = firstshear ? firstshear[ii] : NULL;
+    int * const jlist = firstneigh[ii];
+    const int jnum = numneigh[ii];
+
+    for (; jw < jnum; jw++) {
+      const int jj = jlist[jw] & NEIGHMASK;
+
+      const double dx = xtmp - x[jj][0];
+      const double dy = ytmp - x[jj][1];
+      const double dz = ztmp - x[jj][2];
+      const double rr = dx * dx + dy * dy + dz * dz;
+      const double rs = radi + radius[jj];
+      const int in_contact = rr < rs * rs;
+
+      if (!in_contact) {
+        if (!keep_non_contacting)
+          continue;
+        if (touched_only && itouch && !itouch[jw])
+          continue;
+      }
+
+      i[nb] = ii;
+      j[nb] = jj;
+      contact[nb] = in_contact;
+      touch[nb] = itouch ? &itouch[jw] : NULL;
+      contact_history[nb] = allshear ? &allshear[dnum*jw] : NULL;
+      delx[nb] = dx;
+      dely[nb] = dy;
+      delz[nb] = dz;
+      rsq[nb] = rr;
+      radsum[nb] = rs;
+      nc += in_contact;
+
+      if (++nb == SIZE) {
+        ii_ = iw;
+        jj_ = jw + 1;
+        n = nb;
+        ncontact = nc;
+        return true;
+      }
+    }
+    jw = 0;
+  }
+
+  ii_ = iw;
+  jj_ = 0;
+  n = nb;
+  ncontact = nc;
+  return nb > 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void ContactBatch::evaluate()
+{
+  double *rmass = atom_->rmass;
+  double *mass = atom_->mass;
+  int *type = atom_->type;
+  int *mask = atom_->mask;
+  const int freeze_group_bit = pg_->freeze_group_bit();
+
+  // geometry, unit stride and branch free so the compiler can vectorize it
+
+  for (int k = 0; k < n; k++) {
+    r[k] = sqrt(rsq[k]);
+    rinv[k] = 1.0 / r[k];
+    enx[k] = delx[k] * rinv[k];
+    eny[k] = dely[k] * rinv[k];
+    enz[k] = delz[k] * rinv[k];
+  }
+
+  // masses
+
+  if (rmass) {
+    for (int k = 0; k < n; k++) {
+      mi[k] = rmass[i[k]];
+      mj[k] = rmass[j[k]];
+    }
+  } else {
+    for (int k = 0; k < n; k++) {
+      mi[k] = mass[type[i[k]]];
+      mj[k] = mass[type[j[k]]];
+    }
+  }
+
+  // meff = effective mass of pair of particles
+  // if I or J part of rigid body, use body mass
+  // if I or J is frozen, meff is other particle
+
+  if (pg_->fr_pair()) {
+    const double * const mass_rigid = pg_->mr_pair();
+    for (int k = 0; k < n; k++) {
+      if (mass_rigid[i[k]] > 0.0) mi[k] = mass_rigid[i[k]];
+      if (mass_rigid[j[k]] > 0.0) mj[k] = mass_rigid[j[k]];
+    }
+  }
+
+  for (int k = 0; k < n; k++)
+    meff[k] = mi[k] * mj[k] / (mi[k] + mj[k]);
+
+  if (freeze_group_bit) {
+    for (int k = 0; k < n; k++) {
+      if (mask[i[k]] & freeze_group_bit)
+        meff[k] = mj[k];
+      if (mask[j[k]] & freeze_group_bit)
+        meff[k] = mi[k];
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   pairs in contact are moved to the front in gather order, so forces
+   are still summed in the same order as in the pair-by-pair pass
+   called before evaluate(), so nothing is computed for the dropped pairs
+------------------------------------------------------------------------- */
+
+void ContactBatch::compact()
+{
+  const int nb = n;
+  int nc = 0;
+
+  for (int k = 0; k < nb; k++) {
+    if (!contact[k])
+      continue;
+
+    if (nc != k) {
+      i[nc] = i[k];
+      j[nc] = j[k];
+      contact[nc] = contact[k];
+      touch[nc] = touch[k];
+      contact_history[nc] = contact_history[k];
+      delx[nc] = delx[k];
+      dely[nc] = dely[k];
+      delz[nc] = delz[k];
+      rsq[nc] = rsq[k];
+      radsum[nc] = radsum[k];
+    }
+    nc++;
+  }
+
+  n = nc;
+  ncontact = nc;
+}
+
+/* ----------------------------------------------------------------------
+   force and torque are reset, as ForceData::reset() does for one pair
+------------------------------------------------------------------------- */
+
+void ContactBatch::load()
+{
+  double **v = atom_->v;
+  double **omega = atom_->omega;
+  double *radius = atom_->radius;
+  int *type = atom_->type;
+  const int nb = n;
+
+  for (int k = 0; k < nb; k++) {
+    const int ii = i[k];
+    const int jj = j[k];
+
+    radi[k] = radius[ii];
+    radj[k] = radius[jj];
+    itype[k] = type[ii];
+    jtype[k] = type[jj];
+    vrx[k] = v[ii][0] - v[jj][0];
+    vry[k] = v[ii][1] - v[jj][1];
+    vrz[k] = v[ii][2] - v[jj][2];
+    omegaix[k] = omega[ii][0];
+    omegaiy[k] = omega[ii][1];
+    omegaiz[k] = omega[ii][2];
+    omegajx[k] = omega[jj][0];
+    omegajy[k] = omega[jj][1];
+    omegajz[k] = omega[jj][2];
+  }
+
+  for (int k = 0; k < nb; k++) {
+    fx[k] = fy[k] = fz[k] = 0.0;
+    torqueix[k] = torqueiy[k] = torqueiz[k] = 0.0;
+    torquejx[k] = torquejy[k] = torquejz[k] = 0.0;
+  }
+}
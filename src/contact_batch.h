@@ -0,0 +1,151 @@
+/* ----------------------------------------------------------------------
+   LIGGGHTS - LAMMPS Improved for General Granular and Granular Heat
+   Transfer Simulations
+
+   LIGGGHTS is part of the CFDEMproject
+   www.liggghts.com | www.cfdem.com
+
+   Christoph Kloss, christoph.kloss@cfdem.com
+   Copyright 2009-2012 JKU Linz
+   Copyright 2012-     DCS Computing GmbH, Linz
+
+   LIGGGHTS is based on LAMMPS
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   This software is distributed under the GNU General Public License.
+
+   See the README file in the top-level directory.
+------------------------------------------------------------------------- */
+
+#ifndef LMP_CONTACT_BATCH_H
+#define LMP_CONTACT_BATCH_H
+
+namespace LAMMPS_NS {
+  class Atom;
+  class PairGran;
+}
+
+namespace LIGGGHTS {
+
+namespace PairStyles {
+
+/* ----------------------------------------------------------------------
+   structure-of-arrays staging area for the batched pair pass:
+   candidate pairs are gathered here in neighbor list order, the geometric
+   part of the contact (distance, normal, effective mass) is evaluated for
+   the whole batch in unit-stride loops, then the contact models are
+   applied pair by pair by Granular<ContactModel>
+
+   nothing in here depends on the contact model, so it is compiled once
+   instead of once per model combination
+------------------------------------------------------------------------- */
+
+class ContactBatch {
+ public:
+  static const int SIZE = 256;
+
+  // start a pass over entries iifrom to iito-1 of the neighbor list of pg
+  // keep_non_contacting: also gather pairs that are out of contact
+  // touched_only: of those, only the ones with contact flags still set
+  void begin(LAMMPS_NS::Atom *atom, LAMMPS_NS::PairGran *pg, bool keep_non_contacting,
+             bool touched_only, int iifrom, int iito);
+
+  // fill the next batch, returns false if the list is exhausted
+  bool gather();
+
+  // distances, normals and masses for all pairs of the batch
+  void evaluate();
+
+  // drop the pairs out of contact, keeping gather order
+  void compact();
+
+  // radii, types and velocities of all pairs of the batch, reset forces
+  void load();
+
+  int n;
+  int ncontact;       // # of pairs of the batch in contact
+  int i[SIZE];
+  int j[SIZE];
+  int contact[SIZE];
+  int * touch[SIZE];
+  double * contact_history[SIZE];
+
+  double delx[SIZE];
+  double dely[SIZE];
+  double delz[SIZE];
+  double rsq[SIZE];
+  double radsum[SIZE];
+
+  double r[SIZE];
+  double rinv[SIZE];
+  double enx[SIZE];
+  double eny[SIZE];
+  double enz[SIZE];
+  double mi[SIZE];
+  double mj[SIZE];
+  double meff[SIZE];
+
+  // per-atom data, filled by load()
+
+  double radi[SIZE];
+  double radj[SIZE];
+  int itype[SIZE];
+  int jtype[SIZE];
+  double vrx[SIZE];   // v_i - v_j
+  double vry[SIZE];
+  double vrz[SIZE];
+  double omegaix[SIZE];
+  double omegaiy[SIZE];
+  double omegaiz[SIZE];
+  double omegajx[SIZE];
+  double omegajy[SIZE];
+  double omegajz[SIZE];
+
+  // filled by the batched contact models, same meaning as in CollisionData
+
+  double vn[SIZE];
+  double deltan[SIZE];
+  double cri[SIZE];
+  double crj[SIZE];
+  double wr1[SIZE];
+  double wr2[SIZE];
+  double wr3[SIZE];
+  double vtr1[SIZE];
+  double vtr2[SIZE];
+  double vtr3[SIZE];
+  double kn[SIZE];
+  double kt[SIZE];
+  double gamman[SIZE];
+  double gammat[SIZE];
+  double Fn[SIZE];
+
+  // force and torque on i, the force on j is -f
+  double fx[SIZE];
+  double fy[SIZE];
+  double fz[SIZE];
+  double torqueix[SIZE];
+  double torqueiy[SIZE];
+  double torqueiz[SIZE];
+  double torquejx[SIZE];
+  double torquejy[SIZE];
+  double torquejz[SIZE];
+
+ private:
+  LAMMPS_NS::Atom *atom_;
+  LAMMPS_NS::PairGran *pg_;
+  bool keep_non_contacting_;
+  bool touched_only_;
+
+  // position in the neighbor list and end of the pass
+  int ii_;
+  int jj_;
+  int iito_;
+};
+
+}
+
+}
+
+#endif
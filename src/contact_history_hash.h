@@ -0,0 +1,152 @@
+/* ----------------------------------------------------------------------
+   LIGGGHTS - LAMMPS Improved for General Granular and Granular Heat
+   Transfer Simulations
+
+   LIGGGHTS is part of the CFDEMproject
+   www.liggghts.com | www.cfdem.com
+
+   Christoph Kloss, christoph.kloss@cfdem.com
+   Copyright 2009-2012 JKU Linz
+   Copyright 2012-     DCS Computing GmbH, Linz
+
+   LIGGGHTS is based on LAMMPS
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   This software is distributed under the GNU General Public License.
+
+   See the README file in the top-level directory.
+------------------------------------------------------------------------- */
+
+/* ----------------------------------------------------------------------
+ContactHistoryHash = open addressing hash table mapping a pair key
+  (owner, partner tag) to the slot of the partner in the owner's
+  contact history chunk
+  keys and slots are stored in two flat arrays, linear probing
+  clear() is O(1): slots are tagged with a stamp, bumping the stamp
+  invalidates all entries without touching memory
+usage:
+  clear(), reserve(N), insert(key,slot) N times, find(key)
+  find() returns the slot or -1 if key not present
+  reserve() and insert() grow the table so the load is at most 1/2
+------------------------------------------------------------------------- */
+
+#ifndef LMP_CONTACT_HISTORY_HASH_H
+#define LMP_CONTACT_HISTORY_HASH_H
+
+#include <algorithm>
+#include <vector>
+#include <stdint.h>
+
+namespace LAMMPS_NS {
+
+class ContactHistoryHash {
+ public:
+  ContactHistoryHash() :
+    mask_(0),
+    nstored_(0),
+    stamp_(1)
+  {}
+
+  static inline uint64_t key(int owner, int partner)
+  { return (static_cast<uint64_t>(static_cast<uint32_t>(owner)) << 32) | static_cast<uint32_t>(partner); }
+
+  inline void clear()
+  {
+    nstored_ = 0;
+    if(++stamp_ == 0)
+    {
+      // stamp wrapped around, have to wipe table
+      std::fill(stamps_.begin(),stamps_.end(),0u);
+      stamp_ = 1;
+    }
+  }
+
+  inline void reserve(int n)
+  {
+    if(2*static_cast<size_t>(n) > stamps_.size())
+      rehash(2*static_cast<size_t>(n));
+  }
+
+  inline void insert(uint64_t k, int slot)
+  {
+    if(2*(nstored_+1) > stamps_.size())
+      rehash(2*(nstored_+1));
+
+    size_t h = hash(k);
+    while(stamps_[h] == stamp_ && keys_[h] != k)
+      h = (h+1) & mask_;
+
+    if(stamps_[h] != stamp_)
+    {
+      stamps_[h] = stamp_;
+      keys_[h] = k;
+      nstored_++;
+    }
+    slots_[h] = slot;
+  }
+
+  inline int find(uint64_t k) const
+  {
+    if(0 == nstored_)
+      return -1;
+
+    size_t h = hash(k);
+    while(stamps_[h] == stamp_)
+    {
+      if(keys_[h] == k)
+        return slots_[h];
+      h = (h+1) & mask_;
+    }
+    return -1;
+  }
+
+  inline int size() const
+  { return static_cast<int>(nstored_); }
+
+  inline double memory_usage() const
+  { return static_cast<double>(stamps_.capacity())*(sizeof(uint64_t)+sizeof(int)+sizeof(unsigned int)); }
+
+ private:
+
+  inline size_t hash(uint64_t k) const
+  { return static_cast<size_t>((k*0x9E3779B97F4A7C15ULL) >> 32) & mask_; }
+
+  void rehash(size_t nmin)
+  {
+    size_t capacity = 16;
+    while(capacity < nmin)
+      capacity <<= 1;
+
+    std::vector<uint64_t> keys_old;
+    std::vector<int> slots_old;
+    std::vector<unsigned int> stamps_old;
+    keys_old.swap(keys_);
+    slots_old.swap(slots_);
+    stamps_old.swap(stamps_);
+
+    keys_.resize(capacity);
+    slots_.resize(capacity);
+    stamps_.assign(capacity,0u);
+    mask_ = capacity-1;
+
+    const unsigned int stamp_old = stamp_;
+    stamp_ = 1;
+    nstored_ = 0;
+    for(size_t h = 0; h < stamps_old.size(); h++)
+      if(stamps_old[h] == stamp_old)
+        insert(keys_old[h],slots_old[h]);
+  }
+
+  std::vector<uint64_t> keys_;
+  std::vector<int> slots_;
+  std::vector<unsigned int> stamps_;
+  size_t mask_;
+  size_t nstored_;
+  unsigned int stamp_;
+};
+
+}
+
+#endif
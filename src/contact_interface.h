@@ -160,6 +160,18 @@ public:
   virtual int add_history_value(const std::string & name, const std::string & newtonflag) = 0;
 };
 
+// consumer of the contacts found by the granular pair pass,
+// see PairGran::register_contact_hook()
+class IContactHook {
+public:
+  // called before each regular force pass, return false to skip it
+  virtual bool begin_contact_pass() = 0;
+
+  // called for each pair in contact after the contact models,
+  // cdata holds geometry (r, delta, radi, radj, radsum), overlap and types
+  virtual void add_contact(const ContactModels::CollisionData & cdata) = 0;
+};
+
 }
 
 
@@ -36,6 +36,7 @@
 #include "pair_gran.h"
 #include "settings.h"
 #include "contact_model_constants.h"
+#include "contact_batch.h"
 
 using namespace LAMMPS_NS;
 
@@ -49,6 +50,10 @@ namespace ContactModels
   static const int CM_END_PASS              = 1 << 3;
   static const int CM_COLLISION             = 1 << 4;
   static const int CM_NO_COLLISION          = 1 << 5;
+  // collision() on a whole ContactBatch; in a batched pass noCollision() only
+  // gets the pair, its distance and contact history, must not apply forces
+  // and is skipped for pairs whose touch flags are all clear
+  static const int CM_COLLISION_BATCH       = 1 << 6;
 
   static const int TOUCH_NORMAL_MODEL      = 1 << 0;
   static const int TOUCH_COHESION_MODEL    = 1 << 1;
@@ -83,6 +88,27 @@ namespace ContactModels
 
   int64_t generate_gran_hashcode(int model, int tangential, int cohesion, int rolling, int surface);
 
+  // a model does not keep a combination from using the batched collision()
+  // if it handles it itself or does not take part in collisions at all
+  template<int M>
+  struct CollisionBatchable {
+    static const bool value = (M & CM_COLLISION_BATCH) || !(M & CM_COLLISION);
+  };
+
+  // batched collision() is only instantiated for combinations that have it
+  template<bool ENABLE>
+  struct BatchCollision {
+    template<typename Model>
+    static inline void collision(Model&, PairStyles::ContactBatch&, CollisionData&) {}
+  };
+
+  template<>
+  struct BatchCollision<true> {
+    template<typename Model>
+    static inline void collision(Model & model, PairStyles::ContactBatch & batch, CollisionData & cdata)
+    { model.collision(batch, cdata); }
+  };
+
   template<int Model>
   class SurfaceModel {
   public:
@@ -94,6 +120,7 @@ namespace ContactModels
     inline bool checkSurfaceIntersect(CollisionData & cdata);
     inline void collision(CollisionData & cdata, ForceData & i_forces, ForceData & j_forces);
     inline void noCollision(ContactData & cdata, ForceData & i_forces, ForceData & j_forces);
+    inline void statistics(double * values); // NSTATISTICS counters of the last pass
   };
 
   template<int Model>
@@ -169,6 +196,15 @@ namespace ContactModels
     static const int HANDLE_END_PASS = MASK & CM_END_PASS;
     static const int HANDLE_COLLISION = MASK & CM_COLLISION;
     static const int HANDLE_NO_COLLISION = MASK & CM_NO_COLLISION;
+    static const bool HANDLE_COLLISION_BATCH =
+        CollisionBatchable<SurfaceModel<Style::SURFACE>::MASK>::value &&
+        CollisionBatchable<NormalModel<Style::MODEL>::MASK>::value &&
+        CollisionBatchable<CohesionModel<Style::COHESION>::MASK>::value &&
+        CollisionBatchable<TangentialModel<Style::TANGENTIAL>::MASK>::value &&
+        CollisionBatchable<RollingModel<Style::ROLLING>::MASK>::value;
+
+    // counters of the last pass, e.g. of the contact detection
+    static const int NSTATISTICS = SurfaceModel<Style::SURFACE>::NSTATISTICS;
 
     ContactModel(LAMMPS * lmp, IContactHistorySetup * hsetup) :
       surfaceModel(lmp, hsetup),
@@ -228,6 +264,11 @@ namespace ContactModels
       return surfaceModel.checkSurfaceIntersect(cdata);
     }
 
+    inline void statistics(double * values)
+    {
+      surfaceModel.statistics(values);
+    }
+
     inline void collision(CollisionData & cdata, ForceData & i_forces, ForceData & j_forces)
     {
       surfaceModel.collision(cdata, i_forces, j_forces);
@@ -237,6 +278,17 @@ namespace ContactModels
       rollingModel.collision(cdata, i_forces, j_forces);
     }
 
+    // pairs in contact of a compacted batch, only valid if HANDLE_COLLISION_BATCH
+    // cdata only carries the flags of the pass (computeflag, shearupdate)
+    inline void collision(PairStyles::ContactBatch & batch, CollisionData & cdata)
+    {
+      BatchCollision<HANDLE_COLLISION_BATCH && (SurfaceModel<Style::SURFACE>::MASK & CM_COLLISION)>::collision(surfaceModel, batch, cdata);
+      BatchCollision<HANDLE_COLLISION_BATCH && (NormalModel<Style::MODEL>::MASK & CM_COLLISION)>::collision(normalModel, batch, cdata);
+      BatchCollision<HANDLE_COLLISION_BATCH && (CohesionModel<Style::COHESION>::MASK & CM_COLLISION)>::collision(cohesionModel, batch, cdata);
+      BatchCollision<HANDLE_COLLISION_BATCH && (TangentialModel<Style::TANGENTIAL>::MASK & CM_COLLISION)>::collision(tangentialModel, batch, cdata);
+      BatchCollision<HANDLE_COLLISION_BATCH && (RollingModel<Style::ROLLING>::MASK & CM_COLLISION)>::collision(rollingModel, batch, cdata);
+    }
+
     inline void noCollision(ContactData & cdata, ForceData & i_forces, ForceData & j_forces)
     {
       surfaceModel.noCollision(cdata, i_forces, j_forces);
@@ -16,6 +16,8 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
+#include <atomic>
+#include <thread>
 #include "dump.h"
 #include "atom.h"
 #include "irregular.h"
@@ -39,6 +41,30 @@ Dump *Dump::dumpptr;
 
 enum{ASCEND,DESCEND};
 
+namespace LAMMPS_NS {
+
+/* ----------------------------------------------------------------------
+   background thread that formats and writes one snapshot of a Dump
+   the thread does no MPI, so any MPI thread level is sufficient
+------------------------------------------------------------------------- */
+
+class DumpWriter {
+ public:
+  DumpWriter(Dump *dump) : done(0), thread(&DumpWriter::run,this,dump) {}
+
+  std::atomic<int> done;
+  std::thread thread;
+
+ private:
+  void run(Dump *dump)
+  {
+    dump->async_write();
+    done = 1;
+  }
+};
+
+}
+
 /* ---------------------------------------------------------------------- */
 
 Dump::Dump(LAMMPS *lmp, int narg, char **arg) : Pointers(lmp)
@@ -83,6 +109,17 @@ Dump::Dump(LAMMPS *lmp, int narg, char **arg) : Pointers(lmp)
   maxsbuf = 0;
   sbuf = NULL;
 
+  async_flag = 0;
+  async_allow = 1;
+  async_stall = 0.0;
+  async_nwrite = async_nstall = 0;
+  writer = NULL;
+  async_error = NULL;
+  async_cur = 0;
+  stagebuf[0] = stagebuf[1] = NULL;
+  maxstage[0] = maxstage[1] = 0;
+  stagelines[0] = stagelines[1] = NULL;
+
   // parse filename for special syntax
   // if contains '%', write one file per proc and replace % with proc-ID
   // if contains '*', write one file per timestep and replace * with timestep
@@ -129,6 +166,14 @@ Dump::Dump(LAMMPS *lmp, int narg, char **arg) : Pointers(lmp)
 
 Dump::~Dump()
 {
+  // derived classes are already destructed here,
+  // so the pending snapshot must have been written before, see Output
+
+  if (writer) {
+    writer->thread.join();
+    delete writer;
+  }
+
   delete [] id;
   delete [] style;
   delete [] filename;
@@ -148,6 +193,11 @@ Dump::~Dump()
 
   memory->destroy(sbuf);
 
+  for (int i = 0; i < 2; i++) {
+    memory->destroy(stagebuf[i]);
+    memory->destroy(stagelines[i]);
+  }
+
   if (multiproc) MPI_Comm_free(&clustercomm);
 
   // XTC style sets fp to NULL since it closes file in its destructor
@@ -165,6 +215,14 @@ Dump::~Dump()
 
 void Dump::init()
 {
+  // settings of the style must not change under a running writer
+
+  async_wait();
+  if (async_flag && !async_allow)
+    error->all(FLERR,"Dump_modify async yes not allowed for this style");
+  async_stall = 0.0;
+  async_nwrite = async_nstall = 0;
+
   init_style();
 
   if (!sort_flag) {
@@ -259,30 +317,18 @@ int Dump::count()
 
 void Dump::write()
 {
+  if (async_flag) {
+    write_async();
+    return;
+  }
+
   // if file per timestep, open new file
 
   if (multifile) openfile();
 
   // simulation box bounds
 
-  if (domain->triclinic == 0) {
-    boxxlo = domain->boxlo[0];
-    boxxhi = domain->boxhi[0];
-    boxylo = domain->boxlo[1];
-    boxyhi = domain->boxhi[1];
-    boxzlo = domain->boxlo[2];
-    boxzhi = domain->boxhi[2];
-  } else {
-    boxxlo = domain->boxlo_bound[0];
-    boxxhi = domain->boxhi_bound[0];
-    boxylo = domain->boxlo_bound[1];
-    boxyhi = domain->boxhi_bound[1];
-    boxzlo = domain->boxlo_bound[2];
-    boxzhi = domain->boxhi_bound[2];
-    boxxy = domain->xy;
-    boxxz = domain->xz;
-    boxyz = domain->yz;
-  }
+  box_bounds();
 
   // nme = # of dump lines this proc contributes to dump
 
@@ -308,25 +354,9 @@ void Dump::write()
 
   if (filewriter) write_header(nheader);
 
-  // insure buf is sized for packing and communicating
-  // use nmax to insure filewriter proc can receive info from others
-  // limit nmax*size_one to int since used as arg in MPI calls
-
-  if (nmax > maxbuf) {
-    if ((bigint) nmax * size_one > MAXSMALLINT)
-      error->all(FLERR,"Too much per-proc info for dump");
-    maxbuf = nmax;
-    memory->destroy(buf);
-    memory->create(buf,maxbuf*size_one,"dump:buf");
-  }
-
-  // insure ids buffer is sized for sorting
+  // insure buf and ids are sized for packing, communicating and sorting
 
-  if (sort_flag && sortcol == 0 && nmax > maxids) {
-    maxids = nmax;
-    memory->destroy(ids);
-    memory->create(ids,maxids,"dump:ids");
-  }
+  grow_buf(nmax);
 
   // pack my data into buf
   // if sorting on IDs also request ID list from pack()
@@ -417,6 +447,224 @@ void Dump::write()
   }
 }
 
+/* ----------------------------------------------------------------------
+   asynchronous variant of write()
+   procs pack and send their data as usual, the filewriter proc stages
+     the data of its cluster and leaves formatting and writing to a
+     background thread, the simulation continues meanwhile
+   two staging buffers: the next snapshot is packed and gathered while
+     the writer still works on the previous one
+   if the writer falls behind, write_async() waits for it (backpressure),
+     the time waited is accumulated in async_stall
+------------------------------------------------------------------------- */
+
+void Dump::write_async()
+{
+  box_bounds();
+
+  nme = count();
+
+  bigint bnme = nme;
+  MPI_Allreduce(&bnme,&ntotal,1,MPI_LMP_BIGINT,MPI_SUM,world);
+
+  int nmax;
+  if (multiproc != nprocs) MPI_Allreduce(&nme,&nmax,1,MPI_INT,MPI_MAX,world);
+  else nmax = nme;
+
+  bigint nheader = ntotal;
+  if (multiproc)
+    MPI_Allreduce(&bnme,&nheader,1,MPI_LMP_BIGINT,MPI_SUM,clustercomm);
+
+  grow_buf(nmax);
+
+  if (sort_flag && sortcol == 0) pack(ids);
+  else pack(NULL);
+  if (sort_flag) sort();
+
+  // gather into the staging buffer the writer does not use
+  // data stays binary here, strings are formatted by the writer
+
+  const int s = 1 - async_cur;
+  int tmp,nlines;
+  MPI_Status status;
+  MPI_Request request;
+
+  if (filewriter) {
+    memory->grow(stagelines[s],nclusterprocs,"dump:stagelines");
+    bigint n = 0;
+    for (int iproc = 0; iproc < nclusterprocs; iproc++) {
+      if ((n + maxbuf) * size_one > MAXSMALLINT)
+        error->one(FLERR,"Too much per-proc info for dump");
+      if ((n + maxbuf) * size_one > maxstage[s]) {
+        maxstage[s] = (n + maxbuf) * size_one;
+        memory->grow(stagebuf[s],maxstage[s],"dump:stagebuf");
+      }
+      double *mybuf = &stagebuf[s][n*size_one];
+      if (iproc) {
+        MPI_Irecv(mybuf,maxbuf*size_one,MPI_DOUBLE,me+iproc,0,world,&request);
+        MPI_Send(&tmp,0,MPI_INT,me+iproc,0,world);
+        MPI_Wait(&request,&status);
+        MPI_Get_count(&status,MPI_DOUBLE,&nlines);
+        nlines /= size_one;
+      } else {
+        nlines = nme;
+        memcpy(mybuf,buf,nme*size_one*sizeof(double));
+      }
+      stagelines[s][iproc] = nlines;
+      n += nlines;
+    }
+  } else {
+    MPI_Recv(&tmp,0,MPI_INT,fileproc,0,world,&status);
+    MPI_Rsend(buf,nme*size_one,MPI_DOUBLE,fileproc,0,world);
+  }
+
+  // previous snapshot must be written before its file or fp is touched
+  // header is written here, it may depend on the current timestep
+
+  async_wait();
+  async_cur = s;
+
+  if (multifile) openfile();
+  if (filewriter) {
+    write_header(nheader);
+    async_launch();
+  }
+}
+
+/* ----------------------------------------------------------------------
+   stage my nme lines of buf for styles that write per-proc files
+   copy goes to the buffer the writer does not use, then waits for it
+   return staged copy, which is async_cur now
+------------------------------------------------------------------------- */
+
+double *Dump::async_stage()
+{
+  const int s = 1 - async_cur;
+  if (nme*size_one > maxstage[s]) {
+    maxstage[s] = nme*size_one;
+    memory->grow(stagebuf[s],maxstage[s],"dump:stagebuf");
+  }
+  memcpy(stagebuf[s],buf,nme*size_one*sizeof(double));
+
+  async_wait();
+  async_cur = s;
+  return stagebuf[s];
+}
+
+/* ----------------------------------------------------------------------
+   start background writer for staging buffer async_cur
+------------------------------------------------------------------------- */
+
+void Dump::async_launch()
+{
+  async_nwrite++;
+  writer = new DumpWriter(this);
+}
+
+/* ----------------------------------------------------------------------
+   wait until pending snapshot is written, time waited counts as stall
+   called before anything the writer uses is changed or deleted
+------------------------------------------------------------------------- */
+
+void Dump::async_wait()
+{
+  if (!writer) return;
+
+  double time = MPI_Wtime();
+  if (!writer->done) async_nstall++;
+  writer->thread.join();
+  async_stall += MPI_Wtime() - time;
+
+  delete writer;
+  writer = NULL;
+
+  if (async_error) {
+    const char *str = async_error;
+    async_error = NULL;
+    error->one(FLERR,str);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   runs in the writer thread
+   format and write the staged data of all procs in my cluster
+   must not call MPI or Error, errors are passed via async_error
+------------------------------------------------------------------------- */
+
+void Dump::async_write()
+{
+  double *mybuf = stagebuf[async_cur];
+
+  for (int iproc = 0; iproc < nclusterprocs; iproc++) {
+    const int nlines = stagelines[async_cur][iproc];
+    if (buffer_flag && !binary) {
+      const int nchars = convert_string(nlines,mybuf);
+      if (nchars < 0) {
+        async_error = "Too much buffered per-proc info for dump";
+        break;
+      }
+      write_data(nchars,(double *) sbuf);
+    } else write_data(nlines,mybuf);
+    mybuf += nlines*size_one;
+  }
+  if (flush_flag) fflush(fp);
+
+  if (multifile) {
+    if (compressed) pclose(fp);
+    else fclose(fp);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   local copies of simulation box bounds
+------------------------------------------------------------------------- */
+
+void Dump::box_bounds()
+{
+  if (domain->triclinic == 0) {
+    boxxlo = domain->boxlo[0];
+    boxxhi = domain->boxhi[0];
+    boxylo = domain->boxlo[1];
+    boxyhi = domain->boxhi[1];
+    boxzlo = domain->boxlo[2];
+    boxzhi = domain->boxhi[2];
+  } else {
+    boxxlo = domain->boxlo_bound[0];
+    boxxhi = domain->boxhi_bound[0];
+    boxylo = domain->boxlo_bound[1];
+    boxyhi = domain->boxhi_bound[1];
+    boxzlo = domain->boxlo_bound[2];
+    boxzhi = domain->boxhi_bound[2];
+    boxxy = domain->xy;
+    boxxz = domain->xz;
+    boxyz = domain->yz;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   insure buf is sized for packing and communicating
+   use nmax to insure filewriter proc can receive info from others
+   limit nmax*size_one to int since used as arg in MPI calls
+   insure ids buffer is sized for sorting
+------------------------------------------------------------------------- */
+
+void Dump::grow_buf(int nmax)
+{
+  if (nmax > maxbuf) {
+    if ((bigint) nmax * size_one > MAXSMALLINT)
+      error->all(FLERR,"Too much per-proc info for dump");
+    maxbuf = nmax;
+    memory->destroy(buf);
+    memory->create(buf,maxbuf*size_one,"dump:buf");
+  }
+
+  if (sort_flag && sortcol == 0 && nmax > maxids) {
+    maxids = nmax;
+    memory->destroy(ids);
+    memory->create(ids,maxids,"dump:ids");
+  }
+}
+
 /* ----------------------------------------------------------------------
    generic opening of a dump file
    ASCII or binary or gzipped
@@ -706,6 +954,8 @@ void Dump::modify_params(int narg, char **arg)
 {
   if (narg == 0) error->all(FLERR,"Illegal dump_modify command");
 
+  async_wait();
+
   int iarg = 0;
   while (iarg < narg) {
     if (strcmp(arg[iarg],"append") == 0) {
@@ -715,6 +965,15 @@ void Dump::modify_params(int narg, char **arg)
       else error->all(FLERR,"Illegal dump_modify command");
       iarg += 2;
 
+    } else if (strcmp(arg[iarg],"async") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal dump_modify command");
+      if (strcmp(arg[iarg+1],"yes") == 0) async_flag = 1;
+      else if (strcmp(arg[iarg+1],"no") == 0) async_flag = 0;
+      else error->all(FLERR,"Illegal dump_modify command");
+      if (async_flag && async_allow == 0)
+        error->all(FLERR,"Dump_modify async yes not allowed for this style");
+      iarg += 2;
+
     } else if (strcmp(arg[iarg],"buffer") == 0) {
       if (iarg+2 > narg) error->all(FLERR,"Illegal dump_modify command");
       if (strcmp(arg[iarg+1],"yes") == 0) buffer_flag = 1;
@@ -870,6 +1129,8 @@ void Dump::modify_params(int narg, char **arg)
 bigint Dump::memory_usage()
 {
   bigint bytes = memory->usage(buf,size_one*maxbuf);
+  bytes += memory->usage(stagebuf[0],maxstage[0]);
+  bytes += memory->usage(stagebuf[1],maxstage[1]);
   bytes += memory->usage(sbuf,maxsbuf);
   if (sort_flag) {
     if (sortcol == 0) bytes += memory->usage(ids,maxids);
@@ -21,6 +21,8 @@
 namespace LAMMPS_NS {
 
 class Dump : protected Pointers {
+  friend class DumpWriter;
+
  public:
   char *id;                  // user-defined name of Dump
   char *style;               // style of Dump
@@ -49,6 +51,14 @@ class Dump : protected Pointers {
   void modify_params(int, char **);
   virtual bigint memory_usage();
 
+  // asynchronous output, set by dump_modify async
+
+  int async_flag;            // 1 if data is written by a background thread
+  double async_stall;        // wall time waited for the writer since init
+  int async_nwrite;          // # of snapshots handed to the writer since init
+  int async_nstall;          // # of them which had to wait for the writer
+  void async_wait();         // block until the pending snapshot is written
+
  protected:
   int me,nprocs;             // proc info
 
@@ -112,6 +122,21 @@ class Dump : protected Pointers {
 
   class Irregular *irregular;
 
+  int async_allow;           // 1 if style allows for async_flag, 0 if not
+  class DumpWriter *writer;  // background writer, NULL if nothing pending
+  const char *async_error;   // error of the writer, raised by async_wait()
+  int async_cur;             // staging buffer of the pending snapshot
+  double *stagebuf[2];       // snapshots gathered on the filewriter proc
+  int maxstage[2];           // size of stagebuf
+  int *stagelines[2];        // # of lines from each proc of my cluster
+
+  void write_async();
+  double *async_stage();
+  void async_launch();
+  virtual void async_write();
+  void box_bounds();
+  void grow_buf(int);
+
   virtual void init_style() = 0;
   virtual void openfile();
   virtual int modify_param(int, char **) {return 0;}
@@ -179,4 +204,14 @@ E: Cannot use dump_modify nfile without % in dump file name
 
 UNDOCUMENTED
 
+E: Dump_modify async yes not allowed for this style
+
+This dump style writes its files itself and cannot hand them to a
+background writer.
+
+E: Too much buffered per-proc info for dump
+
+The formatted text of the snapshot is too long for the output buffer.
+Use dump_modify buffer no.
+
 */
@@ -58,6 +58,7 @@ DumpATOMVTK::DumpATOMVTK(LAMMPS *lmp, int narg, char **arg) : Dump(lmp, narg, ar
 
   sort_flag = 1;
   sortcol = 0;
+  async_allow = 0;
 
   size_one = 17;
 
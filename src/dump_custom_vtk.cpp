@@ -107,6 +107,7 @@ DumpCustomVTK::DumpCustomVTK(LAMMPS *lmp, int narg, char **arg) :
   if (narg == 5) error->all(FLERR,"No dump custom/vtk arguments specified");
 
   clearstep = 1;
+  async_allow = 0;
 
   nevery = force->inumeric(FLERR,arg[3]);
 
@@ -0,0 +1,149 @@
+/* ----------------------------------------------------------------------
+   LIGGGHTS - LAMMPS Improved for General Granular and Granular Heat
+   Transfer Simulations
+
+   LIGGGHTS is part of the CFDEMproject
+   www.liggghts.com | www.cfdem.com
+
+   Christoph Kloss, christoph.kloss@cfdem.com
+   Copyright 2009-2012 JKU Linz
+   Copyright 2012-     DCS Computing GmbH, Linz
+
+   LIGGGHTS is based on LAMMPS
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   This software is distributed under the GNU General Public License.
+
+   See the README file in the top-level directory.
+------------------------------------------------------------------------- */
+
+#include <string.h>
+#include <string>
+#include "dump_custom_vtp.h"
+#include "update.h"
+#include "error.h"
+
+using namespace LAMMPS_NS;
+
+enum{INT,DOUBLE,STRING};    // same as in DumpCustom
+
+/* ----------------------------------------------------------------------
+   x y z become the points, all other attributes point data
+   3 consecutive attributes <name>x <name>y <name>z, e.g. vx vy vz,
+     are combined to one vector named <name>
+------------------------------------------------------------------------- */
+
+DumpCustomVTP::DumpCustomVTP(LAMMPS *lmp, int narg, char **arg) :
+  DumpCustom(lmp, narg, arg)
+{
+  char **field = &arg[5];
+
+  xcol = -1;
+  for (int i = 0; i+2 < nfield; i++)
+    if (strcmp(field[i],"x") == 0 && strcmp(field[i+1],"y") == 0 &&
+        strcmp(field[i+2],"z") == 0) {
+      xcol = i;
+      break;
+    }
+  if (xcol < 0)
+    error->all(FLERR,"Dump custom/vtp requires consecutive x y z attributes");
+
+  int i = 0;
+  while (i < nfield) {
+    if (i == xcol) {
+      i += 3;
+      continue;
+    }
+    if (vtype[i] == STRING)
+      error->all(FLERR,"Dump custom/vtp cannot dump element attribute");
+
+    VTKXMLWriter::DataType type =
+      (vtype[i] == INT) ? VTKXMLWriter::INT32 : VTKXMLWriter::FLOAT64;
+
+    const int n = strlen(field[i]);
+    if (n > 1 && field[i][n-1] == 'x' && i+2 < nfield &&
+        vtype[i+1] == vtype[i] && vtype[i+2] == vtype[i] &&
+        (int) strlen(field[i+1]) == n && (int) strlen(field[i+2]) == n &&
+        strncmp(field[i],field[i+1],n-1) == 0 && field[i+1][n-1] == 'y' &&
+        strncmp(field[i],field[i+2],n-1) == 0 && field[i+2][n-1] == 'z') {
+      std::string name(field[i],n-1);
+      arrays.push_back(VTKXMLWriter::Array(name.c_str(),3,type,NULL,size_one,i));
+      i += 3;
+    } else {
+      arrays.push_back(VTKXMLWriter::Array(field[i],1,type,NULL,size_one,i));
+      i++;
+    }
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+void DumpCustomVTP::init_style()
+{
+  const char *suffix = strrchr(filename,'.');
+  if (!suffix || strcmp(suffix,".pvtp") != 0)
+    error->all(FLERR,"Dump custom/vtp filename must end in .pvtp");
+  if (multifile == 0)
+    error->all(FLERR,"Dump custom/vtp requires one snapshot per file");
+  if (multiproc)
+    error->all(FLERR,"Dump custom/vtp writes one file per proc, do not use '%'");
+  if (sort_flag)
+    error->all(FLERR,"Dump custom/vtp does not support dump_modify sort");
+
+  DumpCustom::init_style();
+}
+
+/* ----------------------------------------------------------------------
+   each proc writes the atoms it owns to its own piece
+   no data is communicated, proc 0 also writes the index
+------------------------------------------------------------------------- */
+
+void DumpCustomVTP::write()
+{
+  nme = count();
+  grow_buf(nme);
+  pack(NULL);
+
+  std::string base =
+    VTKXMLWriter::file_base(filename,update->ntimestep,padflag,".pvtp");
+
+  if (async_flag) {
+    data = async_stage();
+    filebase = base;
+    npoints = nme;
+    async_launch();
+    return;
+  }
+
+  data = buf;
+  filebase = base;
+  npoints = nme;
+  if (!write_files()) error->one(FLERR,"Cannot open dump file");
+}
+
+/* ---------------------------------------------------------------------- */
+
+void DumpCustomVTP::async_write()
+{
+  if (!write_files()) async_error = "Cannot open dump file";
+}
+
+/* ---------------------------------------------------------------------- */
+
+bool DumpCustomVTP::write_files()
+{
+  for (size_t i = 0; i < arrays.size(); i++) arrays[i].data = data;
+
+  std::string piece = VTKXMLWriter::piece_name(filebase.c_str(),me,".vtp");
+  bool ok = VTKXMLWriter::write_points(piece.c_str(),npoints,data,
+                                       size_one,xcol,arrays);
+
+  if (me == 0) {
+    std::string index = filebase + ".pvtp";
+    ok = VTKXMLWriter::write_points_index(index.c_str(),filebase.c_str(),
+                                          nprocs,arrays) && ok;
+  }
+  return ok;
+}
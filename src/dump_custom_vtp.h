@@ -0,0 +1,95 @@
+/* ----------------------------------------------------------------------
+   LIGGGHTS - LAMMPS Improved for General Granular and Granular Heat
+   Transfer Simulations
+
+   LIGGGHTS is part of the CFDEMproject
+   www.liggghts.com | www.cfdem.com
+
+   Christoph Kloss, christoph.kloss@cfdem.com
+   Copyright 2009-2012 JKU Linz
+   Copyright 2012-     DCS Computing GmbH, Linz
+
+   LIGGGHTS is based on LAMMPS
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   This software is distributed under the GNU General Public License.
+
+   See the README file in the top-level directory.
+------------------------------------------------------------------------- */
+
+#ifdef DUMP_CLASS
+
+DumpStyle(custom/vtp,DumpCustomVTP)
+
+#else
+
+#ifndef LMP_DUMP_CUSTOM_VTP_H
+#define LMP_DUMP_CUSTOM_VTP_H
+
+#include "dump_custom.h"
+#include "vtk_xml_writer.h"
+
+namespace LAMMPS_NS {
+
+class DumpCustomVTP : public DumpCustom {
+ public:
+  DumpCustomVTP(class LAMMPS *, int, char **);
+  ~DumpCustomVTP() {}
+
+  void write();
+
+ private:
+  int xcol;                                  // column of x, y and z follow
+  std::vector<VTKXMLWriter::Array> arrays;   // point data, buf set on write
+
+  // snapshot to write, possibly by the asynchronous writer
+
+  std::string filebase;                      // filename with timestep
+  int npoints;
+  const double *data;
+
+  void init_style();
+  bool write_files();
+  void async_write();
+};
+
+}
+
+#endif
+#endif
+
+/* ERROR/WARNING messages:
+
+E: Dump custom/vtp requires consecutive x y z attributes
+
+The particle positions are written as the points of the VTK file.
+
+E: Dump custom/vtp cannot dump element attribute
+
+Strings are not supported by the binary VTK format.
+
+E: Dump custom/vtp filename must end in .pvtp
+
+The .pvtp index is written to this file, the pieces of all procs
+are written next to it.
+
+E: Dump custom/vtp requires one snapshot per file
+
+Use the wildcard "*" character in the filename.
+
+E: Dump custom/vtp writes one file per proc, do not use '%'
+
+Each proc always writes its own piece file.
+
+E: Dump custom/vtp does not support dump_modify sort
+
+Each proc writes its own atoms, so they cannot be sorted globally.
+
+E: Cannot open dump file
+
+The output file for the dump command cannot be opened.  Check that
+the path and name are correct.
+
+*/
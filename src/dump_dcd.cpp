@@ -61,6 +61,7 @@ DumpDCD::DumpDCD(LAMMPS *lmp, int narg, char **arg) : Dump(lmp, narg, arg)
   size_one = 3;
   sort_flag = 1;
   sortcol = 0;
+  async_allow = 0;
 
   unwrap_flag = 0;
   format_default = NULL;
@@ -41,6 +41,7 @@ DumpDecompositionVTK::DumpDecompositionVTK(LAMMPS *lmp, int narg, char **arg) :
     error->all(FLERR,"Illegal dump decomposition command");
 
   format_default = NULL;
+  async_allow = 0;
 
   //number of properties written out in one line with buff
   size_one=1;  //dont use buff
@@ -50,6 +50,7 @@ DumpEulerVTK::DumpEulerVTK(LAMMPS *lmp, int narg, char **arg) : Dump(lmp, narg,
   // CURRENTLY ONLY PROC 0 writes
 
   format_default = NULL;
+  async_allow = 0;
 }
 
 /* ---------------------------------------------------------------------- */
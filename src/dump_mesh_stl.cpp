@@ -178,6 +178,11 @@ int DumpMeshSTL::modify_param(int narg, char **arg)
 
 void DumpMeshSTL::write_header(bigint ndump)
 {
+  // reset here, not in count(), since an asynchronous writer may
+  // still be writing the previous snapshot while count() is called
+
+  n_calls_ = 0;
+
   if(writeBinarySTL_) write_header_binary(ndump);
   else write_header_ascii(ndump);
 }
@@ -214,8 +219,6 @@ int DumpMeshSTL::count()
   int numTri = 0;
   double center[3];
 
-  n_calls_ = 0;
-
   /*NL*///if (screen) fprintf(screen,"nMesh_ %d\n",nMesh_);
 
   for(int imesh = 0; imesh < nMesh_; imesh++)
@@ -379,6 +379,11 @@ int DumpMeshVTK::modify_param(int narg, char **arg)
 
 void DumpMeshVTK::write_header(bigint ndump)
 {
+  // reset here, not in count(), see DumpMeshSTL::write_header()
+
+  n_calls_ = 0;
+  n_all_ = 0;
+
   write_header_ascii(ndump);
 }
 
@@ -394,9 +399,6 @@ int DumpMeshVTK::count()
 {
   int numTri = 0;
 
-  n_calls_ = 0;
-  n_all_ = 0;
-
   /*NL*///if (screen) fprintf(screen,"nMesh_ %d\n",nMesh_);
 
   getRefs();
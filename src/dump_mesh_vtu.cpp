@@ -0,0 +1,308 @@
+/* ----------------------------------------------------------------------
+   LIGGGHTS - LAMMPS Improved for General Granular and Granular Heat
+   Transfer Simulations
+
+   LIGGGHTS is part of the CFDEMproject
+   www.liggghts.com | www.cfdem.com
+
+   Christoph Kloss, christoph.kloss@cfdem.com
+   Copyright 2009-2012 JKU Linz
+   Copyright 2012-     DCS Computing GmbH, Linz
+
+   LIGGGHTS is based on LAMMPS
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   This software is distributed under the GNU General Public License.
+
+   See the README file in the top-level directory.
+------------------------------------------------------------------------- */
+
+#include <string.h>
+#include <string>
+#include "dump_mesh_vtu.h"
+#include "tri_mesh.h"
+#include "domain.h"
+#include "update.h"
+#include "error.h"
+#include "fix_mesh_surface.h"
+#include "region.h"
+#include "modify.h"
+#include "memory.h"
+
+using namespace LAMMPS_NS;
+
+// layout of one triangle in buf, element properties follow
+
+enum{NODES = 0, ID = 9, MESH = 10, PROC = 11, NORMAL = 12, NFIXED = 15};
+
+/* ---------------------------------------------------------------------- */
+
+DumpMeshVTU::DumpMeshVTU(LAMMPS *lmp, int narg, char **arg) : Dump(lmp, narg, arg),
+  nMesh_(0),
+  meshList_(0),
+  iregion_(-1),
+  nProp_(0),
+  propName_(0),
+  propSize_(0),
+  scalarProp_(0),
+  vectorProp_(0)
+{
+  if (narg < 5)
+    error->all(FLERR,"Illegal dump mesh/vtu command");
+
+  format_default = NULL;
+
+  // args are mesh IDs, region keyword and element property names
+  // anything that is not a fix ID is a property
+
+  meshList_ = new TriMesh*[narg];
+  propName_ = new char*[narg];
+
+  int iarg = 5;
+  while (iarg < narg) {
+    if (strcmp(arg[iarg],"region") == 0) {
+      if (narg < iarg+2)
+        error->all(FLERR,"Illegal dump mesh/vtu command");
+      iregion_ = domain->find_region(arg[iarg+1]);
+      if (iregion_ == -1)
+        error->all(FLERR,"Illegal dump mesh/vtu command, region ID does not exist");
+      iarg += 2;
+    } else if (modify->find_fix(arg[iarg]) >= 0) {
+      Fix *fix = modify->fix[modify->find_fix(arg[iarg])];
+      FixMeshSurface *fms = dynamic_cast<FixMeshSurface*>(fix);
+      if (!fms)
+        error->all(FLERR,"Illegal dump mesh/vtu command, fix is not of type mesh/surface");
+      meshList_[nMesh_++] = fms->triMesh();
+      fms->dumpAdd();
+      iarg++;
+    } else {
+      propName_[nProp_] = new char[strlen(arg[iarg])+1];
+      strcpy(propName_[nProp_],arg[iarg]);
+      nProp_++;
+      iarg++;
+    }
+  }
+
+  // in case meshes not specified explicitly, take all meshes
+
+  if (nMesh_ == 0) {
+    const int nfms = modify->n_fixes_style("mesh/surface");
+    delete [] meshList_;
+    meshList_ = new TriMesh*[nfms];
+    for (int i = 0; i < nfms; i++) {
+      FixMeshSurface *fms =
+        static_cast<FixMeshSurface*>(modify->find_fix_style("mesh/surface",i));
+      meshList_[nMesh_++] = fms->triMesh();
+      fms->dumpAdd();
+    }
+    if (nMesh_ == 0 && me == 0)
+      error->warning(FLERR,"Dump mesh/vtu cannot find any fix of type 'mesh/surface' to dump");
+  }
+
+  propSize_ = new int[nProp_];
+  scalarProp_ = new ScalarContainer<double>**[nProp_];
+  vectorProp_ = new VectorContainer<double,3>**[nProp_];
+  for (int ip = 0; ip < nProp_; ip++) {
+    propSize_[ip] = 0;
+    scalarProp_[ip] = new ScalarContainer<double>*[nMesh_];
+    vectorProp_[ip] = new VectorContainer<double,3>*[nMesh_];
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+DumpMeshVTU::~DumpMeshVTU()
+{
+  for (int iMesh = 0; iMesh < nMesh_; iMesh++) {
+    Fix *fix = modify->find_fix_id(meshList_[iMesh]->mesh_id());
+    if (fix) static_cast<FixMeshSurface*>(fix)->dumpRemove();
+  }
+  delete [] meshList_;
+
+  for (int ip = 0; ip < nProp_; ip++) {
+    delete [] propName_[ip];
+    delete [] scalarProp_[ip];
+    delete [] vectorProp_[ip];
+  }
+  delete [] propName_;
+  delete [] propSize_;
+  delete [] scalarProp_;
+  delete [] vectorProp_;
+}
+
+/* ----------------------------------------------------------------------
+   properties are looked up here, they may be added after the dump
+------------------------------------------------------------------------- */
+
+void DumpMeshVTU::init_style()
+{
+  const char *suffix = strrchr(filename,'.');
+  if (!suffix || strcmp(suffix,".pvtu") != 0)
+    error->all(FLERR,"Dump mesh/vtu filename must end in .pvtu");
+  if (multifile == 0)
+    error->all(FLERR,"Dump mesh/vtu requires one snapshot per file");
+  if (multiproc)
+    error->all(FLERR,"Dump mesh/vtu writes one file per proc, do not use '%'");
+
+  arrays_.clear();
+  arrays_.push_back(VTKXMLWriter::Array("id",1,VTKXMLWriter::INT32,NULL,0,ID));
+  arrays_.push_back(VTKXMLWriter::Array("mesh",1,VTKXMLWriter::INT32,NULL,0,MESH));
+  arrays_.push_back(VTKXMLWriter::Array("proc",1,VTKXMLWriter::INT32,NULL,0,PROC));
+  arrays_.push_back(VTKXMLWriter::Array("normal",3,VTKXMLWriter::FLOAT64,NULL,0,NORMAL));
+
+  int offset = NFIXED;
+  for (int ip = 0; ip < nProp_; ip++) {
+    propSize_[ip] = 0;
+    for (int iMesh = 0; iMesh < nMesh_; iMesh++) {
+      scalarProp_[ip][iMesh] =
+        meshList_[iMesh]->prop().getElementProperty<ScalarContainer<double> >(propName_[ip]);
+      vectorProp_[ip][iMesh] =
+        meshList_[iMesh]->prop().getElementProperty<VectorContainer<double,3> >(propName_[ip]);
+      if (scalarProp_[ip][iMesh] && propSize_[ip] != 3) propSize_[ip] = 1;
+      else if (vectorProp_[ip][iMesh] && propSize_[ip] != 1) propSize_[ip] = 3;
+    }
+    if (propSize_[ip] == 0)
+      error->all(FLERR,"Dump mesh/vtu cannot find property on any mesh");
+
+    arrays_.push_back(VTKXMLWriter::Array(propName_[ip],propSize_[ip],
+                                          VTKXMLWriter::FLOAT64,NULL,0,offset));
+    offset += propSize_[ip];
+  }
+
+  if (size_one != offset) {
+    size_one = offset;
+    maxbuf = 0;
+    memory->destroy(buf);
+  }
+  for (size_t i = 0; i < arrays_.size(); i++) arrays_[i].stride = size_one;
+}
+
+/* ---------------------------------------------------------------------- */
+
+int DumpMeshVTU::modify_param(int narg, char **arg)
+{
+  error->warning(FLERR,"dump_modify keyword is not supported by 'dump mesh/vtu' and is thus ignored");
+  return 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+bool DumpMeshVTU::selected(int imesh, int itri)
+{
+  if (iregion_ < 0) return true;
+  double center[3];
+  meshList_[imesh]->center(itri,center);
+  return domain->regions[iregion_]->match(center[0],center[1],center[2]);
+}
+
+/* ----------------------------------------------------------------------
+   owned triangles, serial meshes are dumped by proc 0 only
+------------------------------------------------------------------------- */
+
+int DumpMeshVTU::count()
+{
+  int numTri = 0;
+
+  for (int iMesh = 0; iMesh < nMesh_; iMesh++) {
+    if (!meshList_[iMesh]->isParallel() && 0 != me) continue;
+    const int nTri = meshList_[iMesh]->sizeLocal();
+    for (int iTri = 0; iTri < nTri; iTri++)
+      if (selected(iMesh,iTri)) numTri++;
+  }
+  return numTri;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void DumpMeshVTU::pack(int *ids)
+{
+  int m = 0;
+  double node[3],vec[3];
+
+  for (int iMesh = 0; iMesh < nMesh_; iMesh++) {
+    TriMesh *mesh = meshList_[iMesh];
+    if (!mesh->isParallel() && 0 != me) continue;
+
+    const int nTri = mesh->sizeLocal();
+    for (int iTri = 0; iTri < nTri; iTri++) {
+      if (!selected(iMesh,iTri)) continue;
+
+      for (int j = 0; j < 3; j++) {
+        mesh->node(iTri,j,node);
+        for (int k = 0; k < 3; k++) buf[m++] = node[k];
+      }
+      buf[m++] = mesh->id(iTri);
+      buf[m++] = iMesh;
+      buf[m++] = me;
+      mesh->surfaceNorm(iTri,vec);
+      for (int k = 0; k < 3; k++) buf[m++] = vec[k];
+
+      for (int ip = 0; ip < nProp_; ip++) {
+        if (propSize_[ip] == 1) {
+          ScalarContainer<double> *prop = scalarProp_[ip][iMesh];
+          buf[m++] = prop ? prop->get(iTri) : 0.;
+        } else {
+          VectorContainer<double,3> *prop = vectorProp_[ip][iMesh];
+          if (prop) prop->get(iTri,vec);
+          else vec[0] = vec[1] = vec[2] = 0.;
+          for (int k = 0; k < 3; k++) buf[m++] = vec[k];
+        }
+      }
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   each proc writes its triangles to its own piece
+   no data is communicated, proc 0 also writes the index
+------------------------------------------------------------------------- */
+
+void DumpMeshVTU::write()
+{
+  nme = count();
+  grow_buf(nme);
+  pack(NULL);
+
+  std::string base =
+    VTKXMLWriter::file_base(filename,update->ntimestep,padflag,".pvtu");
+
+  if (async_flag) {
+    data_ = async_stage();
+    filebase_ = base;
+    nTri_ = nme;
+    async_launch();
+    return;
+  }
+
+  data_ = buf;
+  filebase_ = base;
+  nTri_ = nme;
+  if (!write_files()) error->one(FLERR,"Cannot open dump file");
+}
+
+/* ---------------------------------------------------------------------- */
+
+void DumpMeshVTU::async_write()
+{
+  if (!write_files()) async_error = "Cannot open dump file";
+}
+
+/* ---------------------------------------------------------------------- */
+
+bool DumpMeshVTU::write_files()
+{
+  for (size_t i = 0; i < arrays_.size(); i++) arrays_[i].data = data_;
+
+  std::string piece = VTKXMLWriter::piece_name(filebase_.c_str(),me,".vtu");
+  bool ok = VTKXMLWriter::write_triangles(piece.c_str(),nTri_,data_,
+                                          size_one,arrays_);
+
+  if (me == 0) {
+    std::string index = filebase_ + ".pvtu";
+    ok = VTKXMLWriter::write_triangles_index(index.c_str(),filebase_.c_str(),
+                                             nprocs,arrays_) && ok;
+  }
+  return ok;
+}
@@ -0,0 +1,121 @@
+/* ----------------------------------------------------------------------
+   LIGGGHTS - LAMMPS Improved for General Granular and Granular Heat
+   Transfer Simulations
+
+   LIGGGHTS is part of the CFDEMproject
+   www.liggghts.com | www.cfdem.com
+
+   Christoph Kloss, christoph.kloss@cfdem.com
+   Copyright 2009-2012 JKU Linz
+   Copyright 2012-     DCS Computing GmbH, Linz
+
+   LIGGGHTS is based on LAMMPS
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   This software is distributed under the GNU General Public License.
+
+   See the README file in the top-level directory.
+------------------------------------------------------------------------- */
+
+#ifdef DUMP_CLASS
+
+DumpStyle(mesh/vtu,DumpMeshVTU)
+
+#else
+
+#ifndef LMP_DUMP_MESH_VTU_H
+#define LMP_DUMP_MESH_VTU_H
+
+#include "dump.h"
+#include "container.h"
+#include "vtk_xml_writer.h"
+
+namespace LAMMPS_NS {
+
+class DumpMeshVTU : public Dump {
+ public:
+  DumpMeshVTU(LAMMPS *, int, char**);
+  virtual ~DumpMeshVTU();
+
+  void write();
+
+ private:
+  int nMesh_;
+  class TriMesh **meshList_;
+  int iregion_;
+
+  // element properties, looked up by name on each mesh
+  // a mesh without the property dumps 0
+
+  int nProp_;
+  char **propName_;
+  int *propSize_;                          // 1 = scalar, 3 = vector
+  ScalarContainer<double> ***scalarProp_;
+  VectorContainer<double,3> ***vectorProp_;
+
+  std::vector<VTKXMLWriter::Array> arrays_;
+
+  // snapshot to write, possibly by the asynchronous writer
+
+  std::string filebase_;                   // filename with timestep
+  int nTri_;
+  const double *data_;
+
+  void init_style();
+  bool write_files();
+  void async_write();
+  int modify_param(int, char **);
+  void write_header(bigint) {}
+  int count();
+  void pack(int *);
+  void write_data(int, double *) {}
+
+  bool selected(int imesh, int itri);
+};
+
+}
+
+#endif
+#endif
+
+/* ERROR/WARNING messages:
+
+E: Illegal dump mesh/vtu command
+
+Self-explanatory.  Check the input script syntax and compare to the
+documentation for the command.
+
+E: Illegal dump mesh/vtu command, fix is not of type mesh/surface
+
+Only surface meshes can be dumped.
+
+E: Dump mesh/vtu filename must end in .pvtu
+
+The .pvtu index is written to this file, the pieces of all procs
+are written next to it.
+
+E: Dump mesh/vtu requires one snapshot per file
+
+Use the wildcard "*" character in the filename.
+
+E: Dump mesh/vtu writes one file per proc, do not use '%'
+
+Each proc always writes its own piece file.
+
+E: Dump mesh/vtu cannot find property on any mesh
+
+The named element property is neither a scalar nor a vector
+property of any of the dumped meshes.
+
+W: Dump mesh/vtu cannot find any fix of type 'mesh/surface' to dump
+
+Self-explanatory.
+
+E: Cannot open dump file
+
+The output file for the dump command cannot be opened.  Check that
+the path and name are correct.
+
+*/
@@ -28,6 +28,7 @@
 #include "neigh_list.h"
 #include "neigh_request.h"
 #include "output.h"
+#include "dump.h"
 #include "memory.h"
 #include "modify.h"
 #include "fix.h"
@@ -54,6 +55,10 @@ void Finish::end(int flag)
   MPI_Comm_rank(world,&me);
   MPI_Comm_size(world,&nprocs);
 
+  // complete pending asynchronous dumps, so files are whole after a run
+
+  for (i = 0; i < output->ndump; i++) output->dump[i]->async_wait();
+
   // recompute natoms in case atoms have been lost
 
   bigint nblocal = atom->nlocal;
@@ -527,6 +532,29 @@ void Finish::end(int flag)
                 time_max, imbalance);
     }
 
+    // time the run waited for background writers of asynchronous dumps
+    // only filewriter procs wait, so report the max
+
+    for (i = 0; i < output->ndump; i++) {
+      Dump *dump = output->dump[i];
+      if (!dump->async_flag) continue;
+      time = dump->async_stall;
+      MPI_Allreduce(&time,&time_max,1,MPI_DOUBLE,MPI_MAX,world);
+      int nstall[2] = {dump->async_nstall,dump->async_nwrite};
+      int nstall_all[2];
+      MPI_Allreduce(nstall,nstall_all,2,MPI_INT,MPI_MAX,world);
+      if (me == 0) {
+        if (screen)
+          fprintf(screen,"Dump %s stall time (%%) = %g (%g), "
+                  "%d of %d snapshots waited\n",dump->id,time_max,
+                  time_max/time_loop*100.0,nstall_all[0],nstall_all[1]);
+        if (logfile)
+          fprintf(logfile,"Dump %s stall time (%%) = %g (%g), "
+                  "%d of %d snapshots waited\n",dump->id,time_max,
+                  time_max/time_loop*100.0,nstall_all[0],nstall_all[1]);
+      }
+    }
+
     if(modify->timing) {
       time = timer->array[TIME_MODIFY];
       MPI_Allreduce(&time,&tmp,1,MPI_DOUBLE,MPI_SUM,world);
@@ -549,6 +577,24 @@ void Finish::end(int flag)
                   time_max, imbalance);
       }
 
+      // breakdown by fix, e.g. to tell wall contacts from integration
+
+      for (int i = 0; i < modify->nfix; i++) {
+        time = modify->fix[i]->get_recorded_time();
+        MPI_Allreduce(&time,&tmp,1,MPI_DOUBLE,MPI_SUM,world);
+        time = tmp/nprocs;
+        if (me == 0 && time > 0.0) {
+          if (screen)
+            fprintf(screen,"  Fix %s (%s) time (%%) = %g (%g)\n",
+                    modify->fix[i]->id,modify->fix[i]->style,
+                    time,time/time_loop*100.0);
+          if (logfile)
+            fprintf(logfile,"  Fix %s (%s) time (%%) = %g (%g)\n",
+                    modify->fix[i]->id,modify->fix[i]->style,
+                    time,time/time_loop*100.0);
+        }
+      }
+
       if(modify->timing > 1) {
         double * modify_times = NULL;
         if (me == 0) modify_times = new double[comm->nprocs];
@@ -836,6 +882,13 @@ void Finish::end(int flag)
     double nall;
     MPI_Allreduce(&tmp,&nall,1,MPI_DOUBLE,MPI_SUM,world);
 
+    bigint npair[4],npair_all[4];
+    npair[0] = neighbor->npaircheck;
+    npair[1] = neighbor->npairaccept;
+    npair[2] = neighbor->npartialbuild;
+    npair[3] = neighbor->npartialreuse;
+    MPI_Allreduce(npair,npair_all,4,MPI_LMP_BIGINT,MPI_SUM,world);
+
     int nspec;
     double nspec_all;
     if (atom->molecular) {
@@ -861,6 +914,16 @@ void Finish::end(int flag)
                 neighbor->ncalls);
         fprintf(screen,"Dangerous builds = " BIGINT_FORMAT "\n",
                 neighbor->ndanger);
+        if (npair_all[0] > 0)
+          fprintf(screen,"Candidate pairs checked = " BIGINT_FORMAT
+                  ", accepted = " BIGINT_FORMAT " (%g%%)\n",
+                  npair_all[0],npair_all[1],
+                  100.0*npair_all[1]/npair_all[0]);
+        if (npair_all[2]+npair_all[3] > 0)
+          fprintf(screen,"Partial list entries rebuilt = " BIGINT_FORMAT
+                  ", reused = " BIGINT_FORMAT " (%g%%)\n",
+                  npair_all[2],npair_all[3],
+                  100.0*npair_all[3]/(npair_all[2]+npair_all[3]));
       }
       if (logfile) {
         if (nall < 2.0e9)
@@ -876,6 +939,16 @@ void Finish::end(int flag)
                 neighbor->ncalls);
         fprintf(logfile,"Dangerous builds = " BIGINT_FORMAT "\n",
                 neighbor->ndanger);
+        if (npair_all[0] > 0)
+          fprintf(logfile,"Candidate pairs checked = " BIGINT_FORMAT
+                  ", accepted = " BIGINT_FORMAT " (%g%%)\n",
+                  npair_all[0],npair_all[1],
+                  100.0*npair_all[1]/npair_all[0]);
+        if (npair_all[2]+npair_all[3] > 0)
+          fprintf(logfile,"Partial list entries rebuilt = " BIGINT_FORMAT
+                  ", reused = " BIGINT_FORMAT " (%g%%)\n",
+                  npair_all[2],npair_all[3],
+                  100.0*npair_all[3]/(npair_all[2]+npair_all[3]));
       }
     }
   }
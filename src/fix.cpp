@@ -69,6 +69,7 @@ Fix::Fix(LAMMPS *lmp, int narg, char **arg) : Pointers(lmp)
   restart_pbc = 0;
   wd_header = wd_section = 0;
   cudable_comm = 0;
+  comm_overlap = 0;
   rad_mass_vary_flag = 0; //NP modified C.K.
   just_created = 1; //NP modified C.K.
   recent_restart = 0; //NP modified C.K.
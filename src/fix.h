@@ -56,6 +56,9 @@ class Fix : protected Pointers {
   int wd_header;                 // # of header values fix writes to data file
   int wd_section;                // # of sections fix writes to data file
   int cudable_comm;              // 1 if fix has CUDA-enabled communication
+  int comm_overlap;              // 1 if pre_force() neither uses ghost data
+                                 //   nor changes pair input/output, so it
+                                 //   may run after the interior pair forces
 
   int rad_mass_vary_flag;        // 1 if particle radius or mass varied by fix //NP modified C.K.
   int just_created;              // 1 if fix was just created
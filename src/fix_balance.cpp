@@ -76,6 +76,13 @@ FixBalance::FixBalance(LAMMPS *lmp, int narg, char **arg) :
         error->all(FLERR,"Fix balance string is invalid");
   }
 
+  // create instance of Balance class and initialize it with params
+  // create instance of Irregular class
+
+  balance = new Balance(lmp);
+  balance->dynamic_setup(bstr,nitermax,thresh);
+  irregular = new Irregular(lmp);
+
   // optional args
 
   int outarg = 0;
@@ -87,16 +94,11 @@ FixBalance::FixBalance(LAMMPS *lmp, int narg, char **arg) :
       if (iarg+2 > narg) error->all(FLERR,"Illegal fix balance command");
       outarg = iarg+1;
       iarg += 2;
+    } else if (strcmp(arg[iarg],"weight") == 0) {
+      iarg = balance->weight_args(iarg,narg,arg);
     } else error->all(FLERR,"Illegal fix balance command");
   }
 
-  // create instance of Balance class and initialize it with params
-  // create instance of Irregular class
-
-  balance = new Balance(lmp);
-  balance->dynamic_setup(bstr,nitermax,thresh);
-  irregular = new Irregular(lmp);
-
   //NP modified C.K.
   //NP disallow balancing for more than one dimension for meshes
   //NP b/c would need irregular() in case particle is at edge
@@ -120,6 +122,7 @@ FixBalance::FixBalance(LAMMPS *lmp, int narg, char **arg) :
 
   // compute initial outputs
 
+  balance->compute_weights();
   imbfinal = imbprev = balance->imbalance_nlocal(maxperproc);
   itercount = 0;
   pending = 0;
@@ -198,6 +201,7 @@ void FixBalance::setup_pre_exchange()
 
   // perform a rebalance if threshhold exceeded
 
+  balance->compute_weights();
   imbnow = balance->imbalance_nlocal(maxperproc);
   if (imbnow > thresh) rebalance();
 
@@ -226,6 +230,7 @@ void FixBalance::pre_exchange()
 
   // return if imbalance < threshhold
 
+  balance->compute_weights();
   imbnow = balance->imbalance_nlocal(maxperproc);
   if (imbnow <= thresh) {
     if (nevery) next_reneighbor = (update->ntimestep/nevery)*nevery + nevery;
@@ -242,12 +247,15 @@ void FixBalance::pre_exchange()
 /* ----------------------------------------------------------------------
    compute final imbalance factor based on nlocal after comm->exchange()
    only do this if rebalancing just occured
+   per-particle costs do not migrate with the particles, so if weighted
+   the factor is the one Balance computed for the final splits
 ------------------------------------------------------------------------- */
 
 void FixBalance::pre_neighbor()
 {
   if (!pending) return;
   imbfinal = balance->imbalance_nlocal(maxperproc);
+  if (balance->weighted()) imbfinal = balance->imbalance_final();
   pending = 0;
 }
 
@@ -711,8 +711,8 @@ void FixBreakParticle::check_energy_criterion()
         // loop owned and ghost triangles
         for (int iTri = 0; iTri < nTriAll; iTri++) {
 
-          const std::vector<int> & neighborList = meshNeighlist->get_contact_list(iTri);
-          const int numneigh = neighborList.size();
+          const int * neighborList;
+          const int numneigh = meshNeighlist->get_contact_list(iTri,neighborList);
 
           for (int iCont = 0; iCont < numneigh; iCont++) {
 
@@ -886,8 +886,8 @@ void FixBreakParticle::check_energy_criterion()
           // loop owned and ghost triangles
           for (int iTri = 0; iTri < nTriAll; iTri++) {
 
-            const std::vector<int> & neighborList = meshNeighlist->get_contact_list(iTri);
-            const int numneigh = neighborList.size();
+            const int * neighborList;
+            const int numneigh = meshNeighlist->get_contact_list(iTri,neighborList);
 
             for (int iCont = 0; iCont < numneigh; iCont++) {
 
@@ -1007,8 +1007,8 @@ void FixBreakParticle::check_force_criterion()
         // loop owned and ghost triangles
         for (int iTri = 0; iTri < nTriAll; iTri++) {
 
-          const std::vector<int> & neighborList = meshNeighlist->get_contact_list(iTri);
-          const int numneigh = neighborList.size();
+          const int * neighborList;
+          const int numneigh = meshNeighlist->get_contact_list(iTri,neighborList);
 
           for (int iCont = 0; iCont < numneigh; iCont++) {
 
@@ -1158,8 +1158,8 @@ void FixBreakParticle::check_von_mises_criterion()
         // loop owned and ghost triangles
         for (int iTri = 0; iTri < nTriAll; iTri++) {
 
-          const std::vector<int> & neighborList = meshNeighlist->get_contact_list(iTri);
-          const int numneigh = neighborList.size();
+          const int * neighborList;
+          const int numneigh = meshNeighlist->get_contact_list(iTri,neighborList);
 
           for (int iCont = 0; iCont < numneigh; iCont++) {
 
@@ -1508,8 +1508,8 @@ void FixBreakParticle::pre_insert()
             std::map<int,std::set<int> > contacting_triangles; // atom_tag, triangle
             // loop owned and ghost triangles
             for (int iTri = 0; iTri < nTriAll; iTri++) {
-              const std::vector<int> & neighborList = meshNeighlist->get_contact_list(iTri);
-              const int numneigh = neighborList.size();
+              const int * neighborList;
+              const int numneigh = meshNeighlist->get_contact_list(iTri,neighborList);
               for (int iCont = 0; iCont < numneigh; iCont++) {
                 const int iPart = neighborList[iCont];
 
@@ -59,7 +59,10 @@ FixContactHistory::FixContactHistory(LAMMPS *lmp, int narg, char **arg) :
   pgsize_(0),
   oneatom_(0),
   ipage_(0),
-  dpage_(0)
+  dpage_(0),
+  hash_by_index_(false),
+  partner_hash_valid_(false),
+  time_hash_build_(0.)
 {
   restart_global = 1;
   restart_peratom = 1;
@@ -111,6 +114,16 @@ FixContactHistory::FixContactHistory(LAMMPS *lmp, int narg, char **arg) :
   if(!strstr(style,"property") && strcmp(style,"contacthistory"))
     return;
 
+  // global vector: # of hashed contacts, time spent building the hash
+  //NP only for the history of the pair style, derived classes do not expose it
+  if(0 == strcmp(style,"contacthistory"))
+  {
+    vector_flag = 1;
+    size_vector = 2;
+    global_freq = 1;
+    extvector = 0;
+  }
+
   // parse args
   if(narg < 6)
     error->fix_error(FLERR,this,"not enough parameters");
@@ -386,6 +399,35 @@ void FixContactHistory::pre_exchange()
   if(nlocal > 0) maxtouch_ = *std::max_element(npartner_, npartner_+nlocal);
 
   comm->maxexchange_fix = MAX(comm->maxexchange_fix,(dnum_+1)*maxtouch_+1);
+
+  // hash (tag, partner tag) so the next neighbor list build can look up
+  // the history of a pair in O(1)
+  //NP hash stays valid during exchange since owner is identified by tag
+
+  double time_start = MPI_Wtime();
+
+  int ncontacts = 0;
+  for (i = 0; i < nlocal; i++)
+    ncontacts += npartner_[i];
+
+  partner_hash_.clear();
+  partner_hash_.reserve(ncontacts);
+  for (i = 0; i < nlocal; i++)
+    hash_partners(i);
+  partner_hash_valid_ = true;
+
+  time_hash_build_ += MPI_Wtime() - time_start;
+}
+
+/* ----------------------------------------------------------------------
+   add partners of atom i to the hash
+------------------------------------------------------------------------- */
+
+void FixContactHistory::hash_partners(int i)
+{
+  const int owner = hash_by_index_ ? i : atom->tag[i];
+  for (int m = 0; m < npartner_[i]; m++)
+    partner_hash_.insert(ContactHistoryHash::key(owner,partner_[i][m]),m);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -420,6 +462,8 @@ double FixContactHistory::memory_usage()
     bytes += dpage_[i].size();
   }
 
+  bytes += partner_hash_.memory_usage();
+
   return bytes;
 }
 
@@ -453,6 +497,10 @@ void FixContactHistory::copy_arrays(int i, int j, int delflag)
   npartner_[j] = npartner_[i];
   partner_[j] = partner_[i];
   contacthistory_[j] = contacthistory_[i];
+
+  // hash entries of i refer to local index, cannot be kept
+  if(hash_by_index_)
+    partner_hash_valid_ = false;
 }
 
 /* ----------------------------------------------------------------------
@@ -507,6 +555,10 @@ int FixContactHistory::unpack_exchange(int nlocal, double *buf)
       contacthistory_[nlocal][n*dnum_+d] = buf[m++];
     }
   }
+
+  if(partner_hash_valid_)
+    hash_partners(nlocal);
+
   return m;
 }
 
@@ -597,6 +649,9 @@ void FixContactHistory::unpack_restart(int nlocal, int nth)
       contacthistory_[nlocal][n*dnum_+d] = extra[nlocal][m++];
     }
   }
+
+  if(partner_hash_valid_)
+    hash_partners(nlocal);
 }
 
 /* ----------------------------------------------------------------------
@@ -620,3 +675,21 @@ int FixContactHistory::size_restart(int nlocal)
 {
   return (dnum_+1)*npartner_[nlocal] + 2;
 }
+
+/* ----------------------------------------------------------------------
+   # of contacts in hash (sum over procs) and
+   time spent building the hash (max over procs)
+------------------------------------------------------------------------- */
+
+double FixContactHistory::compute_vector(int n)
+{
+  double value = 0.;
+  if(0 == n)
+    value = static_cast<double>(partner_hash_.size());
+  else
+    value = time_hash_build_;
+
+  double value_all = 0.;
+  MPI_Allreduce(&value,&value_all,1,MPI_DOUBLE,(0 == n) ? MPI_SUM : MPI_MAX,world);
+  return value_all;
+}
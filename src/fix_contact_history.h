@@ -31,7 +31,9 @@ FixStyle(contacthistory,FixContactHistory) //NP for use by pair Style Neigh clas
 #define LMP_FIX_CONTACT_HISTORY_H
 
 #include "fix.h"
+#include "atom.h"
 #include "my_page.h"
+#include "contact_history_hash.h"
 #include "vector_liggghts.h"
 
 namespace LAMMPS_NS {
@@ -64,6 +66,7 @@ class FixContactHistory : public Fix {
   virtual void unpack_restart(int, int);
   int size_restart(int);
   int maxsize_restart();
+  double compute_vector(int n);
 
   // inline access
   inline int n_partner(int i)
@@ -78,6 +81,25 @@ class FixContactHistory : public Fix {
   inline double* contacthistory(int i,int j)
   { return &(contacthistory_[i][j*dnum_]); }
 
+  // index of partner with tag partner_tag in the lists of atom i, -1 if none
+  //NP O(1) via hash as long as the hash is in sync with the partner lists,
+  //NP linear search otherwise
+  inline int find_partner(int i,int partner_tag)
+  {
+      if(partner_hash_valid_)
+      {
+          const int m = partner_hash_.find(ContactHistoryHash::key(hash_by_index_ ? i : atom->tag[i],partner_tag));
+          if(m >= 0 && m < npartner_[i] && partner_tag == partner_[i][m])
+              return m;
+          return -1;
+      }
+
+      for(int m = 0; m < npartner_[i]; m++)
+          if(partner_tag == partner_[i][m])
+              return m;
+      return -1;
+  }
+
  protected:
 
   int iarg_;
@@ -100,7 +122,16 @@ class FixContactHistory : public Fix {
   MyPage<int> *ipage_;           // pages of partner atom IDs
   MyPage<double> *dpage_;        // pages of shear history with partners
 
+  // hash (owner,partner tag) -> index in partner lists
+  //NP owner is the atom tag, or the local index if hash_by_index_ is set
+  //NP partner_hash_valid_ = false means the hash is not maintained
+  ContactHistoryHash partner_hash_;
+  bool hash_by_index_;
+  bool partner_hash_valid_;
+  double time_hash_build_;       // accumulated time to build the hash
+
   virtual void allocate_pages();
+  void hash_partners(int i);
 };
 
 }
@@ -70,6 +70,9 @@ FixContactHistoryMesh::FixContactHistoryMesh(LAMMPS *lmp, int narg, char **arg)
 
   swap_ = new double[dnum_];
 
+  //NP pre_force() only re-sorts the history of owned particles
+  comm_overlap = 1;
+
   // initial allocation of delflag
   keepflag_ = (bool **) memory->srealloc(keepflag_,atom->nmax*sizeof(bool *),
                                       "contact_history:keepflag");
@@ -60,6 +60,10 @@ FixContactPropertyAtom::FixContactPropertyAtom(LAMMPS *lmp, int narg, char **arg
   build_neighlist_(true),
   reset_each_ts_(true)
 {
+    // partners are stored for owned and ghost atoms, the tag of a ghost
+    // may equal that of an owned atom, so hash by local index
+    hash_by_index_ = true;
+
     bool hasargs = true;
     while(iarg_ < narg && hasargs)
     {
@@ -220,6 +224,8 @@ void FixContactPropertyAtom::clear()
 
     // reset number of partners every time-step
     vectorZeroizeN(npartner_,nall);
+    partner_hash_.clear();
+    partner_hash_valid_ = true;
 
     // other stuff to do only upon neigh list rebuild
     if(!build_neighlist_)
@@ -337,6 +343,9 @@ int FixContactPropertyAtom::unpack_exchange(int nlocal, double *buf)
     }
   }
 
+  if(partner_hash_valid_)
+    hash_partners(nlocal);
+
   /*
   for (int n = npartner_[nlocal]; n < nneighs; n++) {
     partner_[nlocal][n] = -1;
@@ -398,6 +407,8 @@ void FixContactPropertyAtom::unpack_comm(int n, int first, double *buf)
                   contacthistory_[i][np*dnum_+d] = buf[m++];
                }
            }
+           if(partner_hash_valid_)
+               hash_partners(i);
       }
 }
 
@@ -438,6 +449,9 @@ void FixContactPropertyAtom::unpack_restart(int nlocal, int nth)
 
     }
   }
+
+  if(partner_hash_valid_)
+    hash_partners(nlocal);
 }
 
 /* ----------------------------------------------------------------------
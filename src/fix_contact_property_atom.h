@@ -85,19 +85,13 @@ class FixContactPropertyAtom : public FixContactHistory {
 
   inline int has_partner(int i,int partner_id)
   {
-      for(int ip = 0; ip < npartner_[i]; ip++)
-      {
-          if(partner_id == partner_[i][ip])
-          {
-
-            return ip;
-          }
-      }
-      return -1;
+      return find_partner(i,partner_id);
   }
 
   void add_partner(int i, int partner_id, const double * const history)
   {
+      if(partner_hash_valid_)
+          partner_hash_.insert(ContactHistoryHash::key(i,partner_id),npartner_[i]);
 
       partner_[i][npartner_[i]] = partner_id;
       vectorCopyN(history,&(contacthistory_[i][npartner_[i]*dnum_]),dnum_);
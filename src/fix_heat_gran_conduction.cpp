@@ -32,6 +32,7 @@
 #include "modify.h"
 #include "neigh_list.h"
 #include "pair_gran.h"
+#include "update.h"
 
 using namespace LAMMPS_NS;
 using namespace FixConst;
@@ -52,7 +53,9 @@ FixHeatGranCond::FixHeatGranCond(class LAMMPS *lmp, int narg, char **arg) :
   area_calculation_mode_(CONDUCTION_CONTACT_AREA_OVERLAP),
   fixed_contact_area_(0.),
   area_correction_flag_(0),
-  deltan_ratio_(0)
+  deltan_ratio_(0),
+  fused_flag_(false),
+  fused_step_(-1)
 {
   iarg_ = 5;
 
@@ -88,6 +91,15 @@ FixHeatGranCond::FixHeatGranCond(class LAMMPS *lmp, int narg, char **arg) :
       else error->fix_error(FLERR,this,"expecting 'yes' or 'no' after 'area_correction'");
       iarg_ += 2;
       hasargs = true;
+    } else if(strcmp(arg[iarg_],"fused") == 0) {
+      if (iarg_+2 > narg) error->fix_error(FLERR,this,"not enough arguments for keyword 'fused'");
+      if(strcmp(arg[iarg_+1],"yes") == 0)
+        fused_flag_ = true;
+      else if(strcmp(arg[iarg_+1],"no") == 0)
+        fused_flag_ = false;
+      else error->fix_error(FLERR,this,"expecting 'yes' or 'no' after 'fused'");
+      iarg_ += 2;
+      hasargs = true;
     } else if(strcmp(style,"heat/gran/conduction") == 0)
         error->fix_error(FLERR,this,"unknown keyword");
   }
@@ -121,6 +133,15 @@ void FixHeatGranCond::pre_delete(bool unfixflag)
   // tell cpl that this fix is deleted
   if(cpl && unfixflag) cpl->reference_deleted();
 
+  // stop the pair pass from calling back
+  // force is already destroyed if the fix is deleted at shutdown
+  if(force)
+  {
+    PairGran *pg = static_cast<PairGran*>(force->pair_match("gran",0));
+    if(pg && pg->contact_hook() == this)
+      pg->unregister_contact_hook(this);
+  }
+
 }
 
 /* ---------------------------------------------------------------------- */
@@ -195,6 +216,16 @@ void FixHeatGranCond::init()
   //NP Get pointer to all the fixes (also those that have the material properties)
   updatePtrs();
 
+  if(fused_flag_)
+  {
+    if(strstr(force->pair_style,"hybrid"))
+        error->fix_error(FLERR,this,"'fused yes' does not work with pair style hybrid");
+    if(atom->superquadric_flag)
+        error->fix_error(FLERR,this,"'fused yes' is not available for superquadric particles");
+    pair_gran->register_contact_hook(this);
+    fused_step_ = -1;
+  }
+
   // error checks on coarsegraining
   if(force->cg_active())
     error->cg(FLERR,this->style);
@@ -204,6 +235,17 @@ void FixHeatGranCond::init()
 
 void FixHeatGranCond::post_force(int vflag)
 {
+  //NP fluxes were already added in the pair pass of this step,
+  //NP only the ghost contributions are left
+  if(fused_flag_ && fused_step_ == update->ntimestep)
+  {
+    if(force->newton_pair)
+    {
+      fix_heatFlux->do_reverse_comm();
+      fix_directionalHeatFlux->do_reverse_comm();
+    }
+    return;
+  }
 
   if(history_flag == 0 && CONDUCTION_CONTACT_AREA_OVERLAP == area_calculation_mode_)
     post_force_eval<0,CONDUCTION_CONTACT_AREA_OVERLAP>(vflag,0);
@@ -243,15 +285,114 @@ void FixHeatGranCond::cpl_evaluate(ComputePairGranLocal *caller)
     post_force_eval<1,CONDUCTION_CONTACT_AREA_PROJECTION>(0,1);
 }
 
+/* ----------------------------------------------------------------------
+   fused mode: the pair pass hands out its contacts, so no own walk
+   over the neighbor list is needed in post_force()
+   no fluxes in setup(), same as without fused mode
+------------------------------------------------------------------------- */
+
+bool FixHeatGranCond::begin_contact_pass()
+{
+  if(update->setupflag) return false;
+
+  //NP update because re-allocation might have taken place
+  updatePtrs();
+
+  fused_step_ = update->ntimestep;
+  return true;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixHeatGranCond::add_contact(const LIGGGHTS::ContactModels::CollisionData & cdata)
+{
+  const int i = cdata.i;
+  const int j = cdata.j;
+  int *mask = atom->mask;
+
+  if (!(mask[i] & groupbit) && !(mask[j] & groupbit)) return;
+
+  if(CONDUCTION_CONTACT_AREA_OVERLAP == area_calculation_mode_)
+    add_flux<CONDUCTION_CONTACT_AREA_OVERLAP>(i,j,cdata.delta[0],cdata.delta[1],cdata.delta[2],cdata.r,cdata.radi,cdata.radj,cdata.radsum,0);
+  else if(CONDUCTION_CONTACT_AREA_CONSTANT == area_calculation_mode_)
+    add_flux<CONDUCTION_CONTACT_AREA_CONSTANT>(i,j,cdata.delta[0],cdata.delta[1],cdata.delta[2],cdata.r,cdata.radi,cdata.radj,cdata.radsum,0);
+  else if(CONDUCTION_CONTACT_AREA_PROJECTION == area_calculation_mode_)
+    add_flux<CONDUCTION_CONTACT_AREA_PROJECTION>(i,j,cdata.delta[0],cdata.delta[1],cdata.delta[2],cdata.r,cdata.radi,cdata.radj,cdata.radsum,0);
+}
+
+/* ----------------------------------------------------------------------
+   heat flux of one pair in contact
+------------------------------------------------------------------------- */
+
+template <int CONTACTAREA>
+inline void FixHeatGranCond::add_flux(int i,int j,double delx,double dely,double delz,
+                                      double r,double radi,double radj,double radsum,int cpl_flag)
+{
+  double hc,contactArea,delta_n,flux,dirFlux[3],tcoi,tcoj;
+  int *type = atom->type;
+  const int nlocal = atom->nlocal;
+  const int newton_pair = force->newton_pair;
+
+  if(CONTACTAREA == CONDUCTION_CONTACT_AREA_OVERLAP)
+  {
+      //NP adjust overlap that may be superficially large due to softening
+      if(area_correction_flag_)
+      {
+        delta_n = radsum - r;
+        delta_n *= deltan_ratio_[type[i]-1][type[j]-1];
+        r = radsum - delta_n;
+      }
+
+      contactArea = - M_PI/4 * ( (r-radi-radj)*(r+radi-radj)*(r-radi+radj)*(r+radi+radj) )/(r*r); //contact area of the two spheres
+  }
+  else if (CONTACTAREA == CONDUCTION_CONTACT_AREA_CONSTANT)
+  {
+      contactArea = fixed_contact_area_;
+  }
+  else if (CONTACTAREA == CONDUCTION_CONTACT_AREA_PROJECTION)
+  {
+      double rmax = MathExtraLiggghts::max(radi,radj);
+      contactArea = M_PI*rmax*rmax;
+  }
+
+  tcoi = conductivity_[type[i]-1];
+  tcoj = conductivity_[type[j]-1];
+  if (tcoi < SMALL || tcoj < SMALL) hc = 0.;
+  else hc = 4.*tcoi*tcoj/(tcoi+tcoj)*sqrt(contactArea);
+
+  flux = (Temp[j]-Temp[i])*hc;
+
+  dirFlux[0] = flux*delx;
+  dirFlux[1] = flux*dely;
+  dirFlux[2] = flux*delz;
+  if(!cpl_flag)
+  {
+    //Add half of the flux (located at the contact) to each particle in contact
+    heatFlux[i] += flux;
+    directionalHeatFlux[i][0] += 0.50 * dirFlux[0];
+    directionalHeatFlux[i][1] += 0.50 * dirFlux[1];
+    directionalHeatFlux[i][2] += 0.50 * dirFlux[2];
+    if (newton_pair || j < nlocal)
+    {
+      heatFlux[j] -= flux;
+      directionalHeatFlux[j][0] += 0.50 * dirFlux[0];
+      directionalHeatFlux[j][1] += 0.50 * dirFlux[1];
+      directionalHeatFlux[j][2] += 0.50 * dirFlux[2];
+    }
+
+  }
+
+  if(cpl_flag && cpl) cpl->add_heat(i,j,flux);
+}
+
 /* ---------------------------------------------------------------------- */
 
 template <int HISTFLAG,int CONTACTAREA>
 void FixHeatGranCond::post_force_eval(int vflag,int cpl_flag)
 {
-  double hc,contactArea,delta_n,flux,dirFlux[3];
   int i,j,ii,jj,inum,jnum;
   double xtmp,ytmp,ztmp,delx,dely,delz;
-  double radi,radj,radsum,rsq,r,tcoi,tcoj;
+  double radi,radj,radsum,rsq;
   int *ilist,*jlist,*numneigh,**firstneigh;
   int *touch,**firsttouch;
 
@@ -271,8 +412,6 @@ void FixHeatGranCond::post_force_eval(int vflag,int cpl_flag)
 
   double *radius = atom->radius;
   double **x = atom->x;
-  int *type = atom->type;
-  int nlocal = atom->nlocal;
   int *mask = atom->mask;
 
   //NP update because re-allocation might have taken place
@@ -319,58 +458,7 @@ void FixHeatGranCond::post_force_eval(int vflag,int cpl_flag)
           if(rsq >= radsum*radsum) continue;
         }
 
-        r = sqrt(rsq);
-
-        if(CONTACTAREA == CONDUCTION_CONTACT_AREA_OVERLAP)
-        {
-            //NP adjust overlap that may be superficially large due to softening
-            if(area_correction_flag_)
-            {
-              delta_n = radsum - r;
-              delta_n *= deltan_ratio_[type[i]-1][type[j]-1];
-              r = radsum - delta_n;
-            }
-
-            contactArea = - M_PI/4 * ( (r-radi-radj)*(r+radi-radj)*(r-radi+radj)*(r+radi+radj) )/(r*r); //contact area of the two spheres
-        }
-        else if (CONTACTAREA == CONDUCTION_CONTACT_AREA_CONSTANT)
-        {
-            contactArea = fixed_contact_area_;
-        }
-        else if (CONTACTAREA == CONDUCTION_CONTACT_AREA_PROJECTION)
-        {
-            double rmax = MathExtraLiggghts::max(radi,radj);
-            contactArea = M_PI*rmax*rmax;
-        }
-
-        tcoi = conductivity_[type[i]-1];
-        tcoj = conductivity_[type[j]-1];
-        if (tcoi < SMALL || tcoj < SMALL) hc = 0.;
-        else hc = 4.*tcoi*tcoj/(tcoi+tcoj)*sqrt(contactArea);
-
-        flux = (Temp[j]-Temp[i])*hc;
-
-        dirFlux[0] = flux*delx;
-        dirFlux[1] = flux*dely;
-        dirFlux[2] = flux*delz;
-        if(!cpl_flag)
-        {
-          //Add half of the flux (located at the contact) to each particle in contact
-          heatFlux[i] += flux;
-          directionalHeatFlux[i][0] += 0.50 * dirFlux[0];
-          directionalHeatFlux[i][1] += 0.50 * dirFlux[1];
-          directionalHeatFlux[i][2] += 0.50 * dirFlux[2];
-          if (newton_pair || j < nlocal)
-          {
-            heatFlux[j] -= flux;
-            directionalHeatFlux[j][0] += 0.50 * dirFlux[0];
-            directionalHeatFlux[j][1] += 0.50 * dirFlux[1];
-            directionalHeatFlux[j][2] += 0.50 * dirFlux[2];
-          }
-
-        }
-
-        if(cpl_flag && cpl) cpl->add_heat(i,j,flux);
+        add_flux<CONTACTAREA>(i,j,delx,dely,delz,sqrt(rsq),radi,radj,radsum,cpl_flag);
       }
     }
   }
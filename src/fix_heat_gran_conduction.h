@@ -30,10 +30,11 @@ FixStyle(heat/gran,FixHeatGranCond)
 #define LMP_FIX_HEATGRAN_CONDUCTION_H
 
 #include "fix_heat_gran.h"
+#include "contact_interface.h"
 
 namespace LAMMPS_NS {
 
-  class FixHeatGranCond : public FixHeatGran {
+  class FixHeatGranCond : public FixHeatGran, public LIGGGHTS::IContactHook {
   public:
     FixHeatGranCond(class LAMMPS *, int, char **);
     ~FixHeatGranCond();
@@ -48,11 +49,17 @@ namespace LAMMPS_NS {
     void register_compute_pair_local(ComputePairGranLocal *);
     void unregister_compute_pair_local(ComputePairGranLocal *);
 
+    // fused mode, called from the granular pair pass
+    bool begin_contact_pass();
+    void add_contact(const LIGGGHTS::ContactModels::CollisionData & cdata);
+
   protected:
     int iarg_;
 
   private:
     template <int,int> void post_force_eval(int,int);
+    template <int> inline void add_flux(int i,int j,double delx,double dely,double delz,
+                                        double r,double radi,double radj,double radsum,int cpl_flag);
 
     class FixPropertyGlobal* fix_conductivity_;
     double *conductivity_;
@@ -65,6 +72,10 @@ namespace LAMMPS_NS {
     // for heat transfer area correction
     int area_correction_flag_;
     double const* const* deltan_ratio_;
+
+    // evaluate fluxes in the pair pass instead of an own neighbor list walk
+    bool fused_flag_;
+    bigint fused_step_;
   };
 
 }
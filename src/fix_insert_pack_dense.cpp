@@ -35,6 +35,7 @@
 #include "modify.h"
 #include "error.h"
 #include "domain.h"
+#include "comm.h"
 #include "fix_particledistribution_discrete.h"
 #include "input.h"
 #include "random_park.h"
@@ -72,6 +73,9 @@ FixInsertPackDense::FixInsertPackDense(LAMMPS *lmp, int narg, char **arg) :
   seed(-1),
   insertion_done(false),
   is_inserter(true),
+  has_init_config(true),
+  seamless(false),
+  halo(0.),
   insert_every(0),
   n_inserted(0),
   n_inserted_local(0)
@@ -128,6 +132,13 @@ FixInsertPackDense::FixInsertPackDense(LAMMPS *lmp, int narg, char **arg) :
       var_threshold = atof(arg[iarg+3]);
       iarg += 4;
       hasargs = true;
+    } else if (strcmp(arg[iarg],"seamless") == 0) {
+      if (iarg+2 > narg) error->fix_error(FLERR,this,"");
+      if (strcmp(arg[iarg+1],"yes") == 0) seamless = true;
+      else if (strcmp(arg[iarg+1],"no") == 0) seamless = false;
+      else error->fix_error(FLERR,this,"expecting 'yes' or 'no' after 'seamless'");
+      iarg += 2;
+      hasargs = true;
     }
   }
 
@@ -179,11 +190,16 @@ void FixInsertPackDense::post_create()
   delete[] x_init;
   x_init = new double[3];
 
+  // without exchange, particles must not cross the subdomain borders
+  // with exchange, a proc inserts all particles with center in its
+  // subdomain, only the global borders are kept clear
   double sublo[3],subhi[3];
   double const insreg_cutoff = maxrad;
   for (int i=0; i<3; ++i) {
-    sublo[i] = domain->sublo[i]+insreg_cutoff;
-    subhi[i] = domain->subhi[i]-insreg_cutoff;
+    bool const inner_lo = seamless && comm->myloc[i] > 0;
+    bool const inner_hi = seamless && comm->myloc[i] < comm->procgrid[i]-1;
+    sublo[i] = domain->sublo[i] + (inner_lo ? 0. : insreg_cutoff);
+    subhi[i] = domain->subhi[i] - (inner_hi ? 0. : insreg_cutoff);
   }
 
   ins_bbox.shrinkToSubbox(sublo,subhi);
@@ -204,9 +220,13 @@ void FixInsertPackDense::post_create()
   init_config_bbox.shrinkToSubbox(sublo,subhi);
   init_config_bbox.getCenter(x_init);
 
-  if (!init_config_bbox.hasVolume()) {
-    // no insertion volume on this subdomain
-    is_inserter = false;
+  has_init_config = init_config_bbox.hasVolume();
+  is_inserter = seamless ? ins_bbox.hasVolume() : has_init_config;
+
+  if (!has_init_config) {
+    // no room for the initial spheres on this subdomain
+    // seamless packing still grows the front in from the neighbors
+    if (is_inserter) ins_bbox.getCenter(x_init);
   } else if (!init_config_bbox.isInside(x_init) ||
              !ins_region->match_shrinkby_cut(x_init, init_cutoff)) {
     bool const subdomain_flag(true);
@@ -261,27 +281,11 @@ void FixInsertPackDense::pre_exchange()
   }
 
   // insert first three particles to initialize the algorithm
-  if (prepared && is_inserter) {
+  if (seamless) {
+    pack_seamless(prepared);
+  } else if (prepared && is_inserter) {
     insert_first_particles();
-
-    // insert_next_particle() returns false
-    // if algorithm terminates
-    while(!frontSpheres.empty()) {
-      if (screen && !(fix_distribution->pti_list.size() == static_cast<FixParticledistributionDiscrete::pti_list_type::size_type>(n_inserted_local))) {
-        fprintf(screen, "pti_list.size() %lu | n_inserted_local %d\n",fix_distribution->pti_list.size(),n_inserted_local);
-      }
-      assert(fix_distribution->pti_list.size() == static_cast<FixParticledistributionDiscrete::pti_list_type::size_type>(n_inserted_local));
-      handle_next_front_sphere();
-
-      int const n_write = n_insert_estim_local/10;
-      int static n_next_write = n_write;
-      if (n_inserted_local > n_next_write) {
-        double percent = static_cast<double>(n_inserted_local)/static_cast<double>(n_insert_estim_local)*100;
-        if (screen) fprintf(screen,"process %d : %2.0f%% done, inserted %d/%d particles\n",
-                            comm->me,percent,n_inserted_local,n_insert_estim_local);
-        n_next_write += n_write;
-      }
-    }
+    advance_front();
   }
 
   // actual insertion
@@ -299,6 +303,11 @@ void FixInsertPackDense::pre_exchange()
 
   fix_distribution->finalize_insertion();
 
+  ownPresent.clear();
+  ownSpheres.clear();
+  haloSpheres.clear();
+  haloFront.clear();
+
   n_inserted = n_inserted_local;
   MPI_Sum_Scalar(n_inserted,world);
 
@@ -313,6 +322,127 @@ void FixInsertPackDense::pre_exchange()
 
 /* ---------------------------------------------------------------------- */
 
+void FixInsertPackDense::advance_front()
+{
+  while(!frontSpheres.empty()) {
+    if (screen && !(fix_distribution->pti_list.size() == static_cast<FixParticledistributionDiscrete::pti_list_type::size_type>(n_inserted_local))) {
+      fprintf(screen, "pti_list.size() %lu | n_inserted_local %d\n",fix_distribution->pti_list.size(),n_inserted_local);
+    }
+    assert(fix_distribution->pti_list.size() == static_cast<FixParticledistributionDiscrete::pti_list_type::size_type>(n_inserted_local));
+    handle_next_front_sphere();
+
+    int const n_write = n_insert_estim_local/10;
+    int static n_next_write = n_write;
+    if (n_inserted_local > n_next_write) {
+      double percent = static_cast<double>(n_inserted_local)/static_cast<double>(n_insert_estim_local)*100;
+      if (screen) fprintf(screen,"process %d : %2.0f%% done, inserted %d/%d particles\n",
+                          comm->me,percent,n_inserted_local,n_insert_estim_local);
+      n_next_write += n_write;
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   procs are colored by the parity of their location in the proc grid,
+   procs of one color are never adjacent and pack concurrently
+   before each of the 8 phases, spheres near the subdomain borders are
+   exchanged, so a proc continues the packing of its neighbors
+------------------------------------------------------------------------- */
+
+void FixInsertPackDense::pack_seamless(bool init)
+{
+  int color = 0;
+  for (int dim = 0; dim < 3; dim++)
+    color |= (comm->myloc[dim] % 2) << dim;
+
+  for (int phase = 0; phase < 8; phase++) {
+    exchange_halo();
+    if (phase != color || !is_inserter) continue;
+
+    for (size_t i = 0; i < haloSpheres.size(); i++) {
+      neighlist.insert(haloSpheres[i].x,haloSpheres[i].radius);
+      if (haloFront[i]) frontSpheres.push(haloSpheres[i]);
+    }
+    advance_front();
+
+    // nothing to continue from, start a front of our own
+    if (n_inserted_local == 0 && init) {
+      insert_first_particles();
+      advance_front();
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   same pattern as Comm::borders(): swap spheres within the halo with
+   the left and right neighbor in each dim, spheres received in earlier
+   dims are passed on so edge and corner neighbors are covered
+   no exchange across the global boundaries, the packing is not periodic
+------------------------------------------------------------------------- */
+
+void FixInsertPackDense::exchange_halo()
+{
+  haloSpheres.clear();
+  haloFront.clear();
+
+  std::vector<double> sendbuf,recvbuf;
+
+  for (int dim = 0; dim < 3; dim++) {
+    if (comm->procgrid[dim] == 1) continue;
+
+    int const nlast = haloSpheres.size();
+    for (int side = 0; side < 2; side++) {
+      sendbuf.clear();
+      if ((side == 0 && comm->myloc[dim] > 0) ||
+          (side == 1 && comm->myloc[dim] < comm->procgrid[dim]-1)) {
+        pack_halo(ownPresent,ownPresent.size(),NULL,false,dim,side,sendbuf);
+        pack_halo(ownSpheres,ownSpheres.size(),NULL,true,dim,side,sendbuf);
+        pack_halo(haloSpheres,nlast,haloFront.data(),false,dim,side,sendbuf);
+      }
+
+      int nsend = sendbuf.size();
+      int nrecv = 0;
+      MPI_Sendrecv(&nsend,1,MPI_INT,comm->procneigh[dim][side],0,
+                   &nrecv,1,MPI_INT,comm->procneigh[dim][1-side],0,
+                   world,MPI_STATUS_IGNORE);
+      recvbuf.resize(nrecv);
+      MPI_Sendrecv(sendbuf.data(),nsend,MPI_DOUBLE,comm->procneigh[dim][side],0,
+                   recvbuf.data(),nrecv,MPI_DOUBLE,comm->procneigh[dim][1-side],0,
+                   world,MPI_STATUS_IGNORE);
+
+      for (int i = 0; i < nrecv; i += 5) {
+        haloSpheres.push_back(Particle(&recvbuf[i],recvbuf[i+3]));
+        haloFront.push_back(recvbuf[i+4] > 0.5);
+      }
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   append first n spheres within the halo of the left (side = 0) or
+   right (side = 1) subdomain border in dim as x,y,z,radius,front
+   front flags are taken per sphere, or seed is used if front is NULL
+   only inserted spheres seed the front of the receiver, present atoms not
+------------------------------------------------------------------------- */
+
+void FixInsertPackDense::pack_halo(ParticleVector const &spheres, int n,
+                                   char const *front, bool seed,
+                                   int dim, int side, std::vector<double> &buf)
+{
+  for (int i = 0; i < n; i++) {
+    Particle const &p = spheres[i];
+    if (side == 0 && p.x[dim] >= domain->sublo[dim]+halo) continue;
+    if (side == 1 && p.x[dim] < domain->subhi[dim]-halo) continue;
+    buf.push_back(p.x[0]);
+    buf.push_back(p.x[1]);
+    buf.push_back(p.x[2]);
+    buf.push_back(p.radius);
+    buf.push_back((front ? front[i] : seed) ? 1. : 0.);
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
 bool FixInsertPackDense::prepare_insertion()
 {
   /*
@@ -324,26 +454,57 @@ bool FixInsertPackDense::prepare_insertion()
   // particles into region neighbor list with now appropriate bin size
   double volume_present_local = 0.;
 
-  neighlist.reset();
-  neighlist.setBoundingBox(ins_bbox,fix_distribution->max_rad()*radius_factor);
-  distfield.reset();
-
-  if (is_inserter) {
-    double rad_max_present = 0.;
+  double rad_max_present = 0.;
+  if (is_inserter || seamless) {
     for(int i=0;i<atom->nlocal;i++){
       if (ins_region->match_expandby_cut(atom->x[i],atom->radius[i])) {
         if(atom->radius[i] > rad_max_present) rad_max_present = atom->radius[i];
       }
     }
+  }
+
+  // the halo holds all spheres a particle with center in the
+  // subdomain can touch, neighbor lists are extended accordingly
+  // across the inner subdomain borders, nothing comes in at the
+  // global ones, so a single proc packs the same as without seamless
+  BoundingBox neigh_bbox = ins_bbox;
+  if (seamless) {
+    MPI_Max_Scalar(rad_max_present,world);
+    halo = maxrad + std::max(maxrad,rad_max_present);
+
+    double neighlo[3],neighhi[3];
+    ins_bbox.getBoxBounds(neighlo,neighhi);
+    for (int dim = 0; dim < 3; dim++) {
+      if (comm->myloc[dim] > 0) neighlo[dim] -= halo;
+      if (comm->myloc[dim] < comm->procgrid[dim]-1) neighhi[dim] += halo;
+    }
+    neigh_bbox = BoundingBox(neighlo[0],neighhi[0],neighlo[1],neighhi[1],neighlo[2],neighhi[2]);
+
+    int narrow = 0;
+    for (int dim = 0; dim < 3; dim++)
+      if (comm->procgrid[dim] > 1 && domain->subhi[dim]-domain->sublo[dim] < halo)
+        narrow = 1;
+    MPI_Max_Scalar(narrow,world);
+    if (narrow)
+      error->all(FLERR,"Fix insert/pack/dense seamless requires subdomains wider than the halo");
+  }
 
-    if (rad_max_present > fix_distribution->max_rad()) {
+  neighlist.reset();
+  neighlist.setBoundingBox(neigh_bbox,fix_distribution->max_rad()*radius_factor);
+  distfield.reset();
+  ownPresent.clear();
+  ownSpheres.clear();
+
+  if (is_inserter || seamless) {
+    if (is_inserter && rad_max_present > fix_distribution->max_rad()) {
       neighlist.reset();
-      neighlist.setBoundingBox(ins_bbox,rad_max_present*radius_factor);
+      neighlist.setBoundingBox(neigh_bbox,rad_max_present*radius_factor);
     }
 
     for (int i=0;i<atom->nlocal;i++) {
       if (ins_region->match_expandby_cut(atom->x[i],atom->radius[i])) {
-        neighlist.insert(atom->x[i],atom->radius[i]);
+        if (is_inserter) neighlist.insert(atom->x[i],atom->radius[i]);
+        if (seamless) ownPresent.push_back(Particle(atom->x[i],atom->radius[i]));
         volume_present_local += MathConst::MY_4PI3*atom->radius[i]*atom->radius[i]*atom->radius[i];
       }
     }
@@ -368,6 +529,12 @@ bool FixInsertPackDense::prepare_insertion()
 
   n_insert_estim_local = floor((region_volume_local-volume_present_local)*target_volfrac/v_part_ave);
 
+  // calculate distance field
+  distfield.build(ins_region,ins_bbox,fix_distribution->max_rad()*radius_factor);
+
+  // seamless packing may only grow the front in from the neighbors
+  if (!has_init_config) return false;
+
   // check if starting point does not conflict with any pre-existing particles
   double const maxrad_init = 2.155*maxrad;
   if (neighlist.hasOverlap(x_init,maxrad_init)) {
@@ -386,9 +553,6 @@ bool FixInsertPackDense::prepare_insertion()
     }
   }
 
-  // calculate distance field
-  distfield.build(ins_region,ins_bbox,fix_distribution->max_rad()*radius_factor);
-
   return true;
 }
 
@@ -422,6 +586,12 @@ void FixInsertPackDense::insert_first_particles()
   frontSpheres.push(p2);
   frontSpheres.push(p3);
 
+  if (seamless) {
+    ownSpheres.push_back(p1);
+    ownSpheres.push_back(p2);
+    ownSpheres.push_back(p3);
+  }
+
   n_inserted_local += 3;
 }
 
@@ -467,6 +637,7 @@ void FixInsertPackDense::handle_next_front_sphere()
     fix_distribution->pti_list.push_back(pti);
     frontSpheres.push(*closest_candidate);
     neighlist.insert((*closest_candidate).x,(*closest_candidate).radius);
+    if (seamless) ownSpheres.push_back(*closest_candidate);
     n_inserted_local++;
 
   } while(candidatePoints.size() > 1);
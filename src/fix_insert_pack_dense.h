@@ -35,6 +35,7 @@ FixStyle(insert/pack/dense,FixInsertPackDense)
 #include "fix.h"
 
 #include <queue>
+#include <vector>
 
 #include "region_neighbor_list.h"
 #include "region_distance_field.h"
@@ -95,6 +96,16 @@ protected:
 
   bool insertion_done;
   bool is_inserter; // indicates if proc inserts
+  bool has_init_config; // indicates if proc can place the initial spheres
+
+  // seamless parallel packing: procs pack one after another in
+  // 8 colored phases and exchange spheres near their borders
+  bool seamless;
+  double halo;                  // width of the exchanged border layer
+  ParticleVector ownPresent;    // local atoms present before insertion
+  ParticleVector ownSpheres;    // spheres inserted by this proc
+  ParticleVector haloSpheres;   // spheres of neighbor procs
+  std::vector<char> haloFront;  // 1 if halo sphere seeds the front
   double region_volume, region_volume_local;
   int n_insert_estim, n_insert_estim_local;
   int insert_every, most_recent_ins_step;
@@ -106,6 +117,12 @@ protected:
   bool insert_next_particle(); // returns false if no insertion possible
 
   void handle_next_front_sphere();
+  void advance_front();
+
+  void pack_seamless(bool init);
+  void exchange_halo();
+  void pack_halo(ParticleVector const &spheres, int n, char const *front,
+                 bool seed, int dim, int side, std::vector<double> &buf);
 
   void compute_and_append_candidate_points(Particle const &p1,
                                            Particle const &p2,
@@ -128,3 +145,13 @@ protected:
 
 #endif /* FIX_INSERT_PACK_DENSE */
 #endif /* FIX_CLASS */
+
+/* ERROR/WARNING messages:
+
+E: Fix insert/pack/dense seamless requires subdomains wider than the halo
+
+Procs only exchange spheres with their direct neighbors, so each
+subdomain must be wider than twice the largest particle radius.
+Use fewer procs or larger particles.
+
+*/
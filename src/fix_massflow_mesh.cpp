@@ -389,8 +389,8 @@ void FixMassflowMesh::post_integrate()
         //NP    TODO.... maybe some particles are double-counted if they are in the
         //NP    neighlist multiple times (for different triangles)?? (for case multiple)
 
-        const std::vector<int> & neighborList = fix_neighlist_->get_contact_list(iTri);
-        const int numneigh = neighborList.size();
+        const int * neighborList;
+        const int numneigh = fix_neighlist_->get_contact_list(iTri,neighborList);
         for(int iNeigh = 0; iNeigh < numneigh; iNeigh++)
         {
             const int iPart = neighborList[iNeigh];
@@ -73,6 +73,9 @@ FixMesh::FixMesh(LAMMPS *lmp, int narg, char **arg)
     force_reneighbor = 1;
     next_reneighbor = -1;
 
+    //NP pre_force() only communicates and resets mesh data
+    comm_overlap = 1;
+
     // parse args
 
     iarg_ = 3;
@@ -57,7 +57,8 @@ FixMeshSurface::FixMeshSurface(LAMMPS *lmp, int narg, char **arg)
   angVelFlag_(false),
   n_dump_active_(0),
   curvature_(0.),
-  curvature_tolerant_(false)
+  curvature_tolerant_(false),
+  incremental_neighlist_(false)
 {
     // check if type has been read
     if(atom_type_mesh_ == -1)
@@ -118,6 +119,18 @@ FixMeshSurface::FixMeshSurface(LAMMPS *lmp, int narg, char **arg)
             error->fix_error(FLERR,this,"expecting 'yes' or 'no' after 'curvature_tolerant'");
           iarg_++;
           hasargs = true;
+      } else if (strcmp(arg[iarg_],"incremental_neighlist") == 0) {
+          if (narg < iarg_+2)
+            error->fix_error(FLERR,this,"not enough arguments for 'incremental_neighlist'");
+          iarg_++;
+          if(0 == strcmp(arg[iarg_],"yes"))
+            incremental_neighlist_ = true;
+          else if(0 == strcmp(arg[iarg_],"no"))
+            incremental_neighlist_ = false;
+          else
+            error->fix_error(FLERR,this,"expecting 'yes' or 'no' after 'incremental_neighlist'");
+          iarg_++;
+          hasargs = true;
       } else if(strcmp(style,"mesh/surface") == 0) {
           char *errmsg = new char[strlen(arg[iarg_])+50];
           sprintf(errmsg,"unknown keyword or wrong keyword order: %s", arg[iarg_]);
@@ -231,12 +244,14 @@ void FixMeshSurface::createWallNeighList(int igrp)
     char *neighlist_name = new char[strlen(id)+1+20];
     sprintf(neighlist_name,"wall_neighlist_%s",id);
 
-    const char *fixarg[4];
+    const char *fixarg[6];
     fixarg[0]= neighlist_name;
     fixarg[1]= "all";
     fixarg[2]= "neighlist/mesh";
     fixarg[3]= id;
-    modify->add_fix(4,const_cast<char**>(fixarg));
+    fixarg[4]= "incremental";
+    fixarg[5]= incremental_neighlist_ ? "yes" : "no";
+    modify->add_fix(6,const_cast<char**>(fixarg));
 
     fix_mesh_neighlist_ =
         static_cast<FixNeighlistMesh*>(modify->find_fix_id(neighlist_name));
@@ -277,12 +292,14 @@ class FixNeighlistMesh* FixMeshSurface::createOtherNeighList(int igrp,const char
     char *neighlist_name = new char[strlen(id)+1+20+strlen(nId)+1];
     sprintf(neighlist_name,"neighlist_%s_%s",nId,id);
 
-    const char *fixarg[4];
+    const char *fixarg[6];
     fixarg[0]= neighlist_name;
     fixarg[1]= "all";
     fixarg[2]= "neighlist/mesh";
     fixarg[3]= id;
-    modify->add_fix(4,const_cast<char**>(fixarg));
+    fixarg[4]= "incremental";
+    fixarg[5]= incremental_neighlist_ ? "yes" : "no";
+    modify->add_fix(6,const_cast<char**>(fixarg));
 
     neighlist =
         static_cast<FixNeighlistMesh*>(modify->find_fix_id(neighlist_name));
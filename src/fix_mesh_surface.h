@@ -134,6 +134,9 @@ namespace LAMMPS_NS
         // mesh curvature
         double curvature_;
         bool curvature_tolerant_;
+
+        // neighbor lists of this mesh are built incrementally
+        bool incremental_neighlist_;
   };
 
 } /* namespace LAMMPS_NS */
@@ -87,15 +87,9 @@ FixMultisphere::FixMultisphere(LAMMPS *lmp, int narg, char **arg) :
   grow_arrays(atom->nmax);
 
   //NP make an exclusion by molecule id;only particles in the fix rigid group are included
-  char **modarg;
-  modarg = new char*[3];
-  modarg[2] = new char[50];
-  modarg[0] = (char*) "exclude";
-  modarg[1] = (char*) "molecule";
-  strcpy(modarg[2],arg[1]);
-  neighbor->modify_params(3,modarg);
-  delete [] modarg[2];
-  delete []modarg;
+  //NP molecule id is the body tag, granular neighbor lists reject pairs
+  //NP within one body before any other test
+  neighbor->exclude_body(groupbit);
 
   //NP per atom creation and restart
   restart_global = 1;
@@ -127,10 +121,11 @@ FixMultisphere::FixMultisphere(LAMMPS *lmp, int narg, char **arg) :
   global_freq = 1;
   extarray = 0;
 
-  //NP max # comm for case f, torque, flag
+  //NP max # comm per atom for case f, torque, flag
+  //NP also covers the combined body, image, displace
   comm_forward = 7;
 
-  //NP max # comm for case pos, vel, omega, flag
+  //NP max # comm per atom for case pos, vel, omega, flag
   comm_reverse = 10;
 }
 
@@ -141,6 +136,8 @@ FixMultisphere::~FixMultisphere()
     atom->delete_callback(id,0);
     atom->delete_callback(id,1);
 
+    if (neighbor) neighbor->exclude_body(0);
+
     delete &multisphere_;
 
     memory->destroy(displace_);
@@ -1034,7 +1031,9 @@ void FixMultisphere::pre_neighbor()
     //NP since can change only at processor exchange
 
     //NP communicate body first, since needed for check_lost_atoms()
-    fw_comm_flag_ = MS_COMM_FW_BODY;
+    //NP image and displace travel in the same exchange, they are
+    //NP not touched by the removal of bodies below
+    fw_comm_flag_ = MS_COMM_FW_BODY | MS_COMM_FW_IMAGE_DISPLACE;
     forward_comm();
 
     //NP callback to fix remove
@@ -1053,10 +1052,6 @@ void FixMultisphere::pre_neighbor()
 
     //NP   need reverse comm of atom image flag since
     //NP   changed on ghosts by remap_bodies
-    //NP fw comm image and displace
-    //NP note that image has changed due to remap_bodies() call
-    fw_comm_flag_ = MS_COMM_FW_IMAGE_DISPLACE;
-    forward_comm();
     multisphere_.remap_bodies(body_);
     rev_comm_flag_ = MS_COMM_REV_IMAGE;
     reverse_comm();
@@ -1090,8 +1085,9 @@ void FixMultisphere::pre_neighbor()
     /*NL*/ //if (screen) fprintf(screen,"sum pre %f nlocal %d\n",sum,atom->nlocal);
 
     //NP need to send deletion flag from ghosts to owners
-    fix_delflag_->do_reverse_comm();
-    fix_existflag_->do_reverse_comm();
+    //NP both flags in one exchange
+    rev_comm_flag_ = MS_COMM_REV_DEL_EXIST;
+    reverse_comm();
 
     /*NL*/ //sum = vectorSumN(existflag,atom->nlocal);
     /*NL*/ //if (screen) fprintf(screen,"sum post %f nlocal %d\n",sum,atom->nlocal);
@@ -1102,13 +1098,15 @@ void FixMultisphere::pre_neighbor()
     forward_comm();
 
     // merge delflag and existflag
+    //NP flags are summed over all copies of an atom, so an atom
+    //NP flagged on several of its ghosts has delflag > 1
 
     int nlocal = atom->nlocal;
     delflag =   fix_delflag_->vector_atom;
     existflag = fix_existflag_->vector_atom;
     for(int i = 0; i < nlocal; i++)
     {
-            delflag[i] = (round(existflag[i]) == 0) ? 1. : delflag[i];
+            delflag[i] = (round(existflag[i]) == 0 || round(delflag[i]) >= 1.) ? 1. : 0.;
     }
 }
 
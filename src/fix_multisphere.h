@@ -39,16 +39,19 @@ FixStyle(multisphere/nointegration,FixMultisphere)
 
 namespace LAMMPS_NS {
 
+// comm plan: flags can be or'ed to pack several quantities into one
+// exchange, comm_forward and comm_reverse cover the largest plan used
 enum
 {
-    MS_COMM_UNDEFINED,
-    MS_COMM_FW_BODY,
-    MS_COMM_FW_IMAGE_DISPLACE,
-    MS_COMM_FW_V_OMEGA,
-    MS_COMM_FW_F_TORQUE,
-    MS_COMM_REV_X_V_OMEGA,
-    MS_COMM_REV_V_OMEGA,
-    MS_COMM_REV_IMAGE
+    MS_COMM_UNDEFINED = 0,
+    MS_COMM_FW_BODY = 1 << 0,
+    MS_COMM_FW_IMAGE_DISPLACE = 1 << 1,
+    MS_COMM_FW_V_OMEGA = 1 << 2,
+    MS_COMM_FW_F_TORQUE = 1 << 3,
+    MS_COMM_REV_X_V_OMEGA = 1 << 4,
+    MS_COMM_REV_V_OMEGA = 1 << 5,
+    MS_COMM_REV_IMAGE = 1 << 6,
+    MS_COMM_REV_DEL_EXIST = 1 << 7
 };
 
 class FixMultisphere : public Fix
@@ -104,19 +107,21 @@ class FixMultisphere : public Fix
       int pack_comm_v_omega(int, int*, double*, int, int*);
       int pack_comm_f_torque(int, int*, double*, int, int*);
       void unpack_comm(int, int, double*);
-      void unpack_comm_body(int, int, double*);
-      void unpack_comm_image_displace(int, int, double*);
-      void unpack_comm_v_omega(int, int, double*);
-      void unpack_comm_f_torque(int, int, double*);
+      int unpack_comm_body(int, int, double*);
+      int unpack_comm_image_displace(int, int, double*);
+      int unpack_comm_v_omega(int, int, double*);
+      int unpack_comm_f_torque(int, int, double*);
 
       int pack_reverse_comm(int, int, double*);
       int pack_reverse_comm_x_v_omega(int, int, double*);
       int pack_reverse_comm_v_omega(int, int, double*);
       int pack_reverse_comm_image(int n, int first, double *buf);
+      int pack_reverse_comm_del_exist(int n, int first, double *buf);
       void unpack_reverse_comm(int, int*, double*);
-      void unpack_reverse_comm_x_v_omega(int, int*, double*);
-      void unpack_reverse_comm_v_omega(int, int*, double*);
-      void unpack_reverse_comm_image(int n, int *list, double *buf);
+      int unpack_reverse_comm_x_v_omega(int, int*, double*);
+      int unpack_reverse_comm_v_omega(int, int*, double*);
+      int unpack_reverse_comm_image(int n, int *list, double *buf);
+      int unpack_reverse_comm_del_exist(int n, int *list, double *buf);
 
       int dof(int);
       double ** get_dump_ref(int &nb, int &nprop, char* prop);
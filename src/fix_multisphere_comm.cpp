@@ -51,34 +51,40 @@ int FixMultisphere::unpack_exchange(int nlocal, double *buf)
 
 /* ----------------------------------------------------------------------
    forward comm
+   all quantities of the plan in fw_comm_flag_ travel in one exchange,
+   each is packed as a block over all atoms of the swap
+   the size per atom varies, so use the variable comm
 ------------------------------------------------------------------------- */
 
 void FixMultisphere::forward_comm()
 {
-    comm->forward_comm_fix(this);
+    comm->forward_comm_variable_fix(this);
 
     // force set of flag for next call
     fw_comm_flag_ = MS_COMM_UNDEFINED;
 }
 
 /* ----------------------------------------------------------------------
-   pack comm
+   pack comm, returns total # of datums
 ------------------------------------------------------------------------- */
 
 int FixMultisphere::pack_comm(int n, int *list, double *buf, int pbc_flag, int *pbc)
 {
     /*NL*/ //if (screen) fprintf(screen,"fw_comm_flag_ %d\n",fw_comm_flag_);
 
-    if     (fw_comm_flag_ == MS_COMM_FW_BODY)
-        return pack_comm_body(n,list,buf,pbc_flag,pbc);
-    else if(fw_comm_flag_ == MS_COMM_FW_IMAGE_DISPLACE)
-        return pack_comm_image_displace(n,list,buf,pbc_flag,pbc);
-    else if(fw_comm_flag_ == MS_COMM_FW_V_OMEGA)
-        return pack_comm_v_omega(n,list,buf,pbc_flag,pbc);
-    else if(fw_comm_flag_ == MS_COMM_FW_F_TORQUE)
-        return pack_comm_f_torque(n,list,buf,pbc_flag,pbc);
-    else error->fix_error(FLERR,this,"FixMultisphere::pack_comm internal error");
-    return 0;
+    if(fw_comm_flag_ == MS_COMM_UNDEFINED)
+        error->fix_error(FLERR,this,"FixMultisphere::pack_comm internal error");
+
+    int m = 0;
+    if(fw_comm_flag_ & MS_COMM_FW_BODY)
+        m += pack_comm_body(n,list,&buf[m],pbc_flag,pbc);
+    if(fw_comm_flag_ & MS_COMM_FW_IMAGE_DISPLACE)
+        m += pack_comm_image_displace(n,list,&buf[m],pbc_flag,pbc);
+    if(fw_comm_flag_ & MS_COMM_FW_V_OMEGA)
+        m += pack_comm_v_omega(n,list,&buf[m],pbc_flag,pbc);
+    if(fw_comm_flag_ & MS_COMM_FW_F_TORQUE)
+        m += pack_comm_f_torque(n,list,&buf[m],pbc_flag,pbc);
+    return m;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -93,7 +99,7 @@ int FixMultisphere::pack_comm_body(int n, int *list, double *buf, int pbc_flag,
 
         buf[m++] = static_cast<double>(body_[j]);
     }
-    return 1;
+    return m;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -111,7 +117,7 @@ int FixMultisphere::pack_comm_image_displace(int n, int *list, double *buf, int
         buf[m++] = static_cast<double>(aimage[j]);
         vectorToBuf3D(displace_[j],buf,m);
     }
-    return 4;
+    return m;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -130,10 +136,13 @@ int FixMultisphere::pack_comm_v_omega(int n, int *list, double *buf, int pbc_fla
         vectorToBuf3D(v[j],buf,m);
         vectorToBuf3D(omega[j],buf,m);
     }
-    return 6;
+    return m;
 }
 
-/* ---------------------------------------------------------------------- */
+/* ----------------------------------------------------------------------
+   force and torque are only sent for atoms whose body is not owned,
+   for all others the flag alone is sent
+------------------------------------------------------------------------- */
 
 int FixMultisphere::pack_comm_f_torque(int n, int *list, double *buf, int pbc_flag, int *pbc)
 {
@@ -154,32 +163,38 @@ int FixMultisphere::pack_comm_f_torque(int n, int *list, double *buf, int pbc_fl
         else flag = multisphere_.map(tag) < 0;
         /*NL*/// if(flag && screen) fprintf(screen,"pack_comm atom %d with flag %d\n",atom->tag[j],flag);
         buf[m++] = static_cast<double>(flag);
-        vectorToBuf3D(f[j],buf,m);
-        vectorToBuf3D(torque[j],buf,m);
+        if(flag)
+        {
+            vectorToBuf3D(f[j],buf,m);
+            vectorToBuf3D(torque[j],buf,m);
+        }
     }
-    return 7;
+    return m;
 }
 
 /* ----------------------------------------------------------------------
-   unpack comm
+   unpack comm, blocks in the same order as packed
 ------------------------------------------------------------------------- */
 
 void FixMultisphere::unpack_comm(int n, int first, double *buf)
 {
-    if     (fw_comm_flag_ == MS_COMM_FW_BODY)
-        unpack_comm_body(n,first,buf);
-    else if(fw_comm_flag_ == MS_COMM_FW_IMAGE_DISPLACE)
-        unpack_comm_image_displace(n,first,buf);
-    else if(fw_comm_flag_ == MS_COMM_FW_V_OMEGA)
-        unpack_comm_v_omega(n,first,buf);
-    else if(fw_comm_flag_ == MS_COMM_FW_F_TORQUE)
-        unpack_comm_f_torque(n,first,buf);
-    else error->fix_error(FLERR,this,"FixMultisphere::unpack_comm internal error");
+    if(fw_comm_flag_ == MS_COMM_UNDEFINED)
+        error->fix_error(FLERR,this,"FixMultisphere::unpack_comm internal error");
+
+    int m = 0;
+    if(fw_comm_flag_ & MS_COMM_FW_BODY)
+        m += unpack_comm_body(n,first,&buf[m]);
+    if(fw_comm_flag_ & MS_COMM_FW_IMAGE_DISPLACE)
+        m += unpack_comm_image_displace(n,first,&buf[m]);
+    if(fw_comm_flag_ & MS_COMM_FW_V_OMEGA)
+        m += unpack_comm_v_omega(n,first,&buf[m]);
+    if(fw_comm_flag_ & MS_COMM_FW_F_TORQUE)
+        m += unpack_comm_f_torque(n,first,&buf[m]);
 }
 
 /* ---------------------------------------------------------------------- */
 
-void FixMultisphere::unpack_comm_body(int n, int first, double *buf)
+int FixMultisphere::unpack_comm_body(int n, int first, double *buf)
 {
     int i,m,last;
 
@@ -190,11 +205,12 @@ void FixMultisphere::unpack_comm_body(int n, int first, double *buf)
         body_[i] = static_cast<int>(buf[m++]);
         /*NL*/ //if (screen) fprintf(screen,"step %d: atom tag %d has body %d\n",update->ntimestep,atom->tag[i],body_[i]);
     }
+    return m;
 }
 
 /* ---------------------------------------------------------------------- */
 
-void FixMultisphere::unpack_comm_image_displace(int n, int first, double *buf)
+int FixMultisphere::unpack_comm_image_displace(int n, int first, double *buf)
 {
     int i,m,last;
     int *aimage = atom->image;
@@ -207,11 +223,12 @@ void FixMultisphere::unpack_comm_image_displace(int n, int first, double *buf)
         bufToVector3D(displace_[i],buf,m);
         /*NL*/ //if (screen) fprintf(screen,"step " BIGINT_FORMAT " proc %d COMM: atom tag %d has image %d\n",update->ntimestep,comm->me,atom->tag[i],aimage[i]);
     }
+    return m;
 }
 
 /* ---------------------------------------------------------------------- */
 
-void FixMultisphere::unpack_comm_v_omega(int n, int first, double *buf)
+int FixMultisphere::unpack_comm_v_omega(int n, int first, double *buf)
 {
     double **v = atom->v;
     double **omega = atom->omega;
@@ -225,11 +242,12 @@ void FixMultisphere::unpack_comm_v_omega(int n, int first, double *buf)
         bufToVector3D(v[i],buf,m);
         bufToVector3D(omega[i],buf,m);
     }
+    return m;
 }
 
 /* ---------------------------------------------------------------------- */
 
-void FixMultisphere::unpack_comm_f_torque(int n, int first, double *buf)
+int FixMultisphere::unpack_comm_f_torque(int n, int first, double *buf)
 {
     int i,m,last,flag;
     double **f = atom->f;
@@ -246,40 +264,48 @@ void FixMultisphere::unpack_comm_f_torque(int n, int first, double *buf)
             bufToVector3D(f[i],buf,m);
             bufToVector3D(torque[i],buf,m);
         }
-        else m += 6;
     }
+    return m;
 }
 
 /* ----------------------------------------------------------------------
-   forward comm
+   reverse comm, same plan as forward comm
 ------------------------------------------------------------------------- */
 
 void FixMultisphere::reverse_comm()
 {
-    comm->reverse_comm_fix(this);
+    comm->reverse_comm_variable_fix(this);
 
     // force set of flag for next call
     rev_comm_flag_ = MS_COMM_UNDEFINED;
 }
 
 /* ----------------------------------------------------------------------
-   pack reverse comm
+   pack reverse comm, returns total # of datums
 ------------------------------------------------------------------------- */
 
 int FixMultisphere::pack_reverse_comm(int n, int first, double *buf)
 {
     /*NL*/ //if (screen) fprintf(screen,"rev_comm_flag_ %d\n",rev_comm_flag_);
-    if     (rev_comm_flag_ == MS_COMM_REV_X_V_OMEGA)
-        return pack_reverse_comm_x_v_omega(n,first,buf);
-    else if(rev_comm_flag_ == MS_COMM_REV_V_OMEGA)
-        return pack_reverse_comm_v_omega(n,first,buf);
-    else if(rev_comm_flag_ == MS_COMM_REV_IMAGE)
-        return pack_reverse_comm_image(n,first,buf);
-    else error->fix_error(FLERR,this,"FixMultisphere::pack_reverse_comm internal error");
-    return 0;
+    if(rev_comm_flag_ == MS_COMM_UNDEFINED)
+        error->fix_error(FLERR,this,"FixMultisphere::pack_reverse_comm internal error");
+
+    int m = 0;
+    if(rev_comm_flag_ & MS_COMM_REV_X_V_OMEGA)
+        m += pack_reverse_comm_x_v_omega(n,first,&buf[m]);
+    if(rev_comm_flag_ & MS_COMM_REV_V_OMEGA)
+        m += pack_reverse_comm_v_omega(n,first,&buf[m]);
+    if(rev_comm_flag_ & MS_COMM_REV_IMAGE)
+        m += pack_reverse_comm_image(n,first,&buf[m]);
+    if(rev_comm_flag_ & MS_COMM_REV_DEL_EXIST)
+        m += pack_reverse_comm_del_exist(n,first,&buf[m]);
+    return m;
 }
 
-/* ---------------------------------------------------------------------- */
+/* ----------------------------------------------------------------------
+   x, v and omega are only sent for atoms whose body is owned,
+   for all others the flag alone is sent
+------------------------------------------------------------------------- */
 
 int FixMultisphere::pack_reverse_comm_x_v_omega(int n, int first, double *buf)
 {
@@ -304,11 +330,14 @@ int FixMultisphere::pack_reverse_comm_x_v_omega(int n, int first, double *buf)
         else flag = 0;
 
         buf[m++] = static_cast<double>(flag);
-        vectorToBuf3D(x[i],buf,m);
-        vectorToBuf3D(v[i],buf,m);
-        vectorToBuf3D(omega[i],buf,m);
+        if(flag)
+        {
+            vectorToBuf3D(x[i],buf,m);
+            vectorToBuf3D(v[i],buf,m);
+            vectorToBuf3D(omega[i],buf,m);
+        }
     }
-    return 10;
+    return m;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -335,10 +364,13 @@ int FixMultisphere::pack_reverse_comm_v_omega(int n, int first, double *buf)
         else flag = 0;
 
         buf[m++] = static_cast<double>(flag);
-        vectorToBuf3D(v[i],buf,m);
-        vectorToBuf3D(omega[i],buf,m);
+        if(flag)
+        {
+            vectorToBuf3D(v[i],buf,m);
+            vectorToBuf3D(omega[i],buf,m);
+        }
     }
-    return 7;
+    return m;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -364,29 +396,56 @@ int FixMultisphere::pack_reverse_comm_image(int n, int first, double *buf)
         else flag = 0;
 
         buf[m++] = static_cast<double>(flag);
-        buf[m++] = static_cast<double>(image[i]);
+        if(flag)
+            buf[m++] = static_cast<double>(image[i]);
     }
-    return 2;
+    return m;
 }
 
 /* ----------------------------------------------------------------------
-   unpack reverse comm
+   deletion and existence flags, summed up at the owner
+   replaces the separate reverse comm of both fix property/atom
+------------------------------------------------------------------------- */
+
+int FixMultisphere::pack_reverse_comm_del_exist(int n, int first, double *buf)
+{
+    int i,m,last;
+
+    double *delflag = fix_delflag_->vector_atom;
+    double *existflag = fix_existflag_->vector_atom;
+
+    m = 0;
+    last = first + n;
+    for (i = first; i < last; i++) {
+        buf[m++] = delflag[i];
+        buf[m++] = existflag[i];
+    }
+    return m;
+}
+
+/* ----------------------------------------------------------------------
+   unpack reverse comm, blocks in the same order as packed
 ------------------------------------------------------------------------- */
 
 void FixMultisphere::unpack_reverse_comm(int n, int *list, double *buf)
 {
-    if     (rev_comm_flag_ == MS_COMM_REV_X_V_OMEGA)
-        unpack_reverse_comm_x_v_omega(n,list,buf);
-    else if(rev_comm_flag_ == MS_COMM_REV_V_OMEGA)
-        unpack_reverse_comm_v_omega(n,list,buf);
-    else if(rev_comm_flag_ == MS_COMM_REV_IMAGE)
-        unpack_reverse_comm_image(n,list,buf);
-    else error->fix_error(FLERR,this,"FixMultisphere::unpack_reverse_comm internal error");
+    if(rev_comm_flag_ == MS_COMM_UNDEFINED)
+        error->fix_error(FLERR,this,"FixMultisphere::unpack_reverse_comm internal error");
+
+    int m = 0;
+    if(rev_comm_flag_ & MS_COMM_REV_X_V_OMEGA)
+        m += unpack_reverse_comm_x_v_omega(n,list,&buf[m]);
+    if(rev_comm_flag_ & MS_COMM_REV_V_OMEGA)
+        m += unpack_reverse_comm_v_omega(n,list,&buf[m]);
+    if(rev_comm_flag_ & MS_COMM_REV_IMAGE)
+        m += unpack_reverse_comm_image(n,list,&buf[m]);
+    if(rev_comm_flag_ & MS_COMM_REV_DEL_EXIST)
+        m += unpack_reverse_comm_del_exist(n,list,&buf[m]);
 }
 
 /* ---------------------------------------------------------------------- */
 
-void FixMultisphere::unpack_reverse_comm_x_v_omega(int n, int *list, double *buf)
+int FixMultisphere::unpack_reverse_comm_x_v_omega(int n, int *list, double *buf)
 {
     int i,j,flag,m = 0;
 
@@ -410,13 +469,13 @@ void FixMultisphere::unpack_reverse_comm_x_v_omega(int n, int *list, double *buf
             if(j >= nlocal)
                 corner_ghost[j] = 1.;
         }
-        else m += 9;
     }
+    return m;
 }
 
 /* ---------------------------------------------------------------------- */
 
-void FixMultisphere::unpack_reverse_comm_v_omega(int n, int *list, double *buf)
+int FixMultisphere::unpack_reverse_comm_v_omega(int n, int *list, double *buf)
 {
     int i,j,flag,m = 0;
 
@@ -438,13 +497,13 @@ void FixMultisphere::unpack_reverse_comm_v_omega(int n, int *list, double *buf)
             if(j >= nlocal)
                 corner_ghost[j] = 1.;
         }
-        else m += 6;
     }
+    return m;
 }
 
 /* ---------------------------------------------------------------------- */
 
-void FixMultisphere::unpack_reverse_comm_image(int n, int *list, double *buf)
+int FixMultisphere::unpack_reverse_comm_image(int n, int *list, double *buf)
 {
     int i,j,flag,m = 0;
 
@@ -465,8 +524,25 @@ void FixMultisphere::unpack_reverse_comm_image(int n, int *list, double *buf)
             if(j >= nlocal)
                 corner_ghost[j] = 1.;
         }
-        else m += 1;
     }
+    return m;
+}
+
+/* ---------------------------------------------------------------------- */
+
+int FixMultisphere::unpack_reverse_comm_del_exist(int n, int *list, double *buf)
+{
+    int i,j,m = 0;
+
+    double *delflag = fix_delflag_->vector_atom;
+    double *existflag = fix_existflag_->vector_atom;
+
+    for (i = 0; i < n; i++) {
+        j = list[i];
+        delflag[j] += buf[m++];
+        existflag[j] += buf[m++];
+    }
+    return m;
 }
 
 /* ----------------------------------------------------------------------
@@ -48,6 +48,7 @@ using namespace LAMMPS_NS;
 using namespace FixConst;
 
 #define SMALL_DELTA skin/(70.*M_PI)
+#define SMALL_NORMAL 1e-10  // smaller normal components are not a usable slab axis
 
 /*NL*/ #define DEBUGMODE_LMP_FIX_NEIGHLIST_MESH false //(update->ntimestep>15400 && comm->me ==1)
 /*NL*/ #define DEBUG_LMP_FIX_NEIGHLIST_MESH_M_ID 0
@@ -58,6 +59,12 @@ FixNeighlistMesh::FixNeighlistMesh(LAMMPS *lmp, int narg, char **arg)
   fix_nneighs_(0),
   fix_nneighs_name_(0),
   buildNeighList(false),
+  incremental_(false),
+  incrementalValid_(false),
+  drift_(0.0),
+  stats_reduced_(false),
+  nbins_box_(0.),
+  nbins_used_(0.),
   numAllContacts_(0),
   globalNumAllContacts_(false),
   mbinx(0),
@@ -74,13 +81,45 @@ FixNeighlistMesh::FixNeighlistMesh(LAMMPS *lmp, int narg, char **arg)
   changingDomain(false),
   last_bin_update(-1)
 {
-    if(!modify->find_fix_id(arg[3]) || !dynamic_cast<FixMeshSurface*>(modify->find_fix_id(arg[3])))
+    if(narg < 4 || !modify->find_fix_id(arg[3]) || !dynamic_cast<FixMeshSurface*>(modify->find_fix_id(arg[3])))
         error->fix_error(FLERR,this,"illegal caller");
 
     caller_ = static_cast<FixMeshSurface*>(modify->find_fix_id(arg[3]));
     mesh_ = caller_->triMesh();
 
     groupbit_wall_mesh = groupbit;
+
+    //NP lists are only built on reneighboring steps, from owned particles
+    comm_overlap = 1;
+
+    int iarg = 4;
+    while(iarg < narg)
+    {
+        if(strcmp(arg[iarg],"incremental") == 0) {
+            if(narg < iarg+2)
+                error->fix_error(FLERR,this,"not enough arguments for 'incremental'");
+            if(0 == strcmp(arg[iarg+1],"yes"))
+                incremental_ = true;
+            else if(0 == strcmp(arg[iarg+1],"no"))
+                incremental_ = false;
+            else
+                error->fix_error(FLERR,this,"expecting 'yes' or 'no' after 'incremental'");
+            iarg += 2;
+        } else
+            error->fix_error(FLERR,this,"unknown keyword");
+    }
+
+    //NP bin residents are identified by their tag
+    if(incremental_ && !atom->tag_enable)
+        error->fix_error(FLERR,this,"incremental build requires atom IDs");
+
+    vector_flag = 1;
+    size_vector = 6;
+    global_freq = 1;
+    extvector = 1;
+
+    vectorZeroizeN(stats_,6);
+    vectorZeroizeN(stats_all_,6);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -142,10 +181,10 @@ void FixNeighlistMesh::initializeNeighlist()
         triangles.push_back(TriangleNeighlist());
     }
 
-    for(size_t iTri = 0; iTri < nall; iTri++) {
-        TriangleNeighlist & triangle = triangles[iTri];
-        triangle.contacts.reserve(std::max(triangle.contacts.capacity(), static_cast<size_t>(128)));
-    }
+    // empty lists until the first build
+    contacts_.clear();
+    contacts_offset_.assign(nall+1,0);
+    incrementalValid_ = false;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -153,6 +192,7 @@ void FixNeighlistMesh::initializeNeighlist()
 void FixNeighlistMesh::setup_pre_force(int foo)
 {
     //NP initial tri-sphere neighlist build
+    incrementalValid_ = false;
     pre_neighbor();
     pre_force(0);
 }
@@ -162,6 +202,7 @@ void FixNeighlistMesh::setup_pre_force(int foo)
 void FixNeighlistMesh::min_setup_pre_force(int foo)
 {
     //NP initial tri-sphere neighlist build
+    incrementalValid_ = false;
     pre_neighbor();
     pre_force(0);
 }
@@ -291,9 +332,56 @@ void FixNeighlistMesh::pre_force(int)
     /*NL*/          }
     /*NL*/ }
 
-    for(size_t iTri = 0; iTri < nall; iTri++) {
-      handleTriangle(iTri);
+    vectorZeroizeN(stats_,6);
+    stats_reduced_ = false;
+
+    //NP for changing mesh or domain, bins are counted in handleTriangle()
+    if(!(changingMesh || changingDomain))
+    {
+      stats_[4] = nbins_box_;
+      stats_[5] = nbins_used_;
+    }
+
+    contacts_.clear();
+    contacts_offset_.resize(nall+1);
+
+    //NP the incremental build relies on the cached bins of each triangle
+    if(incremental_ && !(changingMesh || changingDomain))
+    {
+      //NP bins are only checked again after a particle moved drift_, so
+      //NP candidates reach drift_ further than the neighbor distance
+      drift_ = 0.5*skin;
+
+      snapshotBins();
+
+      candidates_offset_.swap(candidates_offset_prev_);
+      candidate_slot_.swap(candidate_slot_prev_);
+      candidate_ordinal_.swap(candidate_ordinal_prev_);
+      candidates_offset_.resize(nall+1);
+      candidate_slot_.clear();
+      candidate_ordinal_.clear();
+
+      for(size_t iTri = 0; iTri < nall; iTri++) {
+        contacts_offset_[iTri] = contacts_.size();
+        candidates_offset_[iTri] = candidate_slot_.size();
+        handleTriangleIncremental(iTri);
+        stats_[0] += triangles[iTri].nchecked;
+      }
+      candidates_offset_[nall] = candidate_slot_.size();
+
+      incrementalValid_ = true;
+    }
+    else
+    {
+      for(size_t iTri = 0; iTri < nall; iTri++) {
+        contacts_offset_[iTri] = contacts_.size();
+        handleTriangle(iTri);
+        stats_[0] += triangles[iTri].nchecked;
+      }
+      stats_[1] = nall;
+      incrementalValid_ = false;
     }
+    contacts_offset_[nall] = contacts_.size();
 
   // prepare memory for partition generation
   const int nlocal = atom->nlocal;
@@ -304,14 +392,13 @@ void FixNeighlistMesh::pre_force(int)
   std::fill_n(particle_triangles.begin(), nlocal, 0);
 
   // update nneighs
-  for(size_t iTri = 0; iTri < nall; ++iTri) {
-    std::vector<int> & neighbors = triangles[iTri].contacts;
-    for(std::vector<int>::iterator it = neighbors.begin(); it != neighbors.end(); ++it) {
-      const int i =  *it;
-      ++particle_triangles[i];
-    }
-    numAllContacts_ += neighbors.size();
+  for(std::vector<int>::iterator it = contacts_.begin(); it != contacts_.end(); ++it) {
+    const int i =  *it;
+    ++particle_triangles[i];
   }
+  numAllContacts_ = contacts_.size();
+  stats_[2] = nall;
+  stats_[3] = numAllContacts_;
 
   for(int i = 0; i < nlocal; ++i) {
     const int ntriangles = particle_triangles[i];
@@ -333,15 +420,12 @@ void FixNeighlistMesh::pre_force(int)
 void FixNeighlistMesh::handleTriangle(int iTri)
 {
     TriangleNeighlist & triangle = triangles[iTri];
-    std::vector<int> & neighbors = triangle.contacts;
+    std::vector<int> & neighbors = contacts_;
     int & nchecked = triangle.nchecked;
     int *mask = atom->mask;
-    int ixMin(0),ixMax(0),iyMin(0),iyMax(0),izMin(0),izMax(0);
     int nlocal = atom->nlocal;
     const double contactDistanceFactor = neighbor->contactDistanceFactor;
 
-    neighbors.clear();
-
     nchecked = 0;
 
     // only do this if I own particles
@@ -349,27 +433,12 @@ void FixNeighlistMesh::handleTriangle(int iTri)
     {
       if(changingMesh || changingDomain)
       {
-        getBinBoundariesForTriangle(iTri,ixMin,ixMax,iyMin,iyMax,izMin,izMax);
-    /*NL*/ if(screen && DEBUGMODE_LMP_FIX_NEIGHLIST_MESH && DEBUG_LMP_FIX_NEIGHLIST_MESH_M_ID == mesh_->id(iTri))
-    /*NL*/ {
-    /*NL*/          double lo[3],hi[3];
-    /*NL*/          //b.getBoxBounds(lo,hi);
-    /*NL*/          vectorScalarSubtract3D(lo,distmax);
-    /*NL*/          vectorScalarAdd3D(hi,distmax);
-    /*NL*/          int ixDebLo, iyDebLo, izDebLo, ixDebHi, iyDebHi, izDebHi;
-    /*NL*/          neighbor->coord2bin(lo,ixDebLo, iyDebLo, izDebLo);
-    /*NL*/          neighbor->coord2bin(hi,ixDebHi, iyDebHi, izDebHi);
-    /*NL*/          fprintf(screen, "handleTriangle for tri id %d on proc %d, indices from here  are %d %d //  %d %d //  %d %d , bbox is %f %f //  %f %f //  %f %f  \n",
-    /*NL*/                      mesh_->id(iTri),comm->me,ixMin,ixMax,iyMin,iyMax,izMin,izMax,lo[0],hi[0],lo[1],hi[1],lo[2],hi[2]);
-    /*NL*/          fprintf(screen, "handleTriangle for tri id %d on proc %d, indices from neigh are %d %d //  %d %d //  %d %d , bbox is %f %f //  %f %f //  %f %f  \n",
-    /*NL*/                      mesh_->id(iTri),comm->me,ixDebLo,ixDebHi,iyDebLo,iyDebHi,izDebLo,izDebHi,lo[0],hi[0],lo[1],hi[1],lo[2],hi[2]);
-    /*NL*/ }
+        stats_[4] += voxelizeTriangle(iTri,distmax,false,binlist_);
+        stats_[5] += binlist_.size();
 
-        for(int ix=ixMin;ix<=ixMax;ix++) {
-          for(int iy=iyMin;iy<=iyMax;iy++) {
-            for(int iz=izMin;iz<=izMax;iz++) {
-              int iBin = iz*mbiny*mbinx + iy*mbinx + ix;
-              if(iBin < 0 || iBin >= maxhead) continue;
+        const int bincount = binlist_.size();
+        for(int i = 0; i < bincount; i++) {
+              const int iBin = binlist_[i];
 
               /*NL*/ if(screen && DEBUGMODE_LMP_FIX_NEIGHLIST_MESH && DEBUG_LMP_FIX_NEIGHLIST_MESH_M_ID == mesh_->id(iTri))
               /*NL*/          fprintf(screen, "       handleTriangle tri id %d on proc %d - checking bin %d\n",
@@ -395,13 +464,10 @@ void FixNeighlistMesh::handleTriangle(int iTri)
                 {
                   //NP include iAtom in neighbor list
                   neighbors.push_back(iAtom);
-                  /*NL*/ //if(screen && 377==atom->tag[iAtom]) fprintf(screen,"proc %d, step " BIGINT_FORMAT " adding pair tri tag %d atom ta %d to NEIGHLIST\n",comm->me,update->ntimestep,mesh_->id(iTri),atom->tag[iAtom]);
                 }
                 if(bins) iAtom = bins[iAtom];
                 else iAtom = -1;
               }
-            }
-          }
         }
       } else {
         const std::vector<int> & triangleBins = triangle.bins;
@@ -442,6 +508,298 @@ void FixNeighlistMesh::handleTriangle(int iTri)
     /*NL*/// if (screen) fprintf(screen,"iTri %d numContacts %d\n",iTri, neighbors.size());
 }
 
+/* ----------------------------------------------------------------------
+   incremental build: candidates found in bins that did not change since
+   the last build are taken over and only they are checked again, all
+   other bins are checked completely. the lists are the same as those
+   of a full build, as no particle moved more than drift_ since its bin
+   was checked
+------------------------------------------------------------------------- */
+
+void FixNeighlistMesh::handleTriangleIncremental(int iTri)
+{
+    TriangleNeighlist & triangle = triangles[iTri];
+    int & nchecked = triangle.nchecked;
+    const double contactDistanceFactor = neighbor->contactDistanceFactor;
+    const double treshold = r ? skin : (distmax+skin);
+    const double treshold_candidate = treshold+drift_;
+
+    nchecked = 0;
+
+    //NP candidates of the previous build, ordered by slot
+    int iPrev = 0, iPrevEnd = 0;
+    if(incrementalValid_)
+    {
+      iPrev = candidates_offset_prev_[iTri];
+      iPrevEnd = candidates_offset_prev_[iTri+1];
+    }
+
+    bool rebuilt = false;
+    const std::vector<int> & triangleBins = triangle.bins;
+    const int bincount = triangleBins.size();
+    for(int slot = 0; slot < bincount; slot++) {
+      const int iBin = triangleBins[slot];
+      const int ibegin = bin_offset_[iBin];
+
+      if(!bin_dirty_[iBin])
+      {
+        //NP same residents, so ordinals of the previous build are still valid
+        while(iPrev < iPrevEnd && candidate_slot_prev_[iPrev] == slot)
+        {
+          const int ordinal = candidate_ordinal_prev_[iPrev++];
+          const int iAtom = bin_atoms_[ibegin+ordinal];
+          candidate_slot_.push_back(slot);
+          candidate_ordinal_.push_back(ordinal);
+          nchecked++;
+
+          if(mesh_->resolveTriSphereNeighbuild(iTri,r ? r[iAtom]*contactDistanceFactor : 0. ,x[iAtom],treshold))
+            contacts_.push_back(iAtom);
+        }
+        continue;
+      }
+
+      while(iPrev < iPrevEnd && candidate_slot_prev_[iPrev] == slot)
+        iPrev++;
+
+      rebuilt = true;
+      const int iend = bin_offset_[iBin+1];
+      for(int k = ibegin; k < iend; k++) {
+        const int iAtom = bin_atoms_[k];
+        const double rSphere = r ? r[iAtom]*contactDistanceFactor : 0.;
+        nchecked++;
+
+        if(mesh_->resolveTriSphereNeighbuild(iTri,rSphere,x[iAtom],treshold_candidate))
+        {
+          candidate_slot_.push_back(slot);
+          candidate_ordinal_.push_back(k-ibegin);
+
+          if(mesh_->resolveTriSphereNeighbuild(iTri,rSphere,x[iAtom],treshold))
+            contacts_.push_back(iAtom);
+        }
+      }
+    }
+
+    if(rebuilt)
+      stats_[1] += 1.;
+}
+
+/* ----------------------------------------------------------------------
+   collect local particles of each bin, sorted by tag, and mark bins
+   whose residents changed or moved more than drift_ since they were
+   last checked
+------------------------------------------------------------------------- */
+
+namespace {
+  struct TagComparator {
+    const int *tag;
+    TagComparator(const int *t) : tag(t) {}
+    bool operator() (int i, int j) const { return tag[i] < tag[j]; }
+  };
+}
+
+void FixNeighlistMesh::snapshotBins()
+{
+    const int nlocal = atom->nlocal;
+    const int *mask = atom->mask;
+    const int *tag = atom->tag;
+
+    bin_offset_.swap(bin_offset_prev_);
+    bin_tags_.swap(bin_tags_prev_);
+    bin_xref_.swap(bin_xref_prev_);
+    bin_rref_.swap(bin_rref_prev_);
+
+    if(static_cast<int>(bin_offset_prev_.size()) != maxhead+1)
+      incrementalValid_ = false;
+
+    bin_offset_.resize(maxhead+1);
+    bin_atoms_.clear();
+
+    for(int iBin = 0; iBin < maxhead; iBin++) {
+      const int ibegin = bin_atoms_.size();
+      bin_offset_[iBin] = ibegin;
+
+      //NP only handle local atoms
+      int iAtom = binhead[iBin];
+      while(iAtom != -1 && iAtom < nlocal)
+      {
+        if(mask[iAtom] & groupbit_wall_mesh)
+          bin_atoms_.push_back(iAtom);
+        iAtom = bins[iAtom];
+      }
+
+      if(static_cast<int>(bin_atoms_.size()) - ibegin > 1)
+        std::sort(bin_atoms_.begin()+ibegin,bin_atoms_.end(),TagComparator(tag));
+    }
+    bin_offset_[maxhead] = bin_atoms_.size();
+
+    const int nresidents = bin_atoms_.size();
+    bin_tags_.resize(nresidents);
+    bin_xref_.resize(3*nresidents);
+    bin_rref_.resize(nresidents);
+    bin_dirty_.resize(maxhead);
+
+    const double driftsq = drift_*drift_;
+
+    for(int iBin = 0; iBin < maxhead; iBin++) {
+      const int ibegin = bin_offset_[iBin];
+      const int n = bin_offset_[iBin+1] - ibegin;
+
+      bool dirty = !incrementalValid_ || n != bin_offset_prev_[iBin+1] - bin_offset_prev_[iBin];
+      for(int k = 0; k < n && !dirty; k++) {
+        const int iAtom = bin_atoms_[ibegin+k];
+        const int kPrev = bin_offset_prev_[iBin]+k;
+        if(tag[iAtom] != bin_tags_prev_[kPrev] || (r && r[iAtom] != bin_rref_prev_[kPrev]) ||
+           pointDistanceSqr(x[iAtom],&bin_xref_prev_[3*kPrev]) > driftsq)
+          dirty = true;
+      }
+      bin_dirty_[iBin] = dirty;
+
+      for(int k = 0; k < n; k++) {
+        const int iAtom = bin_atoms_[ibegin+k];
+        bin_tags_[ibegin+k] = tag[iAtom];
+        if(dirty)
+        {
+          vectorCopy3D(x[iAtom],&bin_xref_[3*(ibegin+k)]);
+          bin_rref_[ibegin+k] = r ? r[iAtom] : 0.;
+        }
+        else
+        {
+          const int kPrev = bin_offset_prev_[iBin]+k;
+          vectorCopy3D(&bin_xref_prev_[3*kPrev],&bin_xref_[3*(ibegin+k)]);
+          bin_rref_[ibegin+k] = bin_rref_prev_[kPrev];
+        }
+      }
+    }
+}
+
+/* ----------------------------------------------------------------------
+   collect the bins in the bounding box of iTri that intersect the slab
+   of half width treshold around the plane of iTri. the bins are visited
+   in columns along the axis closest to the triangle normal, so only the
+   bins cutting the slab are touched. with exact, bins whose center is
+   further than treshold plus half the bin diagonal away from the
+   triangle itself are removed as well
+   degenerate triangles without a normal use boundingBoxBins() instead
+   returns # of bins in the bounding box
+------------------------------------------------------------------------- */
+
+int FixNeighlistMesh::voxelizeTriangle(int iTri, double treshold, bool exact, std::vector<int> & binlist)
+{
+    int lo[3],hi[3];
+    getBinBoundariesForTriangle(iTri,lo[0],hi[0],lo[1],hi[1],lo[2],hi[2]);
+
+    binlist.clear();
+    if(lo[0] > hi[0] || lo[1] > hi[1] || lo[2] > hi[2])
+        return 0;
+    const int nbox = (hi[0]-lo[0]+1)*(hi[1]-lo[1]+1)*(hi[2]-lo[2]+1);
+
+    double n[3], p0[3];
+    mesh_->surfaceNorm(iTri,n);
+    mesh_->node(iTri,0,p0);
+
+    const double binsize[3] = {neighbor->binsizex, neighbor->binsizey, neighbor->binsizez};
+    const double half[3] = {0.5*binsize[0], 0.5*binsize[1], 0.5*binsize[2]};
+    const double maxdiag = vectorMag3D(half);
+
+    // a bin cuts the slab if its center is closer than this to the plane
+    const double slab = treshold + fabs(n[0])*half[0] + fabs(n[1])*half[1] + fabs(n[2])*half[2];
+
+    // column axis a is the one with the largest normal component
+    int a = 0;
+    if(fabs(n[1]) > fabs(n[a])) a = 1;
+    if(fabs(n[2]) > fabs(n[a])) a = 2;
+
+    //NP degenerate triangle without a usable normal, no slab to intersect
+    if(!(fabs(n[a]) > SMALL_NORMAL))
+      return boundingBoxBins(iTri,treshold,exact,binlist);
+
+    const int b = (a+1)%3;
+    const int c = (a+2)%3;
+
+    // center of the first bin in the box
+    double center0[3];
+    neighbor->bin_center(lo[0],lo[1],lo[2],center0);
+
+    double center[3];
+    int idx[3];
+
+    for(idx[b] = lo[b]; idx[b] <= hi[b]; idx[b]++) {
+      center[b] = center0[b] + (idx[b]-lo[b])*binsize[b];
+      for(idx[c] = lo[c]; idx[c] <= hi[c]; idx[c]++) {
+        center[c] = center0[c] + (idx[c]-lo[c])*binsize[c];
+
+        // range of bin centers along a with |n.(center-p0)| <= slab
+        const double rest = n[b]*(center[b]-p0[b]) + n[c]*(center[c]-p0[c]);
+        double ca1 = p0[a] + (-slab-rest)/n[a];
+        double ca2 = p0[a] + ( slab-rest)/n[a];
+        if(ca1 > ca2) std::swap(ca1,ca2);
+
+        //NP small tolerance so round-off does not drop bins touching the slab
+        int ia1 = lo[a] + static_cast<int>(ceil((ca1-center0[a])/binsize[a] - 1e-6));
+        int ia2 = lo[a] + static_cast<int>(floor((ca2-center0[a])/binsize[a] + 1e-6));
+        ia1 = std::max(ia1,lo[a]);
+        ia2 = std::min(ia2,hi[a]);
+
+        for(idx[a] = ia1; idx[a] <= ia2; idx[a]++) {
+          const int iBin = idx[2]*mbiny*mbinx + idx[1]*mbinx + idx[0];
+          if(iBin < 0 || iBin >= maxhead) continue;
+
+          if(exact)
+          {
+            center[a] = center0[a] + (idx[a]-lo[a])*binsize[a];
+            if(!mesh_->resolveTriSphereNeighbuild(iTri, maxdiag, center, treshold))
+              continue;
+          }
+          binlist.push_back(iBin);
+        }
+      }
+    }
+
+    return nbox;
+}
+
+/* ----------------------------------------------------------------------
+   collect all bins in the bounding box of iTri. with exact, only bins
+   whose center is closer than treshold plus half the bin diagonal to the
+   triangle are kept
+   returns # of bins in the bounding box
+------------------------------------------------------------------------- */
+
+int FixNeighlistMesh::boundingBoxBins(int iTri, double treshold, bool exact, std::vector<int> & binlist)
+{
+    int ixMin,ixMax,iyMin,iyMax,izMin,izMax;
+    getBinBoundariesForTriangle(iTri,ixMin,ixMax,iyMin,iyMax,izMin,izMax);
+
+    binlist.clear();
+    if(ixMin > ixMax || iyMin > iyMax || izMin > izMax)
+        return 0;
+
+    const double dx = neighbor->binsizex / 2.0;
+    const double dy = neighbor->binsizey / 2.0;
+    const double dz = neighbor->binsizez / 2.0;
+    const double maxdiag = sqrt(dx * dx + dy * dy + dz * dz);
+
+    double center[3];
+    for(int ix = ixMin; ix <= ixMax; ix++) {
+      for(int iy = iyMin; iy <= iyMax; iy++) {
+        for(int iz = izMin; iz <= izMax; iz++) {
+          const int iBin = iz*mbiny*mbinx + iy*mbinx + ix;
+          if(iBin < 0 || iBin >= maxhead) continue;
+
+          if(exact)
+          {
+            neighbor->bin_center(ix, iy, iz, center);
+            if(!mesh_->resolveTriSphereNeighbuild(iTri, maxdiag, center, treshold))
+              continue;
+          }
+          binlist.push_back(iBin);
+        }
+      }
+    }
+
+    return (ixMax-ixMin+1)*(iyMax-iyMin+1)*(izMax-izMin+1);
+}
+
 /* ---------------------------------------------------------------------- */
 
 void FixNeighlistMesh::getBinBoundariesFromBoundingBox(BoundingBox &b,
@@ -500,6 +858,21 @@ void FixNeighlistMesh::getBinBoundariesForTriangle(int iTri, int &ixMin,int &ixM
 void FixNeighlistMesh::post_run()
 {
   last_bin_update = -1; // reset binning for possible next run
+  incrementalValid_ = false;
+}
+
+/* ----------------------------------------------------------------------
+   statistics of the last build, summed over procs
+------------------------------------------------------------------------- */
+
+double FixNeighlistMesh::compute_vector(int n)
+{
+  if(!stats_reduced_)
+  {
+    MPI_Allreduce(stats_,stats_all_,6,MPI_DOUBLE,MPI_SUM,world);
+    stats_reduced_ = true;
+  }
+  return stats_all_[n];
 }
 
 /* ---------------------------------------------------------------------- */
@@ -509,15 +882,10 @@ void FixNeighlistMesh::generate_bin_list(size_t nall)
   // precompute triangle bin boundaries
   // disable optimization for changing mesh or domain
   if (!(changingMesh || changingDomain)) {
-    double dx = neighbor->binsizex / 2.0;
-    double dy = neighbor->binsizey / 2.0;
-    double dz = neighbor->binsizez / 2.0;
-    double maxdiag = sqrt(dx * dx + dy * dy + dz * dz);
+    nbins_box_ = nbins_used_ = 0.;
 
     for (size_t iTri = 0; iTri < nall; iTri++) {
       TriangleNeighlist & triangle = triangles[iTri];
-      std::vector<int> & binlist = triangle.bins;
-      binlist.clear();
 
       BinBoundary& bb = triangle.boundary;
       BoundingBox b = mesh_->getElementBoundingBoxOnSubdomain(iTri);
@@ -525,32 +893,18 @@ void FixNeighlistMesh::generate_bin_list(size_t nall)
       // extend bbox by cutneighmax and get bin boundaries
       getBinBoundariesFromBoundingBox(b, bb.xlo, bb.xhi, bb.ylo, bb.yhi, bb.zlo, bb.zhi);
 
-      // look at bins and exclude unnecessary ones
-      double center[3];
-      int total = 0;
-      for (int ix = bb.xlo; ix <= bb.xhi; ix++) {
-        for (int iy = bb.ylo; iy <= bb.yhi; iy++) {
-          for (int iz = bb.zlo; iz <= bb.zhi; iz++) {
-            int iBin = iz * mbiny * mbinx + iy * mbinx + ix;
-            if (iBin < 0 || iBin >= maxhead)
-              continue;
-
-            // determine center of bin (ix, iy, iz)
-            neighbor->bin_center(ix, iy, iz, center);
+      // keep only bins close to the triangle
+      const int total = voxelizeTriangle(iTri, distmax + skin, true, triangle.bins);
+      nbins_box_ += total;
+      nbins_used_ += triangle.bins.size();
 
-            if (mesh_->resolveTriSphereNeighbuild(iTri, maxdiag, center, distmax + skin))
-            {
-              binlist.push_back(iBin);
-            }
-            total++;
-          }
-        }
-      }
-      /*NL*/ if (DEBUGMODE_LMP_FIX_NEIGHLIST_MESH && comm->me == 0 && screen) fprintf(screen, "triangle %lu bins: %lu / %d\n", iTri, binlist.size(), total);
-      /*NL*/ if (DEBUGMODE_LMP_FIX_NEIGHLIST_MESH && comm->me == 0 && logfile) fprintf(logfile, "triangle %lu bins: %lu / %d\n", iTri, binlist.size(), total);
+      /*NL*/ if (DEBUGMODE_LMP_FIX_NEIGHLIST_MESH && comm->me == 0 && screen) fprintf(screen, "triangle %lu bins: %lu / %d\n", iTri, triangle.bins.size(), total);
+      /*NL*/ if (DEBUGMODE_LMP_FIX_NEIGHLIST_MESH && comm->me == 0 && logfile) fprintf(logfile, "triangle %lu bins: %lu / %d\n", iTri, triangle.bins.size(), total);
     }
   }
 
+  // bin lists changed, so the next build is a full one
+  incrementalValid_ = false;
   last_bin_update = update->ntimestep;
 }
 
@@ -55,7 +55,6 @@ struct BinBoundary {
 };
 
 struct TriangleNeighlist {
-  std::vector<int> contacts;
   std::vector<int> bins;
   BinBoundary boundary;
   int nchecked;
@@ -83,8 +82,14 @@ class FixNeighlistMesh : public Fix
 
     virtual void post_run();
 
-    const std::vector<int> & get_contact_list(int iTri) const {
-      return triangles[iTri].contacts;
+    virtual double compute_vector(int n);
+
+    // returns # of neighbors of triangle iTri, neighbors points to their indices
+    inline int get_contact_list(int iTri, const int *&neighbors) const
+    {
+      const int numneigh = contacts_offset_[iTri+1] - contacts_offset_[iTri];
+      neighbors = numneigh > 0 ? &contacts_[contacts_offset_[iTri]] : NULL;
+      return numneigh;
     }
 
     virtual int getSizeNumContacts();
@@ -98,8 +103,9 @@ class FixNeighlistMesh : public Fix
 
     bool contactInList(int iTri, int iAtom)
     {
-      std::vector<int> & neighbors = triangles[iTri].contacts;
-      return std::find(neighbors.begin(), neighbors.end(), iAtom) != neighbors.end();
+      const int *neighbors;
+      const int numneigh = get_contact_list(iTri,neighbors);
+      return std::find(neighbors, neighbors+numneigh, iAtom) != neighbors+numneigh;
     }
 
     inline class FixPropertyAtom* fix_nneighs()
@@ -114,6 +120,10 @@ class FixNeighlistMesh : public Fix
   protected:
 
     void handleTriangle(int iTri);
+    void handleTriangleIncremental(int iTri);
+    int voxelizeTriangle(int iTri, double treshold, bool exact, std::vector<int> & binlist);
+    int boundingBoxBins(int iTri, double treshold, bool exact, std::vector<int> & binlist);
+    void snapshotBins();
     void getBinBoundariesFromBoundingBox(class BoundingBox &b, int &ixMin,int &ixMax,int &iyMin,int &iyMax,int &izMin,int &izMax);
     void getBinBoundariesForTriangle(int iTri, int &ixMin,int &ixMax,int &iyMin,int &iyMax,int &izMin,int &izMax);
 
@@ -127,6 +137,47 @@ class FixNeighlistMesh : public Fix
 
     std::vector<TriangleNeighlist> triangles;
 
+    // neighbor lists of all owned and ghost triangles, stored in one array
+    // neighbors of iTri are contacts_[contacts_offset_[iTri]] ... contacts_[contacts_offset_[iTri+1]-1]
+    std::vector<int> contacts_;
+    std::vector<int> contacts_offset_;
+
+    // incremental build for static mesh and domain
+    // only (triangle, bin) pairs whose bin changed since the last build are re-checked
+    bool incremental_;
+    bool incrementalValid_;
+    double drift_;
+
+    // candidates of each triangle, particles within drift_ beyond the
+    // neighbor distance when their bin was last checked: slot of the bin
+    // in the triangle's bin list and position of the particle among the
+    // bin residents; neighbors are the candidates within the neighbor distance
+    std::vector<int> candidates_offset_;
+    std::vector<int> candidate_slot_;
+    std::vector<int> candidate_ordinal_;
+    std::vector<int> candidates_offset_prev_, candidate_slot_prev_, candidate_ordinal_prev_;
+
+    // local particles in each bin, sorted by tag, and their tag, position and radius
+    // at the time the bin was last checked; *_prev_ for the previous build
+    std::vector<int> bin_offset_, bin_atoms_, bin_tags_;
+    std::vector<double> bin_xref_, bin_rref_;
+    std::vector<int> bin_offset_prev_, bin_tags_prev_;
+    std::vector<double> bin_xref_prev_, bin_rref_prev_;
+    std::vector<char> bin_dirty_;
+
+    // statistics of the last build: # of particle-triangle checks,
+    // # of triangles rebuilt, # of triangles, # of neighbors,
+    // # of bins in the bounding boxes of the triangles, # of bins used
+    double stats_[6];
+    double stats_all_[6];
+    bool stats_reduced_;
+
+    // bin statistics of the last bin list generation
+    double nbins_box_, nbins_used_;
+
+    // bins of one triangle for changing mesh or domain
+    std::vector<int> binlist_;
+
     int numAllContacts_;
     bool globalNumAllContacts_;
 
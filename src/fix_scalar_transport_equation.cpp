@@ -52,6 +52,9 @@ using namespace FixConst;
 FixScalarTransportEquation::FixScalarTransportEquation(LAMMPS *lmp, int narg, char **arg) : Fix(lmp, narg, arg)
 {
 
+  //NP pre_force() only communicates on reneighboring steps
+  comm_overlap = 1;
+
   if(strcmp(arg[2],"transportequation/scalar"))
     return;
 
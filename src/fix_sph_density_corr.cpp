@@ -182,13 +182,27 @@ void FixSphDensityCorr::init()
 void FixSphDensityCorr::pre_force(int)
 {
   //template function for using per atom or per atomtype smoothing length
-  if (mass_type) pre_force_eval<1>();
-  else pre_force_eval<0>();
+  if (mass_type) pre_force_kernel<1>();
+  else pre_force_kernel<0>();
 }
 
 /* ---------------------------------------------------------------------- */
 
 template <int MASSFLAG>
+void FixSphDensityCorr::pre_force_kernel()
+{
+  if (0) return;
+  #define SPH_KERNEL_CLASS
+  #define SPHKernel(id,kernelstyle,SPHKernelCalculation,SPHKernelCalculationDer,SPHKernelCalculationCut) \
+  else if (kernel_id == id) pre_force_eval<MASSFLAG,id>();
+  #include "style_sph_kernel.h"
+  #undef SPH_KERNEL_CLASS
+  #undef SPHKernel
+}
+
+/* ---------------------------------------------------------------------- */
+
+template <int MASSFLAG, int KERNEL_ID>
 void FixSphDensityCorr::pre_force_eval()
 {
   int i,j,ii,jj,inum,jnum,itype,jtype;
@@ -237,7 +251,7 @@ void FixSphDensityCorr::pre_force_eval()
 
         // this gets a value for W at self, perform error check
 
-        W = SPH_KERNEL_NS::sph_kernel(kernel_id,0.,sli,sliInv);
+        W = SPH_KERNEL_NS::sph_kernel<KERNEL_ID>(0.,sli,sliInv);
         if (W < 0.)
         {
           if (screen) fprintf(screen,"s = %f, W = %f\n",s,W);
@@ -302,7 +316,7 @@ void FixSphDensityCorr::pre_force_eval()
 
         // this gets a value for W at self, perform error check
 
-        W = SPH_KERNEL_NS::sph_kernel(kernel_id,s,slCom,slComInv);
+        W = SPH_KERNEL_NS::sph_kernel<KERNEL_ID>(s,slCom,slComInv);
         if (W < 0.)
         {
           if (screen) fprintf(screen,"s = %f, W = %f\n",s,W);
@@ -334,7 +348,7 @@ void FixSphDensityCorr::pre_force_eval()
 
         // this gets a value for W at self, perform error check
 
-        W = SPH_KERNEL_NS::sph_kernel(kernel_id,0.,sli,sliInv);
+        W = SPH_KERNEL_NS::sph_kernel<KERNEL_ID>(0.,sli,sliInv);
         if (W < 0.)
         {
           if (screen) fprintf(screen,"s = %f, W = %f\n",s,W);
@@ -404,7 +418,7 @@ void FixSphDensityCorr::pre_force_eval()
 
         // this gets a value for W at self, perform error check
 
-        W = SPH_KERNEL_NS::sph_kernel(kernel_id,s,slCom,slComInv);
+        W = SPH_KERNEL_NS::sph_kernel<KERNEL_ID>(s,slCom,slComInv);
         if (W < 0.)
         {
           if (screen) fprintf(screen,"s = %f, W = %f\n",s,W);
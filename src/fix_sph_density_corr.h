@@ -52,7 +52,8 @@ class FixSphDensityCorr : public FixSph {
   virtual void pre_force(int vflag);
 
  private:
-  template <int> void pre_force_eval();
+  template <int> void pre_force_kernel();
+  template <int,int> void pre_force_eval();
 
   class FixPropertyAtom* fix_quantity;
   char *quantity_name;
@@ -30,6 +30,7 @@ andreas.aigner@jku.at
 #include <string.h>
 #include <stdlib.h>
 #include "fix_sph_density_summation.h"
+#include "fix_sph_pressure.h"
 #include "update.h"
 #include "respa.h"
 #include "atom.h"
@@ -52,7 +53,9 @@ using namespace FixConst;
 /* ---------------------------------------------------------------------- */
 
 FixSPHDensitySum::FixSPHDensitySum(LAMMPS *lmp, int narg, char **arg) :
-  FixSph(lmp, narg, arg)
+  FixSph(lmp, narg, arg),
+  fused_(false),
+  fixPressure_(NULL)
 {
   int iarg = 0;
 
@@ -81,6 +84,13 @@ FixSPHDensitySum::FixSPHDensitySum(LAMMPS *lmp, int narg, char **arg) :
 
           iarg += 2;
 
+    } else if (strcmp(arg[iarg],"fused") == 0) {
+          if (iarg+2 > narg) error->fix_error(FLERR,this,"Illegal use of keyword 'fused'. Not enough input arguments");
+          if (strcmp(arg[iarg+1],"yes") == 0) fused_ = true;
+          else if (strcmp(arg[iarg+1],"no") == 0) fused_ = false;
+          else error->fix_error(FLERR,this,"Illegal use of keyword 'fused'. Expecting 'yes' or 'no'");
+          iarg += 2;
+
     } else error->fix_error(FLERR,this,"Wrong keyword.");
   }
 }
@@ -128,21 +138,69 @@ void FixSPHDensitySum::init()
 
   if(me == -1 && pres >= 0) error->fix_error(FLERR,this,"Fix sph/pressure has to be defined after sph/density/summation \n");
   if(pres == -1) error->fix_error(FLERR,this,"Requires to define a fix sph/pressure also \n");
+
+  // in fused mode the pair style sums the density right before the forces
+  // and this fix sets the pressure in the same pass
+
+  if (fused_) {
+    fixPressure_ = dynamic_cast<FixSPHPressure*>(modify->fix[pres]);
+    if (!fixPressure_) error->fix_error(FLERR,this,"Keyword 'fused' requires fix sph/pressure");
+    if (!force->pair_match("sph/artVisc/tensCorr",0))
+      error->fix_error(FLERR,this,"Keyword 'fused' requires pair_style sph/artVisc/tensCorr");
+
+    // fix sph/density/corr corrects rho in pre_force, the fused sum would
+    // overwrite the correction afterwards
+
+    for (int i = 0; i < modify->nfix; i++)
+      if (strcmp(modify->fix[i]->style,"sph/density/corr") == 0)
+        error->fix_error(FLERR,this,"Keyword 'fused' cannot be used together with fix sph/density/corr");
+  }
 }
 
 /* ---------------------------------------------------------------------- */
 
 void FixSPHDensitySum::post_integrate()
 {
-  //template function for using per atom or per atomtype smoothing length
-  if (mass_type) post_integrate_eval<1>();
-  else post_integrate_eval<0>();
+  if (fused_) return;
+
+  // template function for using per atom or per atomtype smoothing length
+  // and for the kernel, kernel_id is checked in FixSph::init()
+
+  if (mass_type) post_integrate_kernel<1>(false);
+  else post_integrate_kernel<0>(false);
+}
+
+/* ----------------------------------------------------------------------
+   fused pass, called by the pair style after the regular communication
+   ghost positions and smoothing lengths are current, so the self
+   contribution of ghosts is set locally, and rho and p of ghosts are
+   updated with one forward communication
+------------------------------------------------------------------------- */
+
+void FixSPHDensitySum::sum_density()
+{
+  if (mass_type) post_integrate_kernel<1>(true);
+  else post_integrate_kernel<0>(true);
 }
 
 /* ---------------------------------------------------------------------- */
 
 template <int MASSFLAG>
-void FixSPHDensitySum::post_integrate_eval()
+void FixSPHDensitySum::post_integrate_kernel(bool fused)
+{
+  if (0) return;
+  #define SPH_KERNEL_CLASS
+  #define SPHKernel(id,kernelstyle,SPHKernelCalculation,SPHKernelCalculationDer,SPHKernelCalculationCut) \
+  else if (kernel_id == id) post_integrate_eval<MASSFLAG,id>(fused);
+  #include "style_sph_kernel.h"
+  #undef SPH_KERNEL_CLASS
+  #undef SPHKernel
+}
+
+/* ---------------------------------------------------------------------- */
+
+template <int MASSFLAG, int KERNEL_ID>
+void FixSPHDensitySum::post_integrate_eval(bool fused)
 {
   int i,j,ii,jj,inum,jnum,itype,jtype;
   double xtmp,ytmp,ztmp,delx,dely,delz,rsq,r,s=0.,W;
@@ -163,7 +221,8 @@ void FixSPHDensitySum::post_integrate_eval()
   // reset and add rho contribution of self
 
   int nlocal = atom->nlocal;
-  for (i = 0; i < nlocal; i++) {
+  int nself = fused ? nlocal + atom->nghost : nlocal;
+  for (i = 0; i < nself; i++) {
     if (MASSFLAG) {
       itype = type[i];
       sli = sl[itype-1];
@@ -177,7 +236,7 @@ void FixSPHDensitySum::post_integrate_eval()
 
     // this gets a value for W at self, perform error check
 
-    W = SPH_KERNEL_NS::sph_kernel(kernel_id,0.,sli,sliInv);
+    W = SPH_KERNEL_NS::sph_kernel<KERNEL_ID>(0.,sli,sliInv);
     if (W < 0.)
     {
       if (screen) fprintf(screen,"s = %f, W = %f\n",s,W);
@@ -189,10 +248,12 @@ void FixSPHDensitySum::post_integrate_eval()
   }
 
   // need updated ghost positions and self contributions
-  timer->stamp();
-  comm->forward_comm();
 
-  timer->stamp(TIME_COMM);
+  if (!fused) {
+    timer->stamp();
+    comm->forward_comm();
+    timer->stamp(TIME_COMM);
+  }
 
   // loop over neighbors of my atoms
 
@@ -251,7 +312,7 @@ void FixSPHDensitySum::post_integrate_eval()
 
       // this gets a value for W at self, perform error check
 
-      W = SPH_KERNEL_NS::sph_kernel(kernel_id,s,slCom,slComInv);
+      W = SPH_KERNEL_NS::sph_kernel<KERNEL_ID>(s,slCom,slComInv);
       if (W < 0.)
       {
         if (screen) fprintf(screen,"s = %f, W = %f\n",s,W);
@@ -268,8 +329,14 @@ void FixSPHDensitySum::post_integrate_eval()
     }
   }
 
-  // rho is now correct, send to ghosts
-  timer->stamp();
+  // rho is now correct, in fused mode also set p before sending to ghosts
+  // and account the pass so far to the pair style calling it
+
+  if (fused) {
+    fixPressure_->update_pressure();
+    timer->stamp(TIME_PAIR);
+  } else timer->stamp();
+
   comm->forward_comm();
   timer->stamp(TIME_COMM);
 
@@ -46,8 +46,15 @@ class FixSPHDensitySum : public FixSph {
   virtual void init();
   virtual void post_integrate();
 
+  bool fused() const { return fused_; }
+  void sum_density();
+
  private:
-  template <int> void post_integrate_eval();
+  template <int> void post_integrate_kernel(bool);
+  template <int,int> void post_integrate_eval(bool);
+
+  bool fused_;                       // density summed by the pair style
+  class FixSPHPressure *fixPressure_;
 
 };
 
@@ -34,6 +34,7 @@ andreas.eitzlmayr@tugraz.at
 #include <string.h>
 #include <stdlib.h>
 #include "fix_sph_pressure.h"
+#include "fix_sph_density_summation.h"
 #include "update.h"
 #include "respa.h"
 #include "atom.h"
@@ -54,7 +55,8 @@ using namespace FixConst;
 /* ---------------------------------------------------------------------- */
 
 FixSPHPressure::FixSPHPressure(LAMMPS *lmp, int narg, char **arg) :
-  FixSph(lmp, narg, arg)
+  FixSph(lmp, narg, arg),
+  fusedDensity_(false)
 {
     //Check args
     int iarg = 3;
@@ -149,11 +151,25 @@ void FixSPHPressure::init()
   }
 
   if(dens == -1) error->fix_error(FLERR,this,"Requires to define a fix sph/density also \n");
+
+  // a fused density summation sets the pressure itself during the pair pass
+
+  FixSPHDensitySum *fixDensity = dynamic_cast<FixSPHDensitySum*>(modify->fix[dens]);
+  fusedDensity_ = fixDensity && fixDensity->fused();
 }
 
 /* ---------------------------------------------------------------------- */
 
 void FixSPHPressure::pre_force(int vflag)
+{
+  if (!fusedDensity_) update_pressure();
+}
+
+/* ----------------------------------------------------------------------
+   equation of state for owned particles
+------------------------------------------------------------------------- */
+
+void FixSPHPressure::update_pressure()
 {
   int *mask = atom->mask;
   double *rho = atom->rho;
@@ -51,6 +51,7 @@ class FixSPHPressure : public FixSph {
   int setmask();
   void init();
   void pre_force(int);
+  void update_pressure();
 
   double return_rho0() {
     if (pressureStyle == PRESSURESTYLE_ABSOLUT) return 0;
@@ -58,6 +59,7 @@ class FixSPHPressure : public FixSph {
   };
 
  private:
+  bool fusedDensity_; // pressure set by a fused fix sph/density/summation
   int pressureStyle;
   double B,rho0,rho0inv,gamma,P0;
 };
@@ -102,6 +102,7 @@ FixWallGran::FixWallGran(LAMMPS *lmp, int narg, char **arg) :
     // defaults
     store_force_ = false;
     store_force_contact_ = false;
+    batched_ = false;
     stress_flag_ = false;
     n_FixMesh_ = 0;
     dnum_ = 0;
@@ -115,6 +116,9 @@ FixWallGran::FixWallGran(LAMMPS *lmp, int narg, char **arg) :
 
     atom_type_wall_ = 1; // will be overwritten during execution, but other fixes require a value here
 
+    //NP pre_force() only builds primitive wall lists from owned particles
+    comm_overlap = 1;
+
     // initializations
     fix_wallforce_ = 0;
     fix_wallforce_contact_ = 0;
@@ -231,6 +235,14 @@ FixWallGran::FixWallGran(LAMMPS *lmp, int narg, char **arg) :
            else error->fix_error(FLERR,this,"expecting 'yes' or 'no' after keyword 'store_force_contact_'");
            hasargs = true;
            iarg_ += 2;
+        } else if (strcmp(arg[iarg_],"batched") == 0) {
+           if (iarg_+2 > narg)
+              error->fix_error(FLERR,this," not enough arguments");
+           if (strcmp(arg[iarg_+1],"yes") == 0) batched_ = true;
+           else if (strcmp(arg[iarg_+1],"no") == 0) batched_ = false;
+           else error->fix_error(FLERR,this,"expecting 'yes' or 'no' after keyword 'batched'");
+           hasargs = true;
+           iarg_ += 2;
         } else if (strcmp(arg[iarg_],"n_meshes") == 0) {
           if (meshwall_ != 1)
              error->fix_error(FLERR,this,"have to use keyword 'mesh' before using 'n_meshes'");
@@ -723,6 +735,12 @@ void FixWallGran::post_force_mesh(int vflag)
     cdata.computeflag = computeflag_;
     cdata.shearupdate = shearupdate_;
 
+#ifdef SUPERQUADRIC_ACTIVE_FLAG
+    const bool batched = batched_ && !atom->superquadric_flag;
+#else
+    const bool batched = batched_;
+#endif
+
     /*NL*/// if(comm->me == 3 && update->ntimestep == 3735 && screen)
     /*NL*///   fprintf(screen,"proc 3 start\n");
 
@@ -777,8 +795,12 @@ void FixWallGran::post_force_mesh(int vflag)
         // loop owned and ghost triangles
         for(int iTri = 0; iTri < nTriAll; iTri++)
         {
-          const std::vector<int> & neighborList = meshNeighlist->get_contact_list(iTri);
-          const int numneigh = neighborList.size();
+          const int * neighborList;
+          const int numneigh = meshNeighlist->get_contact_list(iTri,neighborList);
+
+          if(batched && numneigh > 0)
+            resolve_mesh_contacts_batched(mesh,iTri,neighborList,numneigh);
+          int iBatch = 0;
 
           for(int iCont = 0; iCont < numneigh; iCont++)
           {
@@ -789,8 +811,15 @@ void FixWallGran::post_force_mesh(int vflag)
 
             int idTri = mesh->id(iTri);
 
+            if(batched)
+            {
+              deltan = batchDeltan_[iBatch];
+              vectorCopy3D(&batchDelta_[3*iBatch],delta);
+              vectorCopy3D(&batchBary_[3*iBatch],bary);
+              iBatch++;
+            }
 #ifdef SUPERQUADRIC_ACTIVE_FLAG
-            if(atom->superquadric_flag)
+            else if(atom->superquadric_flag)
             {
               Superquadric particle(x_[iPart], quat_[iPart], shape_[iPart], blockiness_[iPart]);
 
@@ -805,13 +834,11 @@ void FixWallGran::post_force_mesh(int vflag)
 
               cdata.is_non_spherical = true; //by default it is false
             }
+#endif
             else
             {
               deltan = mesh->resolveTriSphereContactBary(iPart,iTri,radius_ ? radius_[iPart]:r0_,x_[iPart],delta,bary);
             }
-#else
-            deltan = mesh->resolveTriSphereContactBary(iPart,iTri,radius_ ? radius_[iPart]:r0_ ,x_[iPart],delta,bary);
-#endif
 
             if(deltan > cutneighmax_) continue;
 
@@ -841,8 +868,12 @@ void FixWallGran::post_force_mesh(int vflag)
         // loop owned and ghost particles
         for(int iTri = 0; iTri < nTriAll; iTri++)
         {
-          const std::vector<int> & neighborList = meshNeighlist->get_contact_list(iTri);
-          const int numneigh = neighborList.size();
+          const int * neighborList;
+          const int numneigh = meshNeighlist->get_contact_list(iTri,neighborList);
+
+          if(batched && numneigh > 0)
+            resolve_mesh_contacts_batched(mesh,iTri,neighborList,numneigh);
+          int iBatch = 0;
 
           for(int iCont = 0; iCont < numneigh; iCont++)
           {
@@ -853,8 +884,14 @@ void FixWallGran::post_force_mesh(int vflag)
 
             int idTri = mesh->id(iTri);
 
+            if(batched)
+            {
+              deltan = batchDeltan_[iBatch];
+              vectorCopy3D(&batchDelta_[3*iBatch],delta);
+              iBatch++;
+            }
 #ifdef SUPERQUADRIC_ACTIVE_FLAG
-            if(atom->superquadric_flag)
+            else if(atom->superquadric_flag)
             {
               Superquadric particle(x_[iPart], quat_[iPart], shape_[iPart], blockiness_[iPart]);
 
@@ -869,13 +906,11 @@ void FixWallGran::post_force_mesh(int vflag)
 
               cdata.is_non_spherical = true; //by default it is false
             }
+#endif
             else
             {
               deltan = mesh->resolveTriSphereContact(iPart,iTri,radius_ ? radius_[iPart]:r0_,x_[iPart],delta);
             }
-#else
-            deltan = mesh->resolveTriSphereContact(iPart,iTri,radius_ ? radius_[iPart]:r0_,x_[iPart],delta);
-#endif
 
             if(deltan > cutneighmax_) continue;
 
@@ -920,6 +955,34 @@ void FixWallGran::post_force_mesh(int vflag)
   }
 }
 
+/* ----------------------------------------------------------------------
+   distance of all owned particles in the contact list of triangle iTri
+   in one call, in the order of the contact list
+------------------------------------------------------------------------- */
+
+void FixWallGran::resolve_mesh_contacts_batched(TriMesh *mesh, int iTri, const int *neighborList, int numneigh)
+{
+    const int nlocal = atom->nlocal;
+
+    batchPart_.clear();
+    for(int iCont = 0; iCont < numneigh; iCont++)
+        if(neighborList[iCont] < nlocal)
+            batchPart_.push_back(neighborList[iCont]);
+
+    const int n = batchPart_.size();
+    if(n == 0) return;
+
+    if(static_cast<int>(batchDeltan_.size()) < n)
+    {
+        batchDeltan_.resize(n);
+        batchDelta_.resize(3*n);
+        batchBary_.resize(3*n);
+    }
+
+    mesh->resolveTriSphereContactBatch(iTri,n,&batchPart_[0],x_,radius_,r0_,
+                                       &batchDeltan_[0],&batchDelta_[0],&batchBary_[0]);
+}
+
 /* ----------------------------------------------------------------------
    post_force for primitive wall
 ------------------------------------------------------------------------- */
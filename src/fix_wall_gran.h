@@ -276,6 +276,14 @@ class FixWallGran : public Fix, public LIGGGHTS::IContactHistorySetup {
   // max neigh cutoff - as in Neighbor
   double cutneighmax_;
 
+  // batched sphere-triangle distance evaluation
+  // results for the owned particles in the contact list of one triangle
+  bool batched_;
+  std::vector<int> batchPart_;
+  std::vector<double> batchDeltan_, batchDelta_, batchBary_;
+
+  void resolve_mesh_contacts_batched(TriMesh *mesh, int iTri, const int *neighborList, int numneigh);
+
   virtual void post_force_wall(int vflag);
 
   inline void post_force_eval_contact(LCM::CollisionData & cdata, bool intersectflag, double * v_wall, int iMesh = -1, FixMeshSurface *fix_mesh = 0, TriMesh *mesh = 0, int iTri = 0);
@@ -51,6 +51,9 @@ namespace PairStyles {
 
     virtual double stressStrainExponent() = 0;
     virtual int64_t hashcode() = 0;
+
+    // number of counters the contact model reports per pass, see Pair::pvector
+    virtual int nstatistics() = 0;
   };
 
   /**
@@ -42,6 +42,7 @@
 #include "variable.h"
 #include "cfd_datacoupling.h"
 #include "cfd_datacoupling_one2one.h"
+#include "cfd_datacoupling_mpi_sparse.h"
 
 using namespace LAMMPS_NS;
 
@@ -239,3 +240,30 @@ void o2o_data_of_to_liggghts
 
 }
 
+/* ---------------------------------------------------------------------- */
+
+//NP region of the CFD domain on this rank, used to route particles
+//NP with the mpi/sparse data coupling
+void sparse_set_boundingbox(void *ptr, double *lo, double *hi)
+{
+    LAMMPS *lmp = (LAMMPS *) ptr;
+    FixCfdCoupling* fcfd = (FixCfdCoupling*)locate_coupling_fix(ptr);
+    CfdDatacouplingMPISparse* dc = dynamic_cast<CfdDatacouplingMPISparse*>(fcfd->get_dc());
+    if(!dc) lmp->error->one(FLERR,"sparse_set_boundingbox() requires data coupling 'mpi/sparse'");
+
+    dc->set_boundingbox(lo,hi);
+}
+
+/* ---------------------------------------------------------------------- */
+
+//NP tags of the particles or bodies routed to this rank by the mpi/sparse
+//NP data coupling in this coupling step, must be called on all ranks
+int sparse_get_tags(void *ptr, const char *type, int *&tags)
+{
+    LAMMPS *lmp = (LAMMPS *) ptr;
+    FixCfdCoupling* fcfd = (FixCfdCoupling*)locate_coupling_fix(ptr);
+    CfdDatacouplingMPISparse* dc = dynamic_cast<CfdDatacouplingMPISparse*>(fcfd->get_dc());
+    if(!dc) lmp->error->one(FLERR,"sparse_get_tags() requires data coupling 'mpi/sparse'");
+
+    return dc->received_tags(type,tags);
+}
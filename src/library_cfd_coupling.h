@@ -61,6 +61,9 @@ void o2o_data_of_to_liggghts
     const int ncollected
 );
 
+void sparse_set_boundingbox(void *ptr, double *lo, double *hi);
+int sparse_get_tags(void *ptr, const char *type, int *&tags);
+
 #ifdef __cplusplus
 //}
 #endif
@@ -773,12 +773,15 @@ double determinant_4x4(double *mat)
   return value;
 }
 
+//Newton's method, at most max_iters iterations, the number of iterations done is returned in iters
 void calc_contact_point(Superquadric *particleA, Superquadric *particleB,
-    double ratio, const double *initial_point1, double *result_point, double &fi, double &fj, bool *fail, LAMMPS_NS::Error *error)
+    double ratio, const double *initial_point1, double *result_point, double &fi, double &fj, bool *fail,
+    int max_iters, int *iters, LAMMPS_NS::Error *error)
 {
   const double tol1 = 1e-10; //tolerance
   const double tol2 = 1e-12;
   *fail = false;
+  *iters = 0;
 
   double mu, mu_sq;
   double F[4], F1[4], F2[4];
@@ -851,11 +854,12 @@ void calc_contact_point(Superquadric *particleA, Superquadric *particleB,
   J4[15] = 0.0;
   double delta[4] = {0.0};
   double delta_0[4] = {0.0};
-  const int Niter = 100000;
+  const int Niter = max_iters;
   double pointb[3], pointa[3];
   double J4_inv[16];
 
   for(int iter = 0; iter < Niter; iter++) {
+    *iters = iter + 1;
 
     merit2 = merit1;
     res2 = res1;
@@ -1385,10 +1389,12 @@ bool capsules_intersect(Superquadric *particleA, Superquadric *particleB, double
 }
 
 //calculate the contact point if no information about from the previous step available
+//the iterations of all continuation steps are summed up in iters
 bool calc_contact_point_if_no_previous_point_avaialable(CollisionData & cdata, Superquadric *particleA,
-    Superquadric *particleB, double *contact_point, double &fi, double &fj, LAMMPS_NS::Error *error)
+    Superquadric *particleB, double *contact_point, double &fi, double &fj, int max_iters, int *iters, LAMMPS_NS::Error *error)
 {
   bool fail_flag = false;
+  *iters = 0;
   const double ai = particleA->shape[0];
   const double bi = particleA->shape[1];
   const double ci = particleA->shape[2];
@@ -1422,8 +1428,10 @@ bool calc_contact_point_if_no_previous_point_avaialable(CollisionData & cdata, S
         contact_point[k] = ratio*particleB->center[k] + (1.0 - ratio)*particleA->center[k]; //contact point solution for spheres
     }
     LAMMPS_NS::vectorCopy3D(contact_point, pre_estimation);
+    int step_iters;
     MathExtraLiggghtsNonspherical::calc_contact_point(particleA, particleB,
-        ratio, pre_estimation, contact_point, fi, fj, &fail_flag, error);
+        ratio, pre_estimation, contact_point, fi, fj, &fail_flag, max_iters, &step_iters, error);
+    *iters += step_iters;
 
     particleA->set_shape(ai, bi, ci); //set actual shape parameters back
     particleB->set_shape(aj, bj, cj);
@@ -1435,9 +1443,11 @@ bool calc_contact_point_if_no_previous_point_avaialable(CollisionData & cdata, S
 
 //calculate the contact point using information from previous step
 bool calc_contact_point_using_prev_step(CollisionData & cdata, Superquadric *particleA, Superquadric *particleB,
-    double ratio, double dt, double *prev_step_point, double *contact_point, double &fi, double &fj, LAMMPS_NS::Error *error)
+    double ratio, double dt, double *prev_step_point, double *contact_point, double &fi, double &fj,
+    int max_iters, int *iters, LAMMPS_NS::Error *error)
 {
   bool fail_flag = false;
+  *iters = 0;
 
   #ifdef SUPERQUADRIC_ACTIVE_FLAG
 
@@ -1459,7 +1469,7 @@ bool calc_contact_point_using_prev_step(CollisionData & cdata, Superquadric *par
   for(int k = 0; k < 3; k++)
     estimation[k] = prev_step_point[k] + v_eff[k]*dt; //contact point estimation
 
-  MathExtraLiggghtsNonspherical::calc_contact_point(particleA, particleB, ratio, estimation, contact_point, fi, fj, &fail_flag, error);
+  MathExtraLiggghtsNonspherical::calc_contact_point(particleA, particleB, ratio, estimation, contact_point, fi, fj, &fail_flag, max_iters, iters, error);
   #endif
 
   return fail_flag;
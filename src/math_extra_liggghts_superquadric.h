@@ -53,14 +53,16 @@ namespace MathExtraLiggghtsNonspherical {
       double *result_point1, double *result_point2, bool *fail);
 
   void calc_contact_point(Superquadric *particle_i, Superquadric *particle_j,
-      double ratio, const double *initial_point1, double *result_point, double &fi, double &fj, bool *fail, LAMMPS_NS::Error *error);
+      double ratio, const double *initial_point1, double *result_point, double &fi, double &fj, bool *fail,
+      int max_iters, int *iters, LAMMPS_NS::Error *error);
 
   bool capsules_intersect(Superquadric *particle_i, Superquadric *particle_j, double *capsule_contact_point);
 
   bool calc_contact_point_if_no_previous_point_avaialable(CollisionData & cdata, Superquadric *particle_i, Superquadric *particle_j,
-      double *contact_point, double &fi, double &fj,LAMMPS_NS::Error *error);
+      double *contact_point, double &fi, double &fj, int max_iters, int *iters, LAMMPS_NS::Error *error);
   bool calc_contact_point_using_prev_step(CollisionData & cdata, Superquadric *particle_i, Superquadric *particle_j,
-      double ratio, double dt, double *prev_step_point, double *contact_point, double &fi, double &fj, LAMMPS_NS::Error *error);
+      double ratio, double dt, double *prev_step_point, double *contact_point, double &fi, double &fj,
+      int max_iters, int *iters, LAMMPS_NS::Error *error);
   void basic_overlap_algorithm(CollisionData & cdata, Superquadric *particle_i, Superquadric *particle_j,
       double &alphai, double &alphaj, const double *contact_point, double *contact_point_i, double *contact_point_j);
   double extended_overlap_algorithm(Superquadric *particleA, Superquadric *particleB,
@@ -239,6 +239,7 @@ void Min::setup()
   modify->setup_pre_neighbor();
   neighbor->build();
   neighbor->ncalls = 0;
+  neighbor->npaircheck = neighbor->npairaccept = 0;
 
   // remove these restriction eventually
 
@@ -327,6 +328,7 @@ void Min::setup_minimal(int flag)
     modify->setup_pre_neighbor();
     neighbor->build();
     neighbor->ncalls = 0;
+    neighbor->npaircheck = neighbor->npairaccept = 0;
   }
 
   // atoms may have migrated in comm->exchange()
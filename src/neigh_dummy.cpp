@@ -1 +0,0 @@
-#include "neigh_dummy.h"
@@ -32,7 +32,9 @@
 #include "atom.h"
 #include "group.h"
 #include "update.h"
+#include "domain.h"
 #include "fix_contact_history.h" //NP modified C.K.
+#include "neigh_multi_level_grid.h" //NP modified C.K.
 #include "error.h"
 
 using namespace LAMMPS_NS;
@@ -57,7 +59,6 @@ void Neighbor::granular_nsq_no_newton(NeighList *list)
   double *shearptr = NULL;
 
   NeighList *listgranhistory;
-  int *npartner = NULL,**partner = NULL;
   double **contacthistory = NULL; //NP modified C.K.
   int **firsttouch;
   double **firstshear;
@@ -85,8 +86,6 @@ void Neighbor::granular_nsq_no_newton(NeighList *list)
 
   FixContactHistory *fix_history = list->fix_history; //NP modified C.K.
   if (fix_history) {
-    npartner = fix_history->npartner_; //NP modified C.K.
-    partner = fix_history->partner_; //NP modified C.K.
     contacthistory = fix_history->contacthistory_; //NP modified C.K.
     listgranhistory = list->listgranhistory;
     firsttouch = listgranhistory->firstneigh;
@@ -121,7 +120,7 @@ void Neighbor::granular_nsq_no_newton(NeighList *list)
 
     for (j = i+1; j < nall; j++) {
       if (includegroup && !(mask[j] & bitmask)) continue;
-      if (exclude && exclusion(i,j,type[i],type[j],mask,molecule)) continue;
+      if (exbody && molecule[i] == molecule[j] && (mask[i] & mask[j] & exbody_bit)) continue;
 
       delx = xtmp - x[j][0];
       dely = ytmp - x[j][1];
@@ -131,14 +130,14 @@ void Neighbor::granular_nsq_no_newton(NeighList *list)
       cutsq = (radsum+skin) * (radsum+skin);
 
       if (rsq <= cutsq) {
+        if (exclude && exclusion(i,j,type[i],type[j],mask,molecule)) continue;
         neighptr[n] = j;
 
         if (fix_history) {
           if (rsq < radsum*radsum)
           {
-            for (m = 0; m < npartner[i]; m++)
-              if (partner[i][m] == tag[j]) break;
-            if (m < npartner[i]) {
+            m = fix_history->find_partner(i,tag[j]);
+            if (m >= 0) {
               touchptr[n] = 1;
               for (d = 0; d < dnum; d++) {  //NP modified C.K.
                 shearptr[nn++] = contacthistory[i][m*dnum+d];
@@ -246,7 +245,7 @@ void Neighbor::granular_nsq_newton(NeighList *list)
         }
       }
 
-      if (exclude && exclusion(i,j,type[i],type[j],mask,molecule)) continue;
+      if (exbody && molecule[i] == molecule[j] && (mask[i] & mask[j] & exbody_bit)) continue;
 
       delx = xtmp - x[j][0];
       dely = ytmp - x[j][1];
@@ -255,7 +254,8 @@ void Neighbor::granular_nsq_newton(NeighList *list)
       radsum = (radi + radius[j]) * contactDistanceFactor;
       cutsq = (radsum+skin) * (radsum+skin);
 
-      if (rsq <= cutsq) neighptr[n++] = j;
+      if (rsq <= cutsq && !(exclude && exclusion(i,j,type[i],type[j],mask,molecule)))
+        neighptr[n++] = j;
     }
 
     ilist[inum++] = i;
@@ -291,7 +291,6 @@ void Neighbor::granular_bin_no_newton_ghost(NeighList *list)
   double *shearptr = NULL;
 
   NeighList *listgranhistory;
-  int *npartner = NULL,**partner = NULL;
   double **contacthistory = NULL;
   int **firsttouch = NULL;
   double **firstshear = NULL;
@@ -324,8 +323,6 @@ void Neighbor::granular_bin_no_newton_ghost(NeighList *list)
 
   FixContactHistory *fix_history = list->fix_history; //NP modified C.K.
   if (fix_history) {
-    npartner = fix_history->npartner_; //NP modified C.K.
-    partner = fix_history->partner_; //NP modified C.K.
     contacthistory = fix_history->contacthistory_; //NP modified C.K.
     listgranhistory = list->listgranhistory;
     firsttouch = listgranhistory->firstneigh;
@@ -371,7 +368,7 @@ void Neighbor::granular_bin_no_newton_ghost(NeighList *list)
       for (k = 0; k < nstencil; k++) {
         for (j = binhead[ibin+stencil[k]]; j >= 0; j = bins[j]) {
           if (j <= i) continue;
-          if (exclude && exclusion(i,j,type[i],type[j],mask,molecule)) continue;
+          if (exbody && molecule[i] == molecule[j] && (mask[i] & mask[j] & exbody_bit)) continue;
 
           delx = xtmp - x[j][0];
           dely = ytmp - x[j][1];
@@ -382,6 +379,7 @@ void Neighbor::granular_bin_no_newton_ghost(NeighList *list)
           /*NL*/ //if (screen) fprintf(screen,"checking local indices %d %d\n",i,j);
 
           if (rsq <= cutsq) {
+            if (exclude && exclusion(i,j,type[i],type[j],mask,molecule)) continue;
             neighptr[n] = j;
             /*NL*/ //if (screen) fprintf(screen,"  found local indices %d %d\n",i,j);
             /*NL*/ //if (screen) printVec3D(screen,"  xi",x[i]);
@@ -389,9 +387,8 @@ void Neighbor::granular_bin_no_newton_ghost(NeighList *list)
             if (fix_history) {
               if (rsq < radsum*radsum)
               {
-                for (m = 0; m < npartner[i]; m++)
-                  if (partner[i][m] == tag[j]) break;
-                if (m < npartner[i]) {
+                m = fix_history->find_partner(i,tag[j]);
+                if (m >= 0) {
                   touchptr[n] = 1;
                   for (d = 0; d < dnum; d++) { //NP modified C.K.
                     shearptr[nn++] = contacthistory[i][m*dnum+d];
@@ -426,7 +423,7 @@ void Neighbor::granular_bin_no_newton_ghost(NeighList *list)
         for (j = binhead[ibin+stencil[k]]; j >= 0; j = bins[j]) {
           if (j <= i) continue;
 
-          if (exclude && exclusion(i,j,type[i],type[j],mask,molecule)) continue;
+          if (exbody && molecule[i] == molecule[j] && (mask[i] & mask[j] & exbody_bit)) continue;
 
           delx = xtmp - x[j][0];
           dely = ytmp - x[j][1];
@@ -435,7 +432,8 @@ void Neighbor::granular_bin_no_newton_ghost(NeighList *list)
           radsum = (radi + radius[j]) * contactDistanceFactor; //NP modified C.K.
           cutsq = (radsum+skin) * (radsum+skin);
 
-          if (rsq <= cutsq) neighptr[n++] = j;
+          if (rsq <= cutsq && !(exclude && exclusion(i,j,type[i],type[j],mask,molecule)))
+            neighptr[n++] = j;
         }
       }
     }
@@ -478,7 +476,6 @@ void Neighbor::granular_bin_no_newton(NeighList *list)
   double *shearptr = NULL;
 
   NeighList *listgranhistory;
-  int *npartner = NULL,**partner = NULL;
   double **contacthistory = NULL;
   int **firsttouch = NULL;
   double **firstshear = NULL;
@@ -510,8 +507,6 @@ void Neighbor::granular_bin_no_newton(NeighList *list)
 
   FixContactHistory *fix_history = list->fix_history; //NP modified C.K.
   if (fix_history) {
-    npartner = fix_history->npartner_; //NP modified C.K.
-    partner = fix_history->partner_; //NP modified C.K.
     contacthistory = fix_history->contacthistory_; //NP modified C.K.
     listgranhistory = list->listgranhistory;
     firsttouch = listgranhistory->firstneigh;
@@ -521,6 +516,8 @@ void Neighbor::granular_bin_no_newton(NeighList *list)
     dnum = listgranhistory->dnum; //NP modified C.K.
   }
 
+  bigint ncheck = 0, naccept = 0;
+
   int inum = 0;
   ipage->reset();
         if (fix_history) {
@@ -553,7 +550,8 @@ void Neighbor::granular_bin_no_newton(NeighList *list)
     for (k = 0; k < nstencil; k++) {
       for (j = binhead[ibin+stencil[k]]; j >= 0; j = bins[j]) {
         if (j <= i) continue;
-        if (exclude && exclusion(i,j,type[i],type[j],mask,molecule)) continue;
+        if (exbody && molecule[i] == molecule[j] && (mask[i] & mask[j] & exbody_bit)) continue;
+        ncheck++;
 
         delx = xtmp - x[j][0];
         dely = ytmp - x[j][1];
@@ -564,6 +562,8 @@ void Neighbor::granular_bin_no_newton(NeighList *list)
         /*NL*/ //if (screen) fprintf(screen,"checking local indices %d %d\n",i,j);
 
         if (rsq <= cutsq) {
+          if (exclude && exclusion(i,j,type[i],type[j],mask,molecule)) continue;
+          naccept++;
           neighptr[n] = j;
           /*NL*/ //if (screen) fprintf(screen,"  found local indices %d %d\n",i,j);
           /*NL*/ //if (screen) printVec3D(screen,"  xi",x[i]);
@@ -571,9 +571,8 @@ void Neighbor::granular_bin_no_newton(NeighList *list)
           if (fix_history) {
             if (rsq < radsum*radsum)
                 {
-              for (m = 0; m < npartner[i]; m++)
-                if (partner[i][m] == tag[j]) break;
-              if (m < npartner[i]) {
+              m = fix_history->find_partner(i,tag[j]);
+              if (m >= 0) {
                 touchptr[n] = 1;
                 for (d = 0; d < dnum; d++) { //NP modified C.K.
                   shearptr[nn++] = contacthistory[i][m*dnum+d];
@@ -612,6 +611,187 @@ void Neighbor::granular_bin_no_newton(NeighList *list)
   }
 
   list->inum = inum;
+  npaircheck += ncheck;
+  npairaccept += naccept;
+}
+
+/* ----------------------------------------------------------------------
+   granular particles
+   binned neighbor list construction with partial rebuild
+   lists of atoms in bins near an atom that moved since the last build
+   are built as in granular_bin_no_newton, all others are copied from the
+   last build via tags
+   own/own pairs are stored by the atom with the smaller tag, so each
+   pair is stored once regardless of which of the two lists is rebuilt
+------------------------------------------------------------------------- */
+
+void Neighbor::granular_bin_no_newton_partial(NeighList *list)
+{
+  int i,j,k,m,n,nn=0,ibin,d,iold;
+  double xtmp,ytmp,ztmp,delx,dely,delz,rsq;
+  double radi,radsum,cutsq;
+  int *neighptr,*touchptr = NULL;
+  double *shearptr = NULL;
+
+  NeighList *listgranhistory;
+  double **contacthistory = NULL;
+  int **firsttouch = NULL;
+  double **firstshear = NULL;
+  MyPage<int> *ipage_touch = NULL;
+  MyPage<double> *dpage_shear = NULL;
+  int dnum = 0;
+
+  // bin local & ghost atoms
+  // flag bins close to moved atoms, map atoms to lists of last build
+
+  bin_atoms();
+  partial_setup();
+
+  double **x = atom->x;
+  double *radius = atom->radius;
+  int *tag = atom->tag;
+  int *type = atom->type;
+  int *mask = atom->mask;
+  int *molecule = atom->molecule;
+  int nlocal = atom->nlocal;
+
+  int *ilist = list->ilist;
+  int *numneigh = list->numneigh;
+  int **firstneigh = list->firstneigh;
+  int nstencil = list->nstencil;
+  int *stencil = list->stencil;
+  MyPage<int> *ipage = list->ipage;
+
+  FixContactHistory *fix_history = list->fix_history;
+  if (fix_history) {
+    contacthistory = fix_history->contacthistory_;
+    listgranhistory = list->listgranhistory;
+    firsttouch = listgranhistory->firstneigh;
+    firstshear = listgranhistory->firstdouble;
+    ipage_touch = listgranhistory->ipage;
+    dpage_shear = listgranhistory->dpage;
+    dnum = listgranhistory->dnum;
+  }
+
+  bigint ncheck = 0, naccept = 0;
+  bigint nbuild = 0, nreuse = 0;
+
+  int inum = 0;
+  ipage->reset();
+  if (fix_history) {
+    ipage_touch->reset();
+    dpage_shear->reset();
+  }
+
+  for (i = 0; i < nlocal; i++) {
+    n = 0;
+    neighptr = ipage->vget();
+
+    xtmp = x[i][0];
+    ytmp = x[i][1];
+    ztmp = x[i][2];
+    radi = radius[i];
+    ibin = coord2bin(x[i]);
+
+    // reuse list of last build if no atom close by has moved
+    // pairs are mapped to the closest image of the partner
+    // if a partner no longer exists, the list is rebuilt
+
+    iold = partial_oldindex[i];
+    int reuse = (iold >= 0 && !partial_dirty[ibin]);
+    if (reuse) {
+      for (k = partial_offset[iold]; k < partial_offset[iold+1]; k++) {
+        j = atom->map(partial_neigh[k]);
+        if (j < 0) {
+          reuse = 0;
+          n = 0;
+          break;
+        }
+        neighptr[n++] = domain->closest_image(i,j);
+      }
+    }
+
+    // loop over all atoms in surrounding bins in stencil excluding self
+    // stores own/own pairs only once, by the atom with the smaller tag
+    // stores own/ghost pairs on both procs
+
+    if (!reuse) {
+      for (k = 0; k < nstencil; k++) {
+        for (j = binhead[ibin+stencil[k]]; j >= 0; j = bins[j]) {
+          if (j == i || (j < nlocal && tag[j] < tag[i])) continue;
+          if (exbody && molecule[i] == molecule[j] && (mask[i] & mask[j] & exbody_bit)) continue;
+          ncheck++;
+
+          delx = xtmp - x[j][0];
+          dely = ytmp - x[j][1];
+          delz = ztmp - x[j][2];
+          rsq = delx*delx + dely*dely + delz*delz;
+          radsum = (radi + radius[j]) * contactDistanceFactor;
+          cutsq = (radsum+skin) * (radsum+skin);
+
+          if (rsq <= cutsq) {
+            if (exclude && exclusion(i,j,type[i],type[j],mask,molecule)) continue;
+            naccept++;
+            neighptr[n++] = j;
+          }
+        }
+      }
+      nbuild += n;
+    } else nreuse += n;
+
+    // contact history of all stored pairs
+
+    if (fix_history) {
+      nn = 0;
+      touchptr = ipage_touch->vget();
+      shearptr = dpage_shear->vget();
+
+      for (k = 0; k < n; k++) {
+        j = neighptr[k];
+        delx = xtmp - x[j][0];
+        dely = ytmp - x[j][1];
+        delz = ztmp - x[j][2];
+        rsq = delx*delx + dely*dely + delz*delz;
+        radsum = (radi + radius[j]) * contactDistanceFactor;
+
+        m = -1;
+        if (rsq < radsum*radsum)
+          m = fix_history->find_partner(i,tag[j]);
+        if (m >= 0) {
+          touchptr[k] = 1;
+          for (d = 0; d < dnum; d++)
+            shearptr[nn++] = contacthistory[i][m*dnum+d];
+        } else {
+          touchptr[k] = 0;
+          for (d = 0; d < dnum; d++)
+            shearptr[nn++] = 0.0;
+        }
+      }
+    }
+
+    ilist[inum++] = i;
+    firstneigh[i] = neighptr;
+    numneigh[i] = n;
+    ipage->vgot(n);
+    if (ipage->status())
+      error->one(FLERR,"Neighbor list overflow, boost neigh_modify one");
+    if (fix_history) {
+      firsttouch[i] = touchptr;
+      firstshear[i] = shearptr;
+      ipage_touch->vgot(n);
+      dpage_shear->vgot(nn);
+    }
+  }
+
+  list->inum = inum;
+  npaircheck += ncheck;
+  npairaccept += naccept;
+  npartialbuild += nbuild;
+  npartialreuse += nreuse;
+
+  // store lists by tag for next build
+
+  partial_store(list);
 }
 
 /* ----------------------------------------------------------------------
@@ -676,7 +856,7 @@ void Neighbor::granular_bin_newton(NeighList *list)
         }
       }
 
-      if (exclude && exclusion(i,j,type[i],type[j],mask,molecule)) continue;
+      if (exbody && molecule[i] == molecule[j] && (mask[i] & mask[j] & exbody_bit)) continue;
 
       delx = xtmp - x[j][0];
       dely = ytmp - x[j][1];
@@ -685,7 +865,8 @@ void Neighbor::granular_bin_newton(NeighList *list)
       radsum = (radi + radius[j]) * contactDistanceFactor; //NP modified C.K.
       cutsq = (radsum+skin) * (radsum+skin);
 
-      if (rsq <= cutsq) neighptr[n++] = j;
+      if (rsq <= cutsq && !(exclude && exclusion(i,j,type[i],type[j],mask,molecule)))
+        neighptr[n++] = j;
     }
 
     // loop over all atoms in other bins in stencil, store every pair
@@ -693,7 +874,7 @@ void Neighbor::granular_bin_newton(NeighList *list)
     ibin = coord2bin(x[i]);
     for (k = 0; k < nstencil; k++) {
       for (j = binhead[ibin+stencil[k]]; j >= 0; j = bins[j]) {
-        if (exclude && exclusion(i,j,type[i],type[j],mask,molecule)) continue;
+        if (exbody && molecule[i] == molecule[j] && (mask[i] & mask[j] & exbody_bit)) continue;
 
         delx = xtmp - x[j][0];
         dely = ytmp - x[j][1];
@@ -702,7 +883,8 @@ void Neighbor::granular_bin_newton(NeighList *list)
         radsum = radi + radius[j];
         cutsq = (radsum+skin) * (radsum+skin);
 
-        if (rsq <= cutsq) neighptr[n++] = j;
+        if (rsq <= cutsq && !(exclude && exclusion(i,j,type[i],type[j],mask,molecule)))
+          neighptr[n++] = j;
       }
     }
 
@@ -784,7 +966,7 @@ void Neighbor::granular_bin_newton_tri(NeighList *list)
           }
         }
 
-        if (exclude && exclusion(i,j,type[i],type[j],mask,molecule)) continue;
+        if (exbody && molecule[i] == molecule[j] && (mask[i] & mask[j] & exbody_bit)) continue;
 
         delx = xtmp - x[j][0];
         dely = ytmp - x[j][1];
@@ -793,7 +975,8 @@ void Neighbor::granular_bin_newton_tri(NeighList *list)
         radsum = (radi + radius[j]) * contactDistanceFactor; //NP modified C.K.
         cutsq = (radsum+skin) * (radsum+skin);
 
-        if (rsq <= cutsq) neighptr[n++] = j;
+        if (rsq <= cutsq && !(exclude && exclusion(i,j,type[i],type[j],mask,molecule)))
+          neighptr[n++] = j;
       }
     }
 
@@ -807,3 +990,167 @@ void Neighbor::granular_bin_newton_tri(NeighList *list)
 
   list->inum = inum;
 }
+
+/* ----------------------------------------------------------------------
+   granular particles
+   multi-level binned neighbor list construction with partial Newton's 3rd law
+   shear history must be accounted for when a neighbor pair is added
+   each atom is binned into the grid of its size level
+   each owned atom i checks the bins of every level, using the stencil
+     for its own level vs. the searched level
+   pair stored once if i,j are both owned and i < j
+   pair stored by me if j is ghost (also stored by proc owning j)
+------------------------------------------------------------------------- */
+
+void Neighbor::granular_multi_no_newton(NeighList *list)
+{
+  int i,j,k,m,n,nn=0,ibin,d;
+  double xtmp,ytmp,ztmp,delx,dely,delz,rsq;
+  double radi,radsum,cutsq;
+  int *neighptr,*touchptr = NULL;
+  double *shearptr = NULL;
+
+  NeighList *listgranhistory;
+  double **contacthistory = NULL;
+  int **firsttouch = NULL;
+  double **firstshear = NULL;
+  MyPage<int> *ipage_touch = NULL;
+  MyPage<double> *dpage_shear = NULL;
+  int dnum = 0;
+
+  // bin local & ghost atoms, each into the grid of its level
+
+  mlg->bin_atoms();
+
+  // loop over each atom, storing neighbors
+
+  double **x = atom->x;
+  double *radius = atom->radius;
+  int *tag = atom->tag;
+  int *type = atom->type;
+  int *mask = atom->mask;
+  int *molecule = atom->molecule;
+  int nlocal = atom->nlocal;
+  if (includegroup) nlocal = atom->nfirst;
+
+  int *ilist = list->ilist;
+  int *numneigh = list->numneigh;
+  int **firstneigh = list->firstneigh;
+  int **nstencil_multigran = list->nstencil_multigran;
+  int ***stencil_multigran = list->stencil_multigran;
+  MyPage<int> *ipage = list->ipage;
+
+  const int nlevels = mlg->nlevels;
+  int *atomlevel = mlg->atomlevel;
+  int *mlgbins = mlg->bins;
+
+  FixContactHistory *fix_history = list->fix_history;
+  if (fix_history) {
+    contacthistory = fix_history->contacthistory_;
+    listgranhistory = list->listgranhistory;
+    firsttouch = listgranhistory->firstneigh;
+    firstshear = listgranhistory->firstdouble;
+    ipage_touch = listgranhistory->ipage;
+    dpage_shear = listgranhistory->dpage;
+    dnum = listgranhistory->dnum;
+  }
+
+  bigint ncheck = 0, naccept = 0;
+
+  int inum = 0;
+  ipage->reset();
+  if (fix_history) {
+    ipage_touch->reset();
+    dpage_shear->reset();
+  }
+
+  for (i = 0; i < nlocal; i++) {
+    n = 0;
+    neighptr = ipage->vget();
+    if (fix_history) {
+      nn = 0;
+      touchptr = ipage_touch->vget();
+      shearptr = dpage_shear->vget();
+    }
+
+    xtmp = x[i][0];
+    ytmp = x[i][1];
+    ztmp = x[i][2];
+    radi = radius[i];
+    const int ilevel = atomlevel[i];
+
+    // loop over all levels and all atoms in surrounding bins of that level
+    // only store pair if i < j
+    // stores own/own pairs only once
+    // stores own/ghost pairs on both procs
+
+    for (int jlevel = 0; jlevel < nlevels; jlevel++) {
+      int *binhead_level = mlg->binhead[jlevel];
+      int *s = stencil_multigran[ilevel][jlevel];
+      const int ns = nstencil_multigran[ilevel][jlevel];
+      ibin = mlg->coord2bin(x[i],jlevel);
+
+      for (k = 0; k < ns; k++) {
+        for (j = binhead_level[ibin+s[k]]; j >= 0; j = mlgbins[j]) {
+          if (j <= i) continue;
+          if (exbody && molecule[i] == molecule[j] && (mask[i] & mask[j] & exbody_bit)) continue;
+          ncheck++;
+
+          delx = xtmp - x[j][0];
+          dely = ytmp - x[j][1];
+          delz = ztmp - x[j][2];
+          rsq = delx*delx + dely*dely + delz*delz;
+          radsum = (radi + radius[j]) * contactDistanceFactor;
+          cutsq = (radsum+skin) * (radsum+skin);
+
+          if (rsq <= cutsq) {
+            if (exclude && exclusion(i,j,type[i],type[j],mask,molecule)) continue;
+            naccept++;
+            neighptr[n] = j;
+            if (fix_history) {
+              if (rsq < radsum*radsum)
+              {
+                m = fix_history->find_partner(i,tag[j]);
+                if (m >= 0) {
+                  touchptr[n] = 1;
+                  for (d = 0; d < dnum; d++) {
+                    shearptr[nn++] = contacthistory[i][m*dnum+d];
+                  }
+                } else {
+                  touchptr[n] = 0;
+                  for (d = 0; d < dnum; d++) {
+                    shearptr[nn++] = 0.0;
+                  }
+                }
+              } else {
+                touchptr[n] = 0;
+                for (d = 0; d < dnum; d++) {
+                  shearptr[nn++] = 0.0;
+                }
+              }
+            }
+
+            n++;
+          }
+        }
+      }
+    }
+
+    ilist[inum++] = i;
+    firstneigh[i] = neighptr;
+    numneigh[i] = n;
+    ipage->vgot(n);
+    if (ipage->status())
+      error->one(FLERR,"Neighbor list overflow, boost neigh_modify one");
+    if (fix_history) {
+      firsttouch[i] = touchptr;
+      firstshear[i] = shearptr;
+      ipage_touch->vgot(n);
+      dpage_shear->vgot(nn);
+    }
+  }
+
+  list->inum = inum;
+  npaircheck += ncheck;
+  npairaccept += naccept;
+}
@@ -0,0 +1,276 @@
+/* ----------------------------------------------------------------------
+   LIGGGHTS - LAMMPS Improved for General Granular and Granular Heat
+   Transfer Simulations
+
+   LIGGGHTS is part of the CFDEMproject
+   www.liggghts.com | www.cfdem.com
+
+   Christoph Kloss, christoph.kloss@cfdem.com
+   Copyright 2009-2012 JKU Linz
+   Copyright 2012-     DCS Computing GmbH, Linz
+
+   LIGGGHTS is based on LAMMPS
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   This software is distributed under the GNU General Public License.
+
+   See the README file in the top-level directory.
+------------------------------------------------------------------------- */
+
+#include <math.h>
+#include "neigh_multi_level_grid.h"
+#include "neighbor.h"
+#include "atom.h"
+#include "comm.h"
+#include "domain.h"
+#include "memory.h"
+#include "error.h"
+
+using namespace LAMMPS_NS;
+
+#define SMALL 1.0e-6
+#define CUT2BIN_RATIO 100
+
+/* ---------------------------------------------------------------------- */
+
+MultiLevelGrid::MultiLevelGrid(LAMMPS *lmp) : Pointers(lmp),
+  nlevels(0),
+  bins(NULL),
+  atomlevel(NULL),
+  maxbin(0),
+  skin(0.)
+{
+  for(int lev = 0; lev < MAXLEVELS; lev++)
+  {
+    rcutlevel[lev] = 0.;
+    binhead[lev] = NULL;
+    maxhead[lev] = 0;
+    mbins[lev] = 0;
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+MultiLevelGrid::~MultiLevelGrid()
+{
+  for(int lev = 0; lev < MAXLEVELS; lev++)
+    memory->destroy(binhead[lev]);
+  memory->destroy(bins);
+  memory->destroy(atomlevel);
+}
+
+/* ----------------------------------------------------------------------
+   define levels from the largest and smallest effective radius
+   rcut = radius * contact distance factor
+   one level per factor of 2 in radius
+------------------------------------------------------------------------- */
+
+void MultiLevelGrid::init(double rcutmax, double rcutmin, double _skin)
+{
+  skin = _skin;
+
+  if(rcutmax <= 0.)
+    error->all(FLERR,"Neighbor multi for granular requires particles with radius > 0");
+
+  nlevels = 1;
+  if(rcutmin > 0. && rcutmin < rcutmax)
+    nlevels = 1 + static_cast<int>(log(rcutmax/rcutmin)/log(2.));
+  if(nlevels > MAXLEVELS) nlevels = MAXLEVELS;
+
+  rcutlevel[0] = rcutmax;
+  for(int lev = 1; lev < nlevels; lev++)
+    rcutlevel[lev] = 0.5*rcutlevel[lev-1];
+}
+
+/* ----------------------------------------------------------------------
+   setup bins of each level, analogous to Neighbor::setup_bins()
+   bin size of a level is 1/2 the cutoff between two of its largest atoms
+------------------------------------------------------------------------- */
+
+void MultiLevelGrid::setup_bins()
+{
+  double *bboxlo = neighbor->bboxlo;
+  double *bboxhi = neighbor->bboxhi;
+  double *cutghost = comm->cutghost;
+  double bbox[3],bsubboxlo[3],bsubboxhi[3];
+
+  for(int dim = 0; dim < 3; dim++)
+  {
+    bsubboxlo[dim] = domain->sublo[dim] - cutghost[dim];
+    bsubboxhi[dim] = domain->subhi[dim] + cutghost[dim];
+    bbox[dim] = bboxhi[dim] - bboxlo[dim];
+  }
+
+  for(int lev = 0; lev < nlevels; lev++)
+  {
+    double binsize_optimal = rcutlevel[lev] + 0.5*skin;
+    double binsizeinv = 1.0/binsize_optimal;
+
+    if (bbox[0]*binsizeinv > MAXSMALLINT || bbox[1]*binsizeinv > MAXSMALLINT ||
+        bbox[2]*binsizeinv > MAXSMALLINT)
+      error->all(FLERR,"Domain too large for neighbor bins");
+
+    nbinx[lev] = static_cast<int> (bbox[0]*binsizeinv);
+    nbiny[lev] = static_cast<int> (bbox[1]*binsizeinv);
+    nbinz[lev] = static_cast<int> (bbox[2]*binsizeinv);
+    if (nbinx[lev] == 0) nbinx[lev] = 1;
+    if (nbiny[lev] == 0) nbiny[lev] = 1;
+    if (nbinz[lev] == 0) nbinz[lev] = 1;
+
+    binsizex[lev] = bbox[0]/nbinx[lev];
+    binsizey[lev] = bbox[1]/nbiny[lev];
+    binsizez[lev] = bbox[2]/nbinz[lev];
+
+    bininvx[lev] = 1.0 / binsizex[lev];
+    bininvy[lev] = 1.0 / binsizey[lev];
+    bininvz[lev] = 1.0 / binsizez[lev];
+
+    if (binsize_optimal*bininvx[lev] > CUT2BIN_RATIO ||
+        binsize_optimal*bininvy[lev] > CUT2BIN_RATIO ||
+        binsize_optimal*bininvz[lev] > CUT2BIN_RATIO)
+      error->all(FLERR,"Cannot use neighbor bins - box size << cutoff");
+
+    // lowest and highest global bins my ghost atoms could be in
+    // extended by 1 to insure stencil extent is included
+
+    int lo[3],hi[3];
+    const double inv[3] = {bininvx[lev],bininvy[lev],bininvz[lev]};
+    for(int dim = 0; dim < 3; dim++)
+    {
+      double coord = bsubboxlo[dim] - SMALL*bbox[dim];
+      lo[dim] = static_cast<int> ((coord-bboxlo[dim])*inv[dim]);
+      if (coord < bboxlo[dim]) lo[dim] = lo[dim] - 1;
+      coord = bsubboxhi[dim] + SMALL*bbox[dim];
+      hi[dim] = static_cast<int> ((coord-bboxlo[dim])*inv[dim]);
+      lo[dim]--;
+      hi[dim]++;
+    }
+
+    mbinxlo[lev] = lo[0];
+    mbinylo[lev] = lo[1];
+    mbinzlo[lev] = lo[2];
+    mbinx[lev] = hi[0] - lo[0] + 1;
+    mbiny[lev] = hi[1] - lo[1] + 1;
+    mbinz[lev] = hi[2] - lo[2] + 1;
+
+    bigint bbin = ((bigint) mbinx[lev]) * ((bigint) mbiny[lev]) * ((bigint) mbinz[lev]);
+    if (bbin > MAXSMALLINT) error->one(FLERR,"Too many neighbor bins");
+    mbins[lev] = bbin;
+    if (mbins[lev] > maxhead[lev]) {
+      maxhead[lev] = mbins[lev];
+      memory->destroy(binhead[lev]);
+      memory->create(binhead[lev],maxhead[lev],"neigh:mlg_binhead");
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   bin owned and ghost atoms, each into the grid of its own level
+   bin in reverse order so linked lists will be in forward order
+------------------------------------------------------------------------- */
+
+void MultiLevelGrid::bin_atoms()
+{
+  double **x = atom->x;
+  double *radius = atom->radius;
+  int nall = atom->nlocal + atom->nghost;
+  const double cdf = neighbor->contactDistanceFactor;
+
+  if (atom->nmax > maxbin) {
+    maxbin = atom->nmax;
+    memory->destroy(bins);
+    memory->destroy(atomlevel);
+    memory->create(bins,maxbin,"neigh:mlg_bins");
+    memory->create(atomlevel,maxbin,"neigh:mlg_atomlevel");
+  }
+
+  for(int lev = 0; lev < nlevels; lev++)
+  {
+    int *head = binhead[lev];
+    for (int i = 0; i < mbins[lev]; i++) head[i] = -1;
+  }
+
+  for (int i = nall-1; i >= 0; i--) {
+    const int lev = level(radius[i]*cdf);
+    const int ibin = coord2bin(x[i],lev);
+    atomlevel[i] = lev;
+    bins[i] = binhead[lev][ibin];
+    binhead[lev][ibin] = i;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   convert atom coords into local bin # of a level
+   same conventions as Neighbor::coord2bin()
+------------------------------------------------------------------------- */
+
+int MultiLevelGrid::coord2bin(const double *x, int lev) const
+{
+  double *bboxlo = neighbor->bboxlo;
+  double *bboxhi = neighbor->bboxhi;
+  int ix,iy,iz;
+
+  if (x[0] >= bboxhi[0])
+    ix = static_cast<int> ((x[0]-bboxhi[0])*bininvx[lev]) + nbinx[lev];
+  else if (x[0] >= bboxlo[0]) {
+    ix = static_cast<int> ((x[0]-bboxlo[0])*bininvx[lev]);
+    ix = MIN(ix,nbinx[lev]-1);
+  } else
+    ix = static_cast<int> ((x[0]-bboxlo[0])*bininvx[lev]) - 1;
+
+  if (x[1] >= bboxhi[1])
+    iy = static_cast<int> ((x[1]-bboxhi[1])*bininvy[lev]) + nbiny[lev];
+  else if (x[1] >= bboxlo[1]) {
+    iy = static_cast<int> ((x[1]-bboxlo[1])*bininvy[lev]);
+    iy = MIN(iy,nbiny[lev]-1);
+  } else
+    iy = static_cast<int> ((x[1]-bboxlo[1])*bininvy[lev]) - 1;
+
+  if (x[2] >= bboxhi[2])
+    iz = static_cast<int> ((x[2]-bboxhi[2])*bininvz[lev]) + nbinz[lev];
+  else if (x[2] >= bboxlo[2]) {
+    iz = static_cast<int> ((x[2]-bboxlo[2])*bininvz[lev]);
+    iz = MIN(iz,nbinz[lev]-1);
+  } else
+    iz = static_cast<int> ((x[2]-bboxlo[2])*bininvz[lev]) - 1;
+
+  return (iz-mbinzlo[lev])*mbiny[lev]*mbinx[lev] +
+         (iy-mbinylo[lev])*mbinx[lev] + (ix-mbinxlo[lev]);
+}
+
+/* ----------------------------------------------------------------------
+   closest distance between central bin (0,0,0) and bin (i,j,k) of a level
+------------------------------------------------------------------------- */
+
+double MultiLevelGrid::bin_distance(int i, int j, int k, int lev) const
+{
+  double delx,dely,delz;
+
+  if (i > 0) delx = (i-1)*binsizex[lev];
+  else if (i == 0) delx = 0.0;
+  else delx = (i+1)*binsizex[lev];
+
+  if (j > 0) dely = (j-1)*binsizey[lev];
+  else if (j == 0) dely = 0.0;
+  else dely = (j+1)*binsizey[lev];
+
+  if (k > 0) delz = (k-1)*binsizez[lev];
+  else if (k == 0) delz = 0.0;
+  else delz = (k+1)*binsizez[lev];
+
+  return (delx*delx + dely*dely + delz*delz);
+}
+
+/* ---------------------------------------------------------------------- */
+
+bigint MultiLevelGrid::memory_usage()
+{
+  bigint bytes = 0;
+  for(int lev = 0; lev < nlevels; lev++)
+    bytes += memory->usage(binhead[lev],maxhead[lev]);
+  bytes += memory->usage(bins,maxbin);
+  bytes += memory->usage(atomlevel,maxbin);
+  return bytes;
+}
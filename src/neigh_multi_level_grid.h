@@ -1 +1,93 @@
-#include "neigh_mlg_dummy.h"
+/* ----------------------------------------------------------------------
+   LIGGGHTS - LAMMPS Improved for General Granular and Granular Heat
+   Transfer Simulations
+
+   LIGGGHTS is part of the CFDEMproject
+   www.liggghts.com | www.cfdem.com
+
+   Christoph Kloss, christoph.kloss@cfdem.com
+   Copyright 2009-2012 JKU Linz
+   Copyright 2012-     DCS Computing GmbH, Linz
+
+   LIGGGHTS is based on LAMMPS
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   This software is distributed under the GNU General Public License.
+
+   See the README file in the top-level directory.
+------------------------------------------------------------------------- */
+
+#ifndef LMP_NEIGHBOR_MULTI_LEVEL_GRID_H
+#define LMP_NEIGHBOR_MULTI_LEVEL_GRID_H
+
+#include "pointers.h"
+
+namespace LAMMPS_NS
+{
+
+/* ----------------------------------------------------------------------
+   hierarchical bin grid for polydisperse granular neighbor lists
+   level 0 holds the largest particles, every further level halves the
+   (contact distance scaled) radius range, the last level holds all
+   particles smaller than that
+   each level has its own bin grid sized by its own cutoff, each atom
+   is binned into the grid of its own level only
+------------------------------------------------------------------------- */
+
+class MultiLevelGrid : protected Pointers
+{
+  public:
+
+    MultiLevelGrid(class LAMMPS *);
+    ~MultiLevelGrid();
+
+    void init(double rcutmax, double rcutmin, double skin);
+    void setup_bins();
+    void bin_atoms();
+
+    // level for an effective (contact distance scaled) radius
+
+    inline int level(double rcut) const
+    {
+      int lev = 0;
+      while(lev < nlevels-1 && rcut <= rcutlevel[lev+1])
+        lev++;
+      return lev;
+    }
+
+    int coord2bin(const double *x, int lev) const;
+    double bin_distance(int i, int j, int k, int lev) const;
+
+    bigint memory_usage();
+
+    static const int MAXLEVELS = 8;
+
+    int nlevels;
+    double rcutlevel[MAXLEVELS];   // max effective radius of each level
+
+    // per-level bin geometry, same meaning as in Neighbor
+
+    int nbinx[MAXLEVELS],nbiny[MAXLEVELS],nbinz[MAXLEVELS];
+    int mbins[MAXLEVELS];
+    int mbinx[MAXLEVELS],mbiny[MAXLEVELS],mbinz[MAXLEVELS];
+    int mbinxlo[MAXLEVELS],mbinylo[MAXLEVELS],mbinzlo[MAXLEVELS];
+    double binsizex[MAXLEVELS],binsizey[MAXLEVELS],binsizez[MAXLEVELS];
+    double bininvx[MAXLEVELS],bininvy[MAXLEVELS],bininvz[MAXLEVELS];
+
+    int *binhead[MAXLEVELS];       // ptr to 1st atom in each bin of a level
+    int maxhead[MAXLEVELS];        // size of binhead arrays
+
+    int *bins;                     // ptr to next atom in same bin
+    int *atomlevel;                // level of each owned and ghost atom
+    int maxbin;                    // size of bins and atomlevel
+
+  private:
+
+    double skin;
+};
+
+}
+
+#endif
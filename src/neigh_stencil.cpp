@@ -14,6 +14,8 @@
 #include "neighbor.h"
 #include "neigh_list.h"
 #include "atom.h"
+#include "memory.h"
+#include "neigh_multi_level_grid.h" //NP modified C.K.
 
 using namespace LAMMPS_NS;
 
@@ -535,3 +537,66 @@ void Neighbor::stencil_full_multi_3d(NeighList *list,
     nstencil_multi[itype] = n;
   }
 }
+
+/* ----------------------------------------------------------------------
+   granular multi-level grid, newton off
+   one stencil for each pair of levels (ilevel,jlevel)
+   stencil is built in the bins of jlevel and holds all of its bins
+   whose closest corner is within the cutoff between the largest atoms
+   of ilevel and jlevel
+   sx,sy,sz of the single-level grid are not used
+------------------------------------------------------------------------- */
+
+void Neighbor::stencil_gran_multi_3d_no_newton(NeighList *list,
+                                               int, int, int)
+{
+  int i,j,k,n;
+  const int nlevels = mlg->nlevels;
+  double *rcut = mlg->rcutlevel;
+  int sxl[MultiLevelGrid::MAXLEVELS][MultiLevelGrid::MAXLEVELS];
+  int syl[MultiLevelGrid::MAXLEVELS][MultiLevelGrid::MAXLEVELS];
+  int szl[MultiLevelGrid::MAXLEVELS][MultiLevelGrid::MAXLEVELS];
+
+  // stencil extents, stencil arrays are sized by the largest one
+
+  int smax_levels = 0;
+  for (int ilevel = 0; ilevel < nlevels; ilevel++) {
+    for (int jlevel = 0; jlevel < nlevels; jlevel++) {
+      const double cut = rcut[ilevel] + rcut[jlevel] + skin;
+      int &ex = sxl[ilevel][jlevel];
+      int &ey = syl[ilevel][jlevel];
+      int &ez = szl[ilevel][jlevel];
+      ex = static_cast<int> (cut*mlg->bininvx[jlevel]);
+      if (ex*mlg->binsizex[jlevel] < cut) ex++;
+      ey = static_cast<int> (cut*mlg->bininvy[jlevel]);
+      if (ey*mlg->binsizey[jlevel] < cut) ey++;
+      ez = static_cast<int> (cut*mlg->bininvz[jlevel]);
+      if (ez*mlg->binsizez[jlevel] < cut) ez++;
+      smax_levels = MAX(smax_levels,(2*ex+1)*(2*ey+1)*(2*ez+1));
+    }
+  }
+
+  memory->destroy(list->stencil_multigran);
+  memory->create(list->stencil_multigran,nlevels,nlevels,smax_levels,
+                 "neighlist:stencil_multigran");
+
+  for (int ilevel = 0; ilevel < nlevels; ilevel++) {
+    list->rmax_multigran[ilevel] = rcut[ilevel];
+    list->rmin_multigran[ilevel] = (ilevel < nlevels-1) ? rcut[ilevel+1] : 0.;
+
+    for (int jlevel = 0; jlevel < nlevels; jlevel++) {
+      const double cut = rcut[ilevel] + rcut[jlevel] + skin;
+      const double cutsq = cut*cut;
+      const int mx = mlg->mbinx[jlevel];
+      const int my = mlg->mbiny[jlevel];
+      int *s = list->stencil_multigran[ilevel][jlevel];
+      n = 0;
+      for (k = -szl[ilevel][jlevel]; k <= szl[ilevel][jlevel]; k++)
+        for (j = -syl[ilevel][jlevel]; j <= syl[ilevel][jlevel]; j++)
+          for (i = -sxl[ilevel][jlevel]; i <= sxl[ilevel][jlevel]; i++)
+            if (mlg->bin_distance(i,j,k,jlevel) < cutsq)
+              s[n++] = k*my*mx + j*mx + i;
+      list->nstencil_multigran[ilevel][jlevel] = n;
+    }
+  }
+}
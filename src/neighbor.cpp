@@ -52,6 +52,8 @@
 #include "neigh_multi_level_grid.h" //NP modified C.K.
 #include "math_extra_liggghts.h"    //NP modified C.K.
 #include "fix_contact_history.h"
+#include "fix_property_atom.h"
+#include "comm.h"
 #include <assert.h>
 
 using namespace LAMMPS_NS;
@@ -97,6 +99,7 @@ Neighbor::Neighbor(LAMMPS *lmp) : Pointers(lmp)
   oneatom = 2000;
   binsizeflag = 0;
   build_once = 0;
+  partial_flag = 0;
   cluster_check = 0;
 
   cutneighsq = NULL;
@@ -111,6 +114,18 @@ Neighbor::Neighbor(LAMMPS *lmp) : Pointers(lmp)
   xhold = NULL;
   rhold = NULL; //NP modified C.K.
 
+  // partial rebuild of granular lists
+
+  fix_partial = NULL;
+  partial_drift = 0.0;
+  partial_valid = 0;
+  npartial = maxpartial = maxpartialneigh = 0;
+  partial_tag = partial_offset = partial_neigh = NULL;
+  maxoldindex = 0;
+  partial_oldindex = NULL;
+  maxdirty = 0;
+  partial_dirty = partial_dirty_tmp = NULL;
+
   // binning
 
   maxhead = 0;
@@ -136,6 +151,8 @@ Neighbor::Neighbor(LAMMPS *lmp) : Pointers(lmp)
   nex_mol = maxex_mol = 0;
   ex_mol_group = ex_mol_bit = NULL;
 
+  exbody = exbody_bit = 0;
+
   no_build = 0;
 
   // pair lists
@@ -157,6 +174,7 @@ Neighbor::Neighbor(LAMMPS *lmp) : Pointers(lmp)
   old_triclinic = 0;
   old_pgsize = pgsize;
   old_oneatom = oneatom;
+  old_partial = partial_flag;
   old_nrequest = 0;
   old_requests = NULL;
 
@@ -188,6 +206,13 @@ Neighbor::~Neighbor()
   memory->destroy(xhold);
   memory->destroy(rhold); //NP modified C.K.
 
+  memory->destroy(partial_tag);
+  memory->destroy(partial_offset);
+  memory->destroy(partial_neigh);
+  memory->destroy(partial_oldindex);
+  memory->destroy(partial_dirty);
+  memory->destroy(partial_dirty_tmp);
+
   memory->destroy(binhead);
   memory->destroy(bins);
 
@@ -232,6 +257,8 @@ void Neighbor::init()
   int i,j,m,n;
 
   ncalls = ndanger = 0;
+  npaircheck = npairaccept = 0;
+  npartialbuild = npartialreuse = 0;
   dimension = domain->dimension;
   triclinic = domain->triclinic;
   newton_pair = force->newton_pair;
@@ -313,6 +340,67 @@ void Neighbor::init()
     cutneighmin = MIN(cutneighmin,2*minrd+skin);
   }
 
+  //NP modified C.K.
+  //NP granular lists with style multi use one bin grid per size class
+
+  if(style == MULTI && atom->radius_flag) {
+    if(!mlg) mlg = new MultiLevelGrid(lmp);
+    double maxrd,minrd;
+    int nlevels;
+    multi_levels(maxrd,minrd,nlevels);
+  }
+
+  // partial rebuild of granular lists
+  // lists of atoms further than cutneighmax from any moved atom are reused
+  // trigger is reduced by the drift allowed for atoms that are not moved,
+  //   so pairs within cutoff were within cutoff+skin when a list was built
+  // fix stores x at last move, owner and moved flag, moved flag is needed
+  //   for ghosts as well
+
+  partial_valid = 0;
+  if (partial_flag) {
+    if (style != BIN || newton_pair)
+      error->all(FLERR,"Neigh_modify partial requires neighbor style bin "
+                 "and newton pair off");
+    if (!dist_check || includegroup || boxcheck)
+      error->all(FLERR,"Neigh_modify partial requires check yes, "
+                 "no include group and a fixed box");
+    if (atom->radvary_flag)
+      error->all(FLERR,"Neigh_modify partial cannot be used with varying radius");
+    if (atom->map_style == 0)
+      error->all(FLERR,"Neigh_modify partial requires an atom map");
+    if ((domain->xperiodic && domain->xprd <= 2.0*cutneighmax) ||
+        (domain->yperiodic && domain->yprd <= 2.0*cutneighmax) ||
+        (dimension == 3 && domain->zperiodic && domain->zprd <= 2.0*cutneighmax))
+      error->all(FLERR,"Neigh_modify partial requires periodic box length "
+                 "> 2x neighbor cutoff");
+
+    partial_drift = 0.125*skin;
+    double trigger = 0.5*skin - partial_drift;
+    triggersq = trigger*trigger;
+
+    fix_partial = static_cast<FixPropertyAtom*>
+      (modify->find_fix_property("neighPartialHold","property/atom","vector",
+                                 5,0,"neighbor",false));
+    if (!fix_partial) {
+      const char *fixarg[13];
+      fixarg[0] = "neighPartialHold";
+      fixarg[1] = "all";
+      fixarg[2] = "property/atom";
+      fixarg[3] = "neighPartialHold";
+      fixarg[4] = "vector";  //NP x, y, z at last move, owner, moved flag
+      fixarg[5] = "no";      //NP restart no
+      fixarg[6] = "yes";     //NP communicate ghost yes
+      fixarg[7] = "no";      //NP communicate rev no
+      fixarg[8] = "0.";
+      fixarg[9] = "0.";
+      fixarg[10] = "0.";
+      fixarg[11] = "-1.";    //NP no owner, so new atoms are moved atoms
+      fixarg[12] = "1.";
+      fix_partial = modify->add_fix_property_atom(13,const_cast<char**>(fixarg),"neighbor");
+    }
+  }
+
   /*NL*/ //if (screen) fprintf(screen,"cutneighmin/max %f %f\n",cutneighmin,cutneighmax);
   /*NL*/ //error->all(FLERR,"end"); //NP modified C.K.
 
@@ -428,7 +516,7 @@ void Neighbor::init()
 
   n = atom->ntypes;
 
-  if (nex_type == 0 && nex_group == 0 && nex_mol == 0) exclude = 0;
+  if (nex_type == 0 && nex_group == 0 && nex_mol == 0 && exbody == 0) exclude = 0;
   else exclude = 1;
 
   if (nex_type) {
@@ -492,6 +580,7 @@ void Neighbor::init()
   if (pgsize != old_pgsize) same = 0;
   /*NL*/ //if (screen) fprintf(screen,"same 3 %d\n",same);
   if (oneatom != old_oneatom) same = 0;
+  if (partial_flag != old_partial) same = 0;
   /*NL*/ //if (screen) fprintf(screen,"same 4 %d\n",same);
   if (nrequest != old_nrequest) {
     same = 0;
@@ -680,6 +769,19 @@ void Neighbor::init()
       if (!requests[i]->cudable) cudable = 0;
     }
 
+    // lists of last build are stored for a single list only
+
+    if (partial_flag) {
+      int npartiallist = 0;
+      for (i = 0; i < nlist; i++)
+        if (pair_build[i] == &Neighbor::granular_bin_no_newton_partial)
+          npartiallist++;
+      if (npartiallist > 1)
+        error->all(FLERR,"Neigh_modify partial supports only one granular pair list");
+      if (npartiallist == 0 && me == 0)
+        error->warning(FLERR,"Neigh_modify partial has no effect");
+    }
+
     // set each list's build/grow/stencil/ghost flags based on neigh request
     // buildflag = 1 if its pair_build() invoked every reneighbor
     // growflag = 1 if it stores atom-based arrays and pages
@@ -810,6 +912,7 @@ void Neighbor::init()
   requests = NULL;
   old_style = style;
   old_triclinic = triclinic;
+  old_partial = partial_flag;
 
   // ------------------------------------------------------------------
   // topology lists
@@ -1053,7 +1156,9 @@ void Neighbor::choose_build(int index, NeighRequest *rq)
         if (newton_pair == 0) pb = &Neighbor::granular_nsq_no_newton;
         else if (newton_pair == 1) pb = &Neighbor::granular_nsq_newton;
       } else if (style == BIN) {
-        if (newton_pair == 0) pb = &Neighbor::granular_bin_no_newton;
+        if (newton_pair == 0 && partial_flag && rq->pair && !rq->occasional)
+          pb = &Neighbor::granular_bin_no_newton_partial;
+        else if (newton_pair == 0) pb = &Neighbor::granular_bin_no_newton;
         else if (triclinic == 0) pb = &Neighbor::granular_bin_newton;
         else if (triclinic == 1) pb = &Neighbor::granular_bin_newton_tri;
       } else if (style == MULTI) { //NP modified C.K.
@@ -1406,6 +1511,11 @@ int Neighbor::check_distance()
     delta = sqrt(deltasq);
   }
 
+  // partial rebuild stores x of moved atoms only, it migrates with atoms
+
+  double **hold = xhold;
+  if (partial_flag) hold = fix_partial->array_atom;
+
   double **x = atom->x;
   double *radius = atom->radius; //NP modified C.K.
   int nlocal = atom->nlocal;
@@ -1416,9 +1526,9 @@ int Neighbor::check_distance()
   if(radvary_flag == 0) //NP modified C.K.
   {
       for (int i = 0; i < nlocal; i++) {
-        delx = x[i][0] - xhold[i][0];
-        dely = x[i][1] - xhold[i][1];
-        delz = x[i][2] - xhold[i][2];
+        delx = x[i][0] - hold[i][0];
+        dely = x[i][1] - hold[i][1];
+        delz = x[i][2] - hold[i][2];
         rsq = delx*delx + dely*dely + delz*delz;
         if (rsq > deltasq) flag = 1;
         /*NL*///if (screen) fprintf(screen,"checking at step %d, result %d\n",update->ntimestep,flag);
@@ -1472,8 +1582,10 @@ void Neighbor::build(int topoflag)
   lastcall = update->ntimestep;
 
   // store current atom positions and box size if needed
+  // partial rebuild only stores positions of moved atoms
 
-  if (dist_check) {
+  if (partial_flag) partial_hold();
+  else if (dist_check) {
     double **x = atom->x;
     double *radius = atom->radius; //NP modified C.K.
     int nlocal = atom->nlocal;
@@ -1794,6 +1906,11 @@ void Neighbor::setup_bins()
   if (dimension == 2) sz = 0;
   smax = (2*sx+1) * (2*sy+1) * (2*sz+1);
 
+  //NP modified C.K.
+  //NP bin geometry of each level must be known before stencils are created
+
+  if (style == MULTI && mlg) mlg->setup_bins();
+
   // create stencils for pairwise neighbor lists
   // only done for lists with stencilflag and buildflag set
 
@@ -1922,6 +2039,12 @@ void Neighbor::modify_params(int narg, char **arg)
       if (binsize_user <= 0.0) binsizeflag = 0;
       else binsizeflag = 1;
       iarg += 2;
+    } else if (strcmp(arg[iarg],"partial") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal neigh_modify command");
+      if (strcmp(arg[iarg+1],"yes") == 0) partial_flag = 1;
+      else if (strcmp(arg[iarg+1],"no") == 0) partial_flag = 0;
+      else error->all(FLERR,"Illegal neigh_modify command");
+      iarg += 2;
     } else if (strcmp(arg[iarg],"cluster") == 0) {
       if (iarg+2 > narg) error->all(FLERR,"Illegal neigh_modify command");
       if (strcmp(arg[iarg+1],"yes") == 0) cluster_check = 1;
@@ -2041,6 +2164,156 @@ void Neighbor::bin_atoms()
   }
 }
 
+/* ----------------------------------------------------------------------
+   partial rebuild: flag local atoms that moved further than partial_drift
+   since they were last flagged, or that are new to this proc
+   store their current position and owner, communicate flag to ghosts
+------------------------------------------------------------------------- */
+
+void Neighbor::partial_hold()
+{
+  double delx,dely,delz;
+
+  double **x = atom->x;
+  double **hold = fix_partial->array_atom;
+  int nlocal = atom->nlocal;
+  double driftsq = partial_drift*partial_drift;
+
+  for (int i = 0; i < nlocal; i++) {
+    delx = x[i][0] - hold[i][0];
+    dely = x[i][1] - hold[i][1];
+    delz = x[i][2] - hold[i][2];
+    if (!partial_valid || static_cast<int>(hold[i][3]) != me ||
+        delx*delx + dely*dely + delz*delz > driftsq) {
+      hold[i][0] = x[i][0];
+      hold[i][1] = x[i][1];
+      hold[i][2] = x[i][2];
+      hold[i][3] = me;
+      hold[i][4] = 1.0;
+    } else hold[i][4] = 0.0;
+  }
+
+  comm->forward_comm_fix(fix_partial);
+}
+
+/* ----------------------------------------------------------------------
+   partial rebuild: flag bins within cutneighmax of a moved atom
+   map local atoms to their lists stored at last build
+   called after atoms are binned
+------------------------------------------------------------------------- */
+
+void Neighbor::partial_setup()
+{
+  int i,k,ibin,d;
+
+  if (atom->nmax > maxoldindex) {
+    maxoldindex = atom->nmax;
+    memory->destroy(partial_oldindex);
+    memory->create(partial_oldindex,maxoldindex,"neigh:partial_oldindex");
+  }
+  if (mbins > maxdirty) {
+    maxdirty = mbins;
+    memory->destroy(partial_dirty);
+    memory->destroy(partial_dirty_tmp);
+    memory->create(partial_dirty,maxdirty,"neigh:partial_dirty");
+    memory->create(partial_dirty_tmp,maxdirty,"neigh:partial_dirty_tmp");
+  }
+
+  int nlocal = atom->nlocal;
+  int nall = nlocal + atom->nghost;
+
+  for (i = 0; i < nlocal; i++) partial_oldindex[i] = -1;
+  if (!partial_valid) return;
+
+  for (k = 0; k < npartial; k++) {
+    i = atom->map(partial_tag[k]);
+    if (i >= 0 && i < nlocal) partial_oldindex[i] = k;
+  }
+
+  // flag bins of moved owned and ghost atoms
+
+  double **x = atom->x;
+  double **hold = fix_partial->array_atom;
+
+  for (ibin = 0; ibin < mbins; ibin++) partial_dirty[ibin] = 0;
+  for (i = 0; i < nall; i++)
+    if (hold[i][4] > 0.0) partial_dirty[coord2bin(x[i])] = 1;
+
+  // dilate flagged region by cutneighmax, one dimension at a time
+
+  int reach[3],stride[3],extent[3];
+  reach[0] = static_cast<int> (cutneighmax*bininvx) + 1;
+  reach[1] = static_cast<int> (cutneighmax*bininvy) + 1;
+  reach[2] = static_cast<int> (cutneighmax*bininvz) + 1;
+  stride[0] = 1;
+  stride[1] = mbinx;
+  stride[2] = mbinx*mbiny;
+  extent[0] = mbinx;
+  extent[1] = mbiny;
+  extent[2] = mbinz;
+
+  for (d = 0; d < dimension; d++) {
+    for (ibin = 0; ibin < mbins; ibin++) partial_dirty_tmp[ibin] = 0;
+    for (ibin = 0; ibin < mbins; ibin++) {
+      if (!partial_dirty[ibin]) continue;
+      int pos = (ibin/stride[d]) % extent[d];
+      int lo = MAX(pos-reach[d],0);
+      int hi = MIN(pos+reach[d],extent[d]-1);
+      int base = ibin - pos*stride[d];
+      for (k = lo; k <= hi; k++) partial_dirty_tmp[base+k*stride[d]] = 1;
+    }
+    int *tmp = partial_dirty;
+    partial_dirty = partial_dirty_tmp;
+    partial_dirty_tmp = tmp;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   partial rebuild: store neighbors of all local atoms by tag
+   so the lists can be reused after atoms are exchanged and sorted
+------------------------------------------------------------------------- */
+
+void Neighbor::partial_store(NeighList *list)
+{
+  int i,ii,k,n;
+
+  int *tag = atom->tag;
+  int inum = list->inum;
+  int *ilist = list->ilist;
+  int *numneigh = list->numneigh;
+  int **firstneigh = list->firstneigh;
+
+  n = 0;
+  for (ii = 0; ii < inum; ii++) n += numneigh[ilist[ii]];
+
+  if (inum+1 > maxpartial) {
+    maxpartial = atom->nmax+1;
+    memory->destroy(partial_tag);
+    memory->destroy(partial_offset);
+    memory->create(partial_tag,maxpartial,"neigh:partial_tag");
+    memory->create(partial_offset,maxpartial,"neigh:partial_offset");
+  }
+  if (n > maxpartialneigh) {
+    maxpartialneigh = static_cast<int> (LB_FACTOR*n);
+    memory->destroy(partial_neigh);
+    memory->create(partial_neigh,maxpartialneigh,"neigh:partial_neigh");
+  }
+
+  n = 0;
+  for (ii = 0; ii < inum; ii++) {
+    i = ilist[ii];
+    int *jlist = firstneigh[i];
+    int jnum = numneigh[i];
+    partial_tag[ii] = tag[i];
+    partial_offset[ii] = n;
+    for (k = 0; k < jnum; k++) partial_neigh[n++] = tag[jlist[k]];
+  }
+  partial_offset[inum] = n;
+
+  npartial = inum;
+  partial_valid = 1;
+}
+
 /* ----------------------------------------------------------------------
    convert atom coords into local bin #
    for orthogonal, only ghost atoms will have coord >= bboxhi or coord < bboxlo
@@ -2157,9 +2430,25 @@ int Neighbor::exclusion(int i, int j, int itype, int jtype,
           molecule[i] == molecule[j]) return 1;
   }
 
+  if (exbody && mask[i] & mask[j] & exbody_bit &&
+      molecule[i] == molecule[j]) return 1;
+
   return 0;
 }
 
+/* ----------------------------------------------------------------------
+   exclude pairs of atoms in groupbit with the same molecule ID,
+   which fix multisphere sets to the body tag, groupbit = 0 disables
+   same as neigh_modify exclude molecule, but granular lists test it
+     before the distance check and all other exclusions after it
+------------------------------------------------------------------------- */
+
+void Neighbor::exclude_body(int groupbit)
+{
+  exbody = groupbit ? 1 : 0;
+  exbody_bit = groupbit;
+}
+
 /* ----------------------------------------------------------------------
    return # of bytes of allocated memory
 ------------------------------------------------------------------------- */
@@ -2169,11 +2458,17 @@ bigint Neighbor::memory_usage()
   bigint bytes = 0;
   bytes += memory->usage(xhold,maxhold,3);
   bytes += memory->usage(rhold,maxhold); //NP modified C.K.
+  bytes += memory->usage(partial_tag,maxpartial);
+  bytes += memory->usage(partial_offset,maxpartial);
+  bytes += memory->usage(partial_neigh,maxpartialneigh);
+  bytes += memory->usage(partial_oldindex,maxoldindex);
+  bytes += 2*memory->usage(partial_dirty,maxdirty);
 
   if (style != NSQ) {
     bytes += memory->usage(bins,maxbin);
     bytes += memory->usage(binhead,maxhead);
   }
+  if (mlg) bytes += mlg->memory_usage(); //NP modified C.K.
 
   for (int i = 0; i < nlist; i++) bytes += lists[i]->memory_usage();
 
@@ -2231,3 +2526,39 @@ int Neighbor::n_neighs()
 
     return nneigh;
 }
+
+/* ----------------------------------------------------------------------
+   number of levels of the multi-level grid, 0 if there is none
+------------------------------------------------------------------------- */
+
+int Neighbor::multi_levels()
+{
+    if(!mlg) return 0;
+    return mlg->nlevels;
+}
+
+/* ----------------------------------------------------------------------
+   (re-)define the levels of the multi-level grid from the particle size
+   range known to atoms and insertion fixes
+   returns largest and smallest contact radius and the number of levels
+------------------------------------------------------------------------- */
+
+void Neighbor::multi_levels(double &maxrad, double &minrad, int &nlevels)
+{
+    modify->max_min_rad(maxrad,minrad);
+
+    // no size information available yet, fall back to pair cutoff
+
+    if(maxrad <= 0.)
+        maxrad = 0.5*(cutneighmax-skin)/contactDistanceFactor;
+    if(minrad > maxrad)
+        minrad = maxrad;
+
+    mlg->init(maxrad*contactDistanceFactor,minrad*contactDistanceFactor,skin);
+    nlevels = mlg->nlevels;
+
+    if(me == 0) {
+      if(screen) fprintf(screen,"Neighbor multi: %d levels for radius range %g - %g\n",nlevels,minrad,maxrad);
+      if(logfile) fprintf(logfile,"Neighbor multi: %d levels for radius range %g - %g\n",nlevels,minrad,maxrad);
+    }
+}
@@ -35,6 +35,7 @@ class Neighbor : protected Pointers {
   friend class FixNeighlistMesh;
   friend class FixNeighlistMeshOMP;
   friend class OneLevelGrid;
+  friend class MultiLevelGrid;
   /*NL*/ friend class Lbalance;
   //NP modified St.A.
   friend class FixHeatGranRad;
@@ -51,6 +52,8 @@ class Neighbor : protected Pointers {
   int oneatom;                     // max # of neighbors for one atom
   int includegroup;                // only build pairwise lists for this group
   int build_once;                  // 1 if only build lists once per run
+  int partial_flag;                // 1 if granular lists are only rebuilt
+                                   // close to atoms that moved
   int cudable;                     // GPU <-> CPU communication flag for CUDA
 
   double skin;                     // skin distance
@@ -64,6 +67,14 @@ class Neighbor : protected Pointers {
   bigint ndanger;                  // # of dangerous builds
   bigint lastcall;                 // timestep of last neighbor::build() call
 
+  //NP statistics of granular list builds, to compare bin and multi style
+  bigint npaircheck;               // # of candidate pairs distance checked
+  bigint npairaccept;              // # of candidate pairs put in the list
+
+  //NP statistics of partial granular list builds
+  bigint npartialbuild;            // # of list entries found via bins
+  bigint npartialreuse;            // # of list entries copied from last build
+
   bigint last_setup_bins_timestep;
 
   int nrequest;                    // requests for pairwise neighbor lists
@@ -75,6 +86,7 @@ class Neighbor : protected Pointers {
   int old_triclinic;
   int old_pgsize;
   int old_oneatom;
+  int old_partial;
   class NeighRequest **old_requests;
 
   int nlist;                       // pairwise neighbor lists
@@ -103,6 +115,7 @@ class Neighbor : protected Pointers {
   void build_one(int);              // create a single neighbor list
   void set(int, char **);           // set neighbor style and skin distance
   void modify_params(int, char**);  // modify parameters that control builds
+  void exclude_body(int);           // exclude pairs within one rigid body
   bigint memory_usage();
   int exclude_setting();
   int neigh_once(){return build_once;} //NP modified C.K.
@@ -141,6 +154,21 @@ class Neighbor : protected Pointers {
   double boxlo_hold[3],boxhi_hold[3];  // box size at last neighbor build
   double corners_hold[8][3];           // box corners at last neighbor build
 
+  //NP partial rebuild of granular lists
+  class FixPropertyAtom *fix_partial;  // per-atom x at last move, owner, moved flag
+  double partial_drift;                // atoms moving further are moved atoms
+  int partial_valid;                   // 1 if lists of last build can be reused
+  int npartial;                        // # of atoms stored at last build
+  int maxpartial,maxpartialneigh;      // size of partial_tag, partial_neigh
+  int *partial_tag;                    // tags of atoms at last build
+  int *partial_offset;                 // range of each atom in partial_neigh
+  int *partial_neigh;                  // tags of neighbors at last build
+  int maxoldindex;                     // size of partial_oldindex
+  int *partial_oldindex;               // index of each local atom at last build
+  int maxdirty;                        // size of partial_dirty arrays
+  int *partial_dirty;                  // 1 for bins close to a moved atom
+  int *partial_dirty_tmp;
+
   int nbinx,nbiny,nbinz;           // # of global bins
   int *bins;                       // ptr to next atom in each bin
   int maxbin;                      // size of bins array
@@ -195,6 +223,10 @@ class Neighbor : protected Pointers {
   int *ex_mol_group;               // molecule group #'s to exclude
   int *ex_mol_bit;                 // molecule group bits to exclude
 
+  int exbody;                      // 1 if pairs with same molecule ID are
+                                   // excluded, checked inline by granular lists
+  int exbody_bit;                  // group bit of atoms in rigid bodies
+
   int no_build;                    // no neigh lists are built, but exchange
                                    // of particles takes place
 
@@ -215,6 +247,10 @@ class Neighbor : protected Pointers {
   int XYZ2bin(int, int, int); //NP modified St.A.
   int binHop(int, int, int, int); //NP modified St.A.
 
+  void partial_hold();                  // flag moved atoms, store their x
+  void partial_setup();                 // flag bins, map to last build
+  void partial_store(class NeighList *); // store lists by tag
+
   int exclusion(int, int, int,
                 int, int *, int *) const;  // test for pair exclusion
 
@@ -256,6 +292,7 @@ class Neighbor : protected Pointers {
   void granular_nsq_newton(class NeighList *);
   void granular_bin_no_newton(class NeighList *);
   void granular_bin_no_newton_ghost(NeighList *list); //NP modified C.K.
+  void granular_bin_no_newton_partial(class NeighList *);
   void granular_bin_newton(class NeighList *);
   void granular_bin_newton_tri(class NeighList *);
 
@@ -458,4 +495,36 @@ E: Neigh_modify exclude molecule requires atom attribute molecule
 
 Self-explanatory.
 
+E: Neigh_modify partial requires neighbor style bin and newton pair off
+
+Partial rebuilds are only implemented for the granular half list
+built by the bin style.
+
+E: Neigh_modify partial requires check yes, no include group and a fixed box
+
+Partial rebuilds rely on the per-atom displacements since the last build,
+so lists have to be built based on the distance check, and the box may
+not change.
+
+E: Neigh_modify partial cannot be used with varying radius
+
+Self-explanatory.
+
+E: Neigh_modify partial requires an atom map
+
+Use the atom_modify map command to define one.
+
+E: Neigh_modify partial requires periodic box length > 2x neighbor cutoff
+
+Otherwise a pair could not be identified by the tags of the two atoms.
+
+E: Neigh_modify partial supports only one granular pair list
+
+Self-explanatory.
+
+W: Neigh_modify partial has no effect
+
+No granular pair list is built with the bin style, so all lists are
+fully rebuilt.
+
 */
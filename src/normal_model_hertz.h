@@ -40,7 +40,7 @@ namespace ContactModels
   class NormalModel<HERTZ> : protected Pointers
   {
   public:
-    static const int MASK = CM_REGISTER_SETTINGS | CM_CONNECT_TO_PROPERTIES | CM_COLLISION;
+    static const int MASK = CM_REGISTER_SETTINGS | CM_CONNECT_TO_PROPERTIES | CM_COLLISION | CM_COLLISION_BATCH;
 
     NormalModel(LAMMPS * lmp, IContactHistorySetup*) : Pointers(lmp),
       Yeff(NULL),
@@ -183,6 +183,58 @@ namespace ContactModels
       }
     }
 
+    // spherical particle pairs of a ContactBatch, same as collision() above
+    inline void collision(PairStyles::ContactBatch & batch, CollisionData&)
+    {
+      const double sqrtFiveOverSix = 0.91287092917527685576161630466800355658790782499663875;
+      const double nktv2p = force->nktv2p;
+
+      for (int k = 0; k < batch.n; k++) {
+        const int itype = batch.itype[k];
+        const int jtype = batch.jtype[k];
+        const double ri = batch.radi[k];
+        const double rj = batch.radj[k];
+        const double reff = ri*rj/(ri+rj);
+        const double meff = batch.meff[k];
+        const double deltan = batch.deltan[k];
+
+        const double sqrtval = sqrt(reff*deltan);
+
+        const double Sn=2.*Yeff[itype][jtype]*sqrtval;
+        const double St=8.*Geff[itype][jtype]*sqrtval;
+
+        double kn=4./3.*Yeff[itype][jtype]*sqrtval;
+        double kt=St;
+        const double gamman=-2.*sqrtFiveOverSix*betaeff[itype][jtype]*sqrt(Sn*meff);
+        const double gammat=tangential_damping ? -2.*sqrtFiveOverSix*betaeff[itype][jtype]*sqrt(St*meff) : 0.0;
+
+        // convert Kn and Kt from pressure units to force/distance^2
+        kn /= nktv2p;
+        kt /= nktv2p;
+
+        const double Fn_damping = -gamman*batch.vn[k];
+        const double Fn_contact = kn*deltan;
+        double Fn = Fn_damping + Fn_contact;
+
+        //limit force to avoid the artefact of negative repulsion force
+        if(limitForce && (Fn<0.0) )
+        {
+            Fn = 0.0;
+        }
+
+        batch.Fn[k] = Fn;
+        batch.kn[k] = kn;
+        batch.kt[k] = kt;
+        batch.gamman[k] = gamman;
+        batch.gammat[k] = gammat;
+
+        // apply normal force
+        batch.fx[k] = Fn * batch.enx[k];
+        batch.fy[k] = Fn * batch.eny[k];
+        batch.fz[k] = Fn * batch.enz[k];
+      }
+    }
+
     void noCollision(ContactData&, ForceData&, ForceData&){}
     void beginPass(CollisionData&, ForceData&, ForceData&){}
     void endPass(CollisionData&, ForceData&, ForceData&){}
@@ -43,7 +43,7 @@ namespace ContactModels
   class NormalModel<HOOKE> : protected Pointers
   {
   public:
-    static const int MASK = CM_REGISTER_SETTINGS | CM_CONNECT_TO_PROPERTIES | CM_COLLISION;
+    static const int MASK = CM_REGISTER_SETTINGS | CM_CONNECT_TO_PROPERTIES | CM_COLLISION | CM_COLLISION_BATCH;
 
     NormalModel(LAMMPS * lmp, IContactHistorySetup*) : Pointers(lmp),
       Yeff(NULL),
@@ -238,6 +238,65 @@ namespace ContactModels
       }
     }
 
+    // spherical particle pairs of a ContactBatch, same as collision() above
+    inline void collision(PairStyles::ContactBatch & batch, CollisionData&)
+    {
+      const double nktv2p = force->nktv2p;
+
+      for (int k = 0; k < batch.n; k++) {
+        const int itype = batch.itype[k];
+        const int jtype = batch.jtype[k];
+        const double ri = batch.radi[k];
+        const double rj = batch.radj[k];
+        const double reff = ri*rj/(ri+rj);
+        const double meff = batch.meff[k];
+        double coeffRestLogChosen;
+        const double sqrtval = sqrt(reff);
+
+        if (viscous)  {
+           // Stokes Number from MW Schmeeckle (2001)
+           const double stokes = meff*batch.vn[k]/(6.0*M_PI*coeffMu[itype][jtype]*reff*reff);
+           // Empirical from Legendre (2006)
+           coeffRestLogChosen = log(coeffRestMax[itype][jtype])+coeffStc[itype][jtype]/stokes;
+        } else {
+           coeffRestLogChosen = coeffRestLog[itype][jtype];
+        }
+
+        const double k0 = (16./15.)*sqrtval*(Yeff[itype][jtype]);
+        double kn = k0*pow(meff*charVel*charVel/k0,0.2);
+        double kt = kn;
+        if(ktToKn) kt *= kappa;
+        const double coeffRestLogChosenSq = coeffRestLogChosen*coeffRestLogChosen;
+        const double gamman = sqrt(4.*meff*kn*coeffRestLogChosenSq/(coeffRestLogChosenSq+M_PI*M_PI));
+        const double gammat = tangential_damping ? gamman : 0.0;
+
+        // convert Kn and Kt from pressure units to force/distance^2
+        kn /= nktv2p;
+        kt /= nktv2p;
+
+        const double Fn_damping = -gamman*batch.vn[k];
+        const double Fn_contact = kn*batch.deltan[k];
+        double Fn = Fn_damping + Fn_contact;
+
+        //limit force to avoid the artefact of negative repulsion force
+        if(limitForce && (Fn<0.0) )
+        {
+            Fn = 0.0;
+        }
+
+        batch.Fn[k] = Fn;
+        batch.kn[k] = kn;
+        batch.kt[k] = kt;
+        batch.gamman[k] = gamman;
+        batch.gammat[k] = gammat;
+
+        // apply normal force
+        batch.fx[k] = Fn * batch.enx[k];
+        batch.fy[k] = Fn * batch.eny[k];
+        batch.fz[k] = Fn * batch.enz[k];
+      }
+    }
+
     inline void noCollision(ContactData&, ForceData&, ForceData&){}
     void beginPass(CollisionData&, ForceData&, ForceData&){}
     void endPass(CollisionData&, ForceData&, ForceData&){}
@@ -61,6 +61,7 @@ Pair::Pair(LAMMPS *lmp) : Pointers(lmp)
   no_virial_fdotr_compute = 0;
   writedata = 0;
   ghostneigh = 0;
+  comm_overlap = 0;
 
   nextra = 0;
   pvector = NULL;
@@ -50,6 +50,8 @@ class Pair : protected Pointers {
   int no_virial_fdotr_compute;   // 1 if does not invoke virial_fdotr_compute()
   int writedata;                 // 1 if writes coeffs to data file
   int ghostneigh;                // 1 if pair style needs neighbors of ghosts
+  int comm_overlap;              // 1 if compute_interior() can run while
+                                 //   ghost coords are still communicated
   double **cutghost;             // cutoff for each ghost pair
 
   int ewaldflag;                 // 1 if compatible with Ewald solver
@@ -131,6 +133,12 @@ class Pair : protected Pointers {
   virtual void compute_middle() {}
   virtual void compute_outer(int, int) {}
 
+  // force computation split for overlap with forward comm
+  // interior = atoms without ghost neighbors, border = all others
+
+  virtual void compute_interior(int, int) {}
+  virtual void compute_border(int eflag, int vflag) {compute(eflag,vflag);}
+
   virtual double single(int, int, int, int,
                         double, double, double,
                         double& fforce) {
@@ -85,12 +85,21 @@ PairGran::PairGran(LAMMPS *lmp) : Pair(lmp)
   cpl_enable = 1;
   cpl_ = NULL;
 
+  contact_hook_ = NULL;
+
   energytrack_enable = 0;
   fppaCPEn = fppaCDEn = fppaCPEt = fppaCDEVt = fppaCDEFt = fppaCTFW = fppaDEH = NULL;
   CPEn = CDEn = CPEt = CDEVt = CDEFt = CTFW = DEH = NULL;
 
   computeflag_ = 0;
 
+  list_from_ = list_to_ = 0;
+  pass_begin_ = pass_end_ = true;
+  ninterior_ = 0;
+  split_ncalls_ = -1;
+  maxborder_ = 0;
+  ilist_border_ = NULL;
+
   needs_neighlist = true;
 
   fix_contact_forces_ = 0;
@@ -106,6 +115,8 @@ PairGran::~PairGran()
 
   if (suffix) delete[] suffix;
 
+  memory->destroy(ilist_border_);
+
   if (allocated) {
     memory->destroy(setflag);
     memory->destroy(cutsq);
@@ -507,6 +518,23 @@ void PairGran::unregister_compute_pair_local(ComputePairGranLocal *ptr)
    cpl_ = NULL;
 }
 
+/* ----------------------------------------------------------------------
+   register and unregister consumer of the contacts of the force pass
+------------------------------------------------------------------------- */
+
+void PairGran::register_contact_hook(LIGGGHTS::IContactHook *ptr)
+{
+   if(contact_hook_ != NULL && contact_hook_ != ptr)
+     error->all(FLERR,"Pair gran allows only one fix to be fused into the pair pass");
+   contact_hook_ = ptr;
+}
+
+void PairGran::unregister_contact_hook(LIGGGHTS::IContactHook *ptr)
+{
+   if(contact_hook_ != ptr) error->all(FLERR,"Illegal situation in PairGran::unregister_contact_hook");
+   contact_hook_ = NULL;
+}
+
 /* ----------------------------------------------------------------------
    return index for extra dnum
 ------------------------------------------------------------------------- */
@@ -586,9 +614,95 @@ void PairGran::compute(int eflag, int vflag)
    shearupdate_ = 1;
    if (update->setupflag) shearupdate_ = 0;
 
+   set_pass(0,list->inum,true,true);
    compute_force(eflag,vflag,0);
 }
 
+/* ----------------------------------------------------------------------
+   first part of a force pass overlapping the forward comm:
+   contacts of atoms without ghost neighbors, which only need owned
+   coords, in a few chunks so the comm can be advanced in between
+   only called on steps without reneighboring, so rigid body masses
+   of ghosts are up to date
+------------------------------------------------------------------------- */
+
+void PairGran::compute_interior(int eflag, int vflag)
+{
+  if(forceoff()) return;
+
+  if (split_ncalls_ != neighbor->ncalls) split_list();
+
+  computeflag_ = 1;
+  shearupdate_ = 1;
+  if (update->setupflag) shearupdate_ = 0;
+
+  const int nchunk = 4;
+  for (int ichunk = 0; ichunk < nchunk; ichunk++) {
+    set_pass(ichunk*ninterior_/nchunk,(ichunk+1)*ninterior_/nchunk,
+             ichunk == 0,false);
+    compute_force(eflag,vflag,0);
+    comm->forward_comm_progress();
+  }
+}
+
+/* ----------------------------------------------------------------------
+   second part of a force pass, after ghost coords have arrived
+------------------------------------------------------------------------- */
+
+void PairGran::compute_border(int eflag, int vflag)
+{
+  if(forceoff()) return;
+
+  set_pass(ninterior_,list->inum,false,true);
+  compute_force(eflag,vflag,0);
+}
+
+/* ----------------------------------------------------------------------
+   reorder ilist so atoms without ghost neighbors come first
+   done once per neighbor list build
+------------------------------------------------------------------------- */
+
+void PairGran::split_list()
+{
+  int inum = list->inum;
+  int *ilist = list->ilist;
+  int *numneigh = list->numneigh;
+  int **firstneigh = list->firstneigh;
+  int nlocal = atom->nlocal;
+
+  if (inum > maxborder_) {
+    maxborder_ = atom->nmax;
+    memory->destroy(ilist_border_);
+    memory->create(ilist_border_,maxborder_,"pair:ilist_border");
+  }
+
+  int ninterior = 0, nborder = 0;
+  for (int ii = 0; ii < inum; ii++) {
+    const int i = ilist[ii];
+    int *jlist = firstneigh[i];
+    const int jnum = numneigh[i];
+    int jj;
+    for (jj = 0; jj < jnum; jj++)
+      if ((jlist[jj] & NEIGHMASK) >= nlocal) break;
+    if (jj == jnum) ilist[ninterior++] = i;
+    else ilist_border_[nborder++] = i;
+  }
+  memcpy(&ilist[ninterior],ilist_border_,nborder*sizeof(int));
+
+  ninterior_ = ninterior;
+  split_ncalls_ = neighbor->ncalls;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void PairGran::set_pass(int from, int to, bool begin, bool end)
+{
+  list_from_ = from;
+  list_to_ = to;
+  pass_begin_ = begin;
+  pass_end_ = end;
+}
+
 /* ----------------------------------------------------------------------
    compute as called via compute pair gran local
 ------------------------------------------------------------------------- */
@@ -620,6 +734,7 @@ void PairGran::compute_pgl(int eflag, int vflag)
   computeflag_ = 0;
   shearupdate_ = 0;
 
+  set_pass(0,list->inum,true,true);
   compute_force(eflag,vflag,1);
 
   //NP computeflag_ stores if compute has been executed since last pre_exchange()
@@ -718,6 +833,7 @@ void *PairGran::extract(const char *str, int &dim)
 double PairGran::memory_usage()
 {
   double bytes = nmax * sizeof(double);
+  bytes += maxborder_ * sizeof(int);
   return bytes;
 }
 
@@ -54,6 +54,8 @@ public:
   /* INHERITED FROM Pair */
 
   virtual void compute(int eflag, int vflag);
+  virtual void compute_interior(int eflag, int vflag);
+  virtual void compute_border(int eflag, int vflag);
   virtual void compute_pgl(int eflag, int vflag);
   virtual void compute_single_pair(LCM::CollisionData & cdata, LCM::ForceData & i_forces, LCM::ForceData & j_forces);
   virtual void settings(int, char **) = 0;
@@ -79,6 +81,9 @@ public:
   void register_compute_pair_local(class ComputePairGranLocal *,int&);
   void unregister_compute_pair_local(class ComputePairGranLocal *ptr);
 
+  void register_contact_hook(LIGGGHTS::IContactHook *ptr);
+  void unregister_contact_hook(LIGGGHTS::IContactHook *ptr);
+
   inline void cpl_add_pair(LCM::CollisionData & cdata, LCM::ForceData & i_forces)
   {
     const double fx = i_forces.delta_F[0];
@@ -105,6 +110,10 @@ public:
     return cpl_;
   }
 
+  inline LIGGGHTS::IContactHook * contact_hook() {
+    return contact_hook_;
+  }
+
   inline bool storeContactForces() {
     return store_contact_forces_;
   }
@@ -121,6 +130,25 @@ public:
     return shearupdate_;
   }
 
+  // range of list->ilist a call to compute_force() loops over, and
+  // whether the call starts and/or ends the force pass of this step
+
+  inline int list_from() const {
+    return list_from_;
+  }
+
+  inline int list_to() const {
+    return list_to_;
+  }
+
+  inline bool pass_begin() const {
+    return pass_begin_;
+  }
+
+  inline bool pass_end() const {
+    return pass_end_;
+  }
+
   class FixContactPropertyAtom * fix_contact_forces() {
     return fix_contact_forces_;
   }
@@ -206,6 +234,9 @@ public:
   int cpl_enable;
   class ComputePairGranLocal *cpl_;
 
+  // consumer of the contacts found in the force pass, e.g. heat conduction
+  LIGGGHTS::IContactHook *contact_hook_;
+
   // storage for per-contact forces
   bool store_contact_forces_;
   class FixContactPropertyAtom *fix_contact_forces_;
@@ -227,6 +258,16 @@ public:
 
   int computeflag_;
 
+  // split force pass, see compute_interior()
+  int list_from_,list_to_;
+  bool pass_begin_,pass_end_;
+  int ninterior_;            // atoms w/o ghost neighbors are first in ilist
+  bigint split_ncalls_;      // neighbor build the split was done for
+  int maxborder_;
+  int *ilist_border_;
+  void split_list();
+  void set_pass(int from, int to, bool begin, bool end);
+
   double *onerad_dynamic,*onerad_frozen;
   double *maxrad_dynamic,*maxrad_frozen;
 
@@ -39,6 +39,7 @@
 #include "neigh_list.h"
 #include "fix_contact_property_atom.h"
 #include "os_specific.h"
+#include "contact_batch.h"
 
 #include "granular_pair_style.h"
 
@@ -54,8 +55,15 @@ class Granular : private Pointers, public IGranularPairStyle {
   CollisionData * aligned_cdata;
   ForceData * aligned_i_forces;
   ForceData * aligned_j_forces;
+  ContactBatch * aligned_batch;
   ContactModel cmodel;
 
+  // use the two-phase (gather / evaluate) pair pass
+  bool batched;
+
+  // contact hook of the force pass in progress
+  LIGGGHTS::IContactHook * pass_hook;
+
   inline void force_update(double * const f, double * const torque,
       const ForceData & forces) {
     for (int coord = 0; coord < 3; coord++) {
@@ -69,13 +77,17 @@ public:
     aligned_cdata(aligned_malloc<CollisionData>(32)),
     aligned_i_forces(aligned_malloc<ForceData>(32)),
     aligned_j_forces(aligned_malloc<ForceData>(32)),
-    cmodel(lmp, parent) {
+    aligned_batch(NULL),
+    cmodel(lmp, parent),
+    batched(false),
+    pass_hook(NULL) {
   }
 
   virtual ~Granular() {
     aligned_free(aligned_cdata);
     aligned_free(aligned_i_forces);
     aligned_free(aligned_j_forces);
+    if(aligned_batch) aligned_free(aligned_batch);
   }
 
   int64_t hashcode()
@@ -83,6 +95,7 @@ public:
 
   virtual void settings(int nargs, char ** args) {
     Settings settings(lmp);
+    settings.registerOnOff("batched", batched, false);
     cmodel.registerSettings(settings);
     bool success = settings.parseArguments(nargs, args);
 
@@ -105,6 +118,9 @@ public:
     if(!success) {
       error->all(FLERR,settings.error_message.c_str());
     }
+
+    if(batched && !aligned_batch)
+      aligned_batch = aligned_malloc<ContactBatch>(32);
   }
 
   virtual void init_granular() {
@@ -151,32 +167,94 @@ public:
     return cmodel.stressStrainExponent();
   }
 
+  int nstatistics()
+  {
+    return ContactModel::NSTATISTICS;
+  }
+
   virtual void compute_force(PairGran * pg, int eflag, int vflag, int addflag)
   {
-    if (eflag || vflag)
-      pg->ev_setup(eflag, vflag);
-    else
-      pg->evflag = pg->vflag_fdotr = 0;
+    // a force pass may be split into several calls, each over a range
+    // of the neighbor list, see PairGran::compute_interior()
+
+    if (pg->pass_begin()) {
+      if (eflag || vflag)
+        pg->ev_setup(eflag, vflag);
+      else
+        pg->evflag = pg->vflag_fdotr = 0;
+    }
 
     //NP update for fix rigid done in PairGran
 
+    const bool store_contact_forces = pg->storeContactForces();
+
+    CollisionData & cdata = *aligned_cdata;
+    ForceData & i_forces = *aligned_i_forces;
+    ForceData & j_forces = *aligned_j_forces;
+
+    if (pg->pass_begin()) {
+      // clear data, just to be safe
+      memset(aligned_cdata, 0, sizeof(CollisionData));
+      memset(aligned_i_forces, 0, sizeof(ForceData));
+      memset(aligned_j_forces, 0, sizeof(ForceData));
+      aligned_cdata->area_ratio = 1.0;
+
+      cdata.is_wall = false;
+      cdata.computeflag = pg->computeflag();
+      cdata.shearupdate = pg->shearupdate();
+
+      cmodel.beginPass(cdata, i_forces, j_forces);
+
+      // contacts are only handed out in the regular force pass,
+      // not when called via compute pair/gran/local
+      pass_hook = addflag ? NULL : pg->contact_hook();
+      if (pass_hook && !pass_hook->begin_contact_pass())
+        pass_hook = NULL;
+    }
+    LIGGGHTS::IContactHook * hook = pass_hook;
+
+    if (batched)
+      compute_force_batched(pg, addflag, hook);
+    else
+      compute_force_pairwise(pg, addflag, hook);
+
+    if (!pg->pass_end())
+      return;
+
+    cmodel.endPass(cdata, i_forces, j_forces);
+
+    // counters of the regular force pass are reported by compute pair
+    if (!addflag && pg->nextra)
+      cmodel.statistics(pg->pvector);
+
+    if (pg->vflag_fdotr) {
+      pg->virial_fdotr_compute();
+    }
+
+    if(store_contact_forces)
+        pg->fix_contact_forces()->do_forward_comm();
+  }
+
+  /* ----------------------------------------------------------------------
+     single pass over the neighbor list, one pair at a time
+  ------------------------------------------------------------------------- */
+
+  void compute_force_pairwise(PairGran * pg, int addflag, LIGGGHTS::IContactHook * hook)
+  {
     double **x = atom->x;
     double **v = atom->v;
-    double **f = atom->f;
     double **omega = atom->omega;
-    double **torque = atom->torque;
     double *radius = atom->radius;
     double *rmass = atom->rmass;
     double *mass = atom->mass;
     int *type = atom->type;
     int *mask = atom->mask;
-    int nlocal = atom->nlocal;
 #ifdef SUPERQUADRIC_ACTIVE_FLAG
     int superquadric_flag = atom->superquadric_flag;
 #endif
-    const int newton_pair = force->newton_pair;
 
-    int inum = pg->list->inum;
+    const int iifrom = pg->list_from();
+    const int iito = pg->list_to();
     int * ilist = pg->list->ilist;
     int * numneigh = pg->list->numneigh;
 
@@ -185,27 +263,15 @@ public:
     double ** firstshear = pg->listgranhistory ? pg->listgranhistory->firstdouble : NULL;
 
     const int dnum = pg->dnum();
-    const bool store_contact_forces = pg->storeContactForces();
     const int freeze_group_bit = pg->freeze_group_bit();
 
-    // clear data, just to be safe
-    memset(aligned_cdata, 0, sizeof(CollisionData));
-    memset(aligned_i_forces, 0, sizeof(ForceData));
-    memset(aligned_j_forces, 0, sizeof(ForceData));
-    aligned_cdata->area_ratio = 1.0;
-
     CollisionData & cdata = *aligned_cdata;
     ForceData & i_forces = *aligned_i_forces;
     ForceData & j_forces = *aligned_j_forces;
-    cdata.is_wall = false;
-    cdata.computeflag = pg->computeflag();
-    cdata.shearupdate = pg->shearupdate();
-
-    cmodel.beginPass(cdata, i_forces, j_forces);
 
     // loop over neighbors of my atoms
 
-    for (int ii = 0; ii < inum; ii++) {
+    for (int ii = iifrom; ii < iito; ii++) {
       const int i = ilist[ii];
       const double xtmp = x[i][0];
       const double ytmp = x[i][1];
@@ -328,6 +394,9 @@ public:
 
           cmodel.collision(cdata, i_forces, j_forces);
 
+          if (hook)
+            hook->add_contact(cdata);
+
           // if there is a collision, there will always be a force
           cdata.has_force_update = true;
 
@@ -337,51 +406,321 @@ public:
           cmodel.noCollision(cdata, i_forces, j_forces);
         }
 
-        if(cdata.has_force_update) {
-          if (cdata.computeflag) {
-            force_update(f[i], torque[i], i_forces);
+        if(cdata.has_force_update)
+          apply_force_update(pg, addflag);
+      }
+    }
+  }
 
-            if(newton_pair || j < nlocal) {
-              force_update(f[j], torque[j], j_forces);
-            }
-          }
+  /* ----------------------------------------------------------------------
+     two-phase pass over the neighbor list
+     pairs are gathered into a ContactBatch in neighbor list order, so the
+     contact models see exactly the same sequence of pairs as in the
+     pair-by-pair pass. pairs out of contact are only gathered if one of
+     the selected models handles noCollision(), otherwise they are dropped
+     right after the distance check
+  ------------------------------------------------------------------------- */
 
-          //NP call to compute_pair_gran_local
-          if (pg->cpl() && addflag)
-            pg->cpl_add_pair(cdata, i_forces);
-
-          if (pg->evflag)
-            pg->ev_tally_xyz(i, j, nlocal, newton_pair, 0.0, 0.0,i_forces.delta_F[0],i_forces.delta_F[1],i_forces.delta_F[2],cdata.delta[0],cdata.delta[1],cdata.delta[2]);
-
-          if (store_contact_forces)
-          {
-            double forces_torques_i[6],forces_torques_j[6];
-
-            if(pg->fix_contact_forces()->has_partner(i,atom->tag[j]) == -1)
-            {
-                vectorCopy3D(i_forces.delta_F,&(forces_torques_i[0]));
-                vectorCopy3D(i_forces.delta_torque,&(forces_torques_i[3]));
-                pg->fix_contact_forces()->add_partner(i,atom->tag[j],forces_torques_i);
-            }
-            if(pg->fix_contact_forces()->has_partner(j,atom->tag[i]) == -1)
-            {
-                vectorCopy3D(j_forces.delta_F,&(forces_torques_j[0]));
-                vectorCopy3D(j_forces.delta_torque,&(forces_torques_j[3]));
-                pg->fix_contact_forces()->add_partner(j,atom->tag[i],forces_torques_j);
-            }
+  void compute_force_batched(PairGran * pg, int addflag, LIGGGHTS::IContactHook * hook)
+  {
+    double **v = atom->v;
+    double **omega = atom->omega;
+    double *radius = atom->radius;
+    int *type = atom->type;
+    const bool sphere_flag = atom->sphere_flag;
+#ifdef SUPERQUADRIC_ACTIVE_FLAG
+    const bool superquadric_flag = atom->superquadric_flag;
+    double *rmass = atom->rmass;
+    double *mass = atom->mass;
+#endif
+
+    CollisionData & cdata = *aligned_cdata;
+    ForceData & i_forces = *aligned_i_forces;
+    ForceData & j_forces = *aligned_j_forces;
+
+    // the batched collision() of the models is written for spheres
+#ifdef SUPERQUADRIC_ACTIVE_FLAG
+    const bool collide_batch = ContactModel::HANDLE_COLLISION_BATCH && sphere_flag && !superquadric_flag;
+#else
+    const bool collide_batch = ContactModel::HANDLE_COLLISION_BATCH && sphere_flag;
+#endif
+
+    ContactBatch & batch = *aligned_batch;
+    batch.begin(atom, pg, ContactModel::HANDLE_NO_COLLISION, collide_batch, pg->list_from(), pg->list_to());
+
+    while (batch.gather()) {
+      if (collide_batch) {
+        compute_batch_collision(pg, addflag, hook);
+        continue;
+      }
+
+      batch.evaluate();
+
+      // contact models, pair by pair in gather order
+
+      for (int k = 0; k < batch.n; k++) {
+        const int i = batch.i[k];
+        const int j = batch.j[k];
+
+        cdata.i = i;
+        cdata.j = j;
+        cdata.radi = radius[i];
+        cdata.radj = radius[j];
+        cdata.delta[0] = batch.delx[k];
+        cdata.delta[1] = batch.dely[k];
+        cdata.delta[2] = batch.delz[k];
+        cdata.rsq = batch.rsq[k];
+        cdata.radsum = batch.radsum[k];
+        cdata.touch = batch.touch[k];
+        cdata.contact_history = batch.contact_history[k];
+        cdata.v_i = v[i];
+        cdata.v_j = v[j];
+        cdata.itype = type[i];
+        cdata.jtype = type[j];
+        cdata.omega_i = omega[i];
+        cdata.omega_j = omega[j];
+
+        i_forces.reset();
+        j_forces.reset();
+
+#ifdef SUPERQUADRIC_ACTIVE_FLAG
+        //NP the bounding spheres of the whole batch have been checked by
+        //NP evaluate(), the surface check (OBB, then contact point) is only
+        //NP done for the remaining pairs
+        if (superquadric_flag) {
+          cdata.radi = cbrt(0.75 * atom->volume[i] / M_PI);
+          cdata.radj = cbrt(0.75 * atom->volume[j] / M_PI);
+          cdata.mi = rmass ? rmass[i] : mass[type[i]];
+          cdata.mj = rmass ? rmass[j] : mass[type[j]];
+        }
+        if (batch.contact[k] && !cmodel.checkSurfaceIntersect(cdata))
+          batch.contact[k] = 0;
+#endif
+
+        if (batch.contact[k]) {
+          cdata.r = batch.r[k];
+          cdata.rinv = batch.rinv[k];
+          cdata.meff = batch.meff[k];
+          cdata.mi = batch.mi[k];
+          cdata.mj = batch.mj[k];
+          if (sphere_flag) {
+            cdata.en[0] = batch.enx[k];
+            cdata.en[1] = batch.eny[k];
+            cdata.en[2] = batch.enz[k];
           }
+
+          cmodel.collision(cdata, i_forces, j_forces);
+
+          if (hook)
+            hook->add_contact(cdata);
+
+          // if there is a collision, there will always be a force
+          cdata.has_force_update = true;
+        } else {
+          // apply force update only if selected contact models have requested it
+          cdata.has_force_update = false;
+          cmodel.noCollision(cdata, i_forces, j_forces);
         }
+
+        if(cdata.has_force_update)
+          apply_force_update(pg, addflag);
       }
     }
+  }
 
-    cmodel.endPass(cdata, i_forces, j_forces);
+  /* ----------------------------------------------------------------------
+     contact models applied to the whole batch at once, for combinations
+     where all models handle CM_COLLISION_BATCH
+     pairs out of contact go through noCollision() one by one first, they
+     only reset their own contact history, so they just get the pair and
+     its history. the pairs in contact are then compacted, evaluated,
+     handed to the models as arrays and scattered in gather order, so the
+     result is the same as in the pair-by-pair pass. without hooks, local
+     output or virial the scatter goes straight to f and torque
+  ------------------------------------------------------------------------- */
+
+  void compute_batch_collision(PairGran * pg, int addflag, LIGGGHTS::IContactHook * hook)
+  {
+    double **v = atom->v;
+    double **omega = atom->omega;
 
-    if (pg->vflag_fdotr) {
-      pg->virial_fdotr_compute();
+    CollisionData & cdata = *aligned_cdata;
+    ForceData & i_forces = *aligned_i_forces;
+    ForceData & j_forces = *aligned_j_forces;
+    ContactBatch & batch = *aligned_batch;
+
+    if (ContactModel::HANDLE_NO_COLLISION && batch.ncontact < batch.n) {
+      for (int k = 0; k < batch.n; k++) {
+        if (batch.contact[k])
+          continue;
+
+        cdata.i = batch.i[k];
+        cdata.j = batch.j[k];
+        cdata.delta[0] = batch.delx[k];
+        cdata.delta[1] = batch.dely[k];
+        cdata.delta[2] = batch.delz[k];
+        cdata.rsq = batch.rsq[k];
+        cdata.radsum = batch.radsum[k];
+        cdata.touch = batch.touch[k];
+        cdata.contact_history = batch.contact_history[k];
+
+        cmodel.noCollision(cdata, i_forces, j_forces);
+      }
+
+      batch.compact();
     }
 
-    if(store_contact_forces)
-        pg->fix_contact_forces()->do_forward_comm();
+    batch.evaluate();
+    batch.load();
+    cmodel.collision(batch, cdata);
+
+    // nothing but the forces and torques to scatter
+    if (!hook && cdata.computeflag && !(pg->cpl() && addflag) && !pg->evflag && !pg->storeContactForces()) {
+      double **f = atom->f;
+      double **torque = atom->torque;
+      const int nlocal = atom->nlocal;
+      const int newton_pair = force->newton_pair;
+
+      for (int k = 0; k < batch.n; k++) {
+        const int i = batch.i[k];
+        const int j = batch.j[k];
+
+        f[i][0] += batch.fx[k];
+        f[i][1] += batch.fy[k];
+        f[i][2] += batch.fz[k];
+        torque[i][0] += batch.torqueix[k];
+        torque[i][1] += batch.torqueiy[k];
+        torque[i][2] += batch.torqueiz[k];
+
+        if (newton_pair || j < nlocal) {
+          f[j][0] -= batch.fx[k];
+          f[j][1] -= batch.fy[k];
+          f[j][2] -= batch.fz[k];
+          torque[j][0] += batch.torquejx[k];
+          torque[j][1] += batch.torquejy[k];
+          torque[j][2] += batch.torquejz[k];
+        }
+      }
+      return;
+    }
+
+    for (int k = 0; k < batch.n; k++) {
+      const int i = batch.i[k];
+      const int j = batch.j[k];
+
+      cdata.i = i;
+      cdata.j = j;
+      cdata.delta[0] = batch.delx[k];
+      cdata.delta[1] = batch.dely[k];
+      cdata.delta[2] = batch.delz[k];
+      cdata.touch = batch.touch[k];
+      cdata.contact_history = batch.contact_history[k];
+
+      i_forces.delta_F[0] = batch.fx[k];
+      i_forces.delta_F[1] = batch.fy[k];
+      i_forces.delta_F[2] = batch.fz[k];
+      i_forces.delta_torque[0] = batch.torqueix[k];
+      i_forces.delta_torque[1] = batch.torqueiy[k];
+      i_forces.delta_torque[2] = batch.torqueiz[k];
+      j_forces.delta_F[0] = -batch.fx[k];
+      j_forces.delta_F[1] = -batch.fy[k];
+      j_forces.delta_F[2] = -batch.fz[k];
+      j_forces.delta_torque[0] = batch.torquejx[k];
+      j_forces.delta_torque[1] = batch.torquejy[k];
+      j_forces.delta_torque[2] = batch.torquejz[k];
+
+      // contact hooks see the complete collision data
+      if (hook) {
+        cdata.radi = batch.radi[k];
+        cdata.radj = batch.radj[k];
+        cdata.rsq = batch.rsq[k];
+        cdata.radsum = batch.radsum[k];
+        cdata.v_i = v[i];
+        cdata.v_j = v[j];
+        cdata.omega_i = omega[i];
+        cdata.omega_j = omega[j];
+        cdata.itype = batch.itype[k];
+        cdata.jtype = batch.jtype[k];
+        cdata.r = batch.r[k];
+        cdata.rinv = batch.rinv[k];
+        cdata.en[0] = batch.enx[k];
+        cdata.en[1] = batch.eny[k];
+        cdata.en[2] = batch.enz[k];
+        cdata.mi = batch.mi[k];
+        cdata.mj = batch.mj[k];
+        cdata.meff = batch.meff[k];
+        cdata.vn = batch.vn[k];
+        cdata.deltan = batch.deltan[k];
+        cdata.cri = batch.cri[k];
+        cdata.crj = batch.crj[k];
+        cdata.wr1 = batch.wr1[k];
+        cdata.wr2 = batch.wr2[k];
+        cdata.wr3 = batch.wr3[k];
+        cdata.vtr1 = batch.vtr1[k];
+        cdata.vtr2 = batch.vtr2[k];
+        cdata.vtr3 = batch.vtr3[k];
+        cdata.kn = batch.kn[k];
+        cdata.kt = batch.kt[k];
+        cdata.gamman = batch.gamman[k];
+        cdata.gammat = batch.gammat[k];
+        cdata.Fn = batch.Fn[k];
+
+        hook->add_contact(cdata);
+      }
+
+      cdata.has_force_update = true;
+      apply_force_update(pg, addflag);
+    }
+  }
+
+  /* ----------------------------------------------------------------------
+     scatter the force and torque of one pair, feed compute pair/gran/local,
+     the virial and the per-contact force storage
+  ------------------------------------------------------------------------- */
+
+  inline void apply_force_update(PairGran * pg, int addflag)
+  {
+    CollisionData & cdata = *aligned_cdata;
+    ForceData & i_forces = *aligned_i_forces;
+    ForceData & j_forces = *aligned_j_forces;
+
+    const int i = cdata.i;
+    const int j = cdata.j;
+    const int nlocal = atom->nlocal;
+    const int newton_pair = force->newton_pair;
+
+    if (cdata.computeflag) {
+      force_update(atom->f[i], atom->torque[i], i_forces);
+
+      if(newton_pair || j < nlocal) {
+        force_update(atom->f[j], atom->torque[j], j_forces);
+      }
+    }
+
+    //NP call to compute_pair_gran_local
+    if (pg->cpl() && addflag)
+      pg->cpl_add_pair(cdata, i_forces);
+
+    if (pg->evflag)
+      pg->ev_tally_xyz(i, j, nlocal, newton_pair, 0.0, 0.0,i_forces.delta_F[0],i_forces.delta_F[1],i_forces.delta_F[2],cdata.delta[0],cdata.delta[1],cdata.delta[2]);
+
+    if (pg->storeContactForces())
+    {
+      double forces_torques_i[6],forces_torques_j[6];
+
+      if(pg->fix_contact_forces()->has_partner(i,atom->tag[j]) == -1)
+      {
+          vectorCopy3D(i_forces.delta_F,&(forces_torques_i[0]));
+          vectorCopy3D(i_forces.delta_torque,&(forces_torques_i[3]));
+          pg->fix_contact_forces()->add_partner(i,atom->tag[j],forces_torques_i);
+      }
+      if(pg->fix_contact_forces()->has_partner(j,atom->tag[i]) == -1)
+      {
+          vectorCopy3D(j_forces.delta_F,&(forces_torques_j[0]));
+          vectorCopy3D(j_forces.delta_torque,&(forces_torques_j[3]));
+          pg->fix_contact_forces()->add_partner(j,atom->tag[i],forces_torques_j);
+      }
+    }
   }
 
   virtual void compute_single_pair_force(CollisionData & cdata, ForceData & i_forces, ForceData & j_forces)
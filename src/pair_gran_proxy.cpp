@@ -39,11 +39,13 @@ using namespace LIGGGHTS::PairStyles;
 
 PairGranProxy::PairGranProxy(LAMMPS * lmp) : PairGran(lmp), impl(NULL)
 {
+  comm_overlap = 1;
 }
 
 PairGranProxy::~PairGranProxy()
 {
   delete impl;
+  delete [] pvector;
 }
 
 void PairGranProxy::settings(int nargs, char ** args)
@@ -81,6 +83,8 @@ void PairGranProxy::settings(int nargs, char ** args)
   } else {
     error->one(FLERR, "unknown contact model");
   }
+
+  setup_statistics();
 }
 
 void PairGranProxy::init_granular()
@@ -114,6 +118,22 @@ void PairGranProxy::read_restart_settings(FILE * fp)
   } else {
     error->one(FLERR, "unknown contact model");
   }
+
+  setup_statistics();
+}
+
+// counters of the contact model are exposed as extra pair quantities,
+// compute pair sums them over all procs
+void PairGranProxy::setup_statistics()
+{
+  delete [] pvector;
+  pvector = NULL;
+
+  nextra = impl->nstatistics();
+  if(nextra) {
+    pvector = new double[nextra];
+    for(int i = 0; i < nextra; i++) pvector[i] = 0.0;
+  }
 }
 
 void PairGranProxy::compute_force(int eflag, int vflag, int addflag)
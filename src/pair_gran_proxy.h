@@ -54,6 +54,9 @@ public:
 
   virtual double stressStrainExponent();
   virtual int64_t hashcode();
+
+private:
+  void setup_statistics();
 };
 }
 
@@ -46,6 +46,7 @@ andreas.aigner@jku.at
 #include "memory.h"
 #include "error.h"
 #include "sph_kernels.h"
+#include "fix_sph_density_summation.h"
 #include "timer.h"
 
 using namespace LAMMPS_NS;
@@ -66,7 +67,8 @@ PairSphArtviscTenscorr::PairSphArtviscTenscorr(LAMMPS *lmp) : PairSph(lmp),
     epsilonPPG(NULL),
     deltaP(NULL),
     wDeltaPTypeinv(NULL),
-    epsilon(0.)
+    epsilon(0.),
+    fixDensitySum_(NULL)
 {
   respa_enable = 0;
   single_enable = 0;
@@ -173,6 +175,14 @@ void PairSphArtviscTenscorr::init_substyle()
 {
   const int max_type = atom->ntypes;
 
+  // a fused density summation is evaluated within compute()
+
+  fixDensitySum_ = NULL;
+  for (int ifix = 0; ifix < modify->nfix; ifix++) {
+    FixSPHDensitySum *fix = dynamic_cast<FixSPHDensitySum*>(modify->fix[ifix]);
+    if (fix && fix->fused()) fixDensitySum_ = fix;
+  }
+
   //create wDeltaPTypeInv
   if (mass_type && tensCorr_flag) {
 
@@ -253,8 +263,24 @@ void PairSphArtviscTenscorr::allocate_properties(int size)
 
 void PairSphArtviscTenscorr::compute(int eflag, int vflag)
 {
-  if (mass_type) compute_eval<1>(eflag,vflag);
-  else compute_eval<0>(eflag,vflag);
+  if (mass_type) compute_kernel<1>(eflag,vflag);
+  else compute_kernel<0>(eflag,vflag);
+}
+
+/* ----------------------------------------------------------------------
+   select the kernel at compile time, kernel_id is checked in settings
+------------------------------------------------------------------------- */
+
+template <int MASSFLAG>
+void PairSphArtviscTenscorr::compute_kernel(int eflag, int vflag)
+{
+  if (0) return;
+  #define SPH_KERNEL_CLASS
+  #define SPHKernel(id,kernelstyle,SPHKernelCalculation,SPHKernelCalculationDer,SPHKernelCalculationCut) \
+  else if (kernel_id == id) compute_eval<MASSFLAG,id>(eflag,vflag);
+  #include "style_sph_kernel.h"
+  #undef SPH_KERNEL_CLASS
+  #undef SPHKernel
 }
 
 /* ----------------------------------------------------------------------
@@ -317,7 +343,7 @@ void PairSphArtviscTenscorr::read_restart_settings(FILE *fp)
    template compute
 ------------------------------------------------------------------------- */
 
-template <int MASSFLAG>
+template <int MASSFLAG, int KERNEL_ID>
 void PairSphArtviscTenscorr::compute_eval(int eflag, int vflag)
 {
   double sli,slCom,imass,jmass;
@@ -360,6 +386,11 @@ void PairSphArtviscTenscorr::compute_eval(int eflag, int vflag)
     updatePtrs(); // get sl
   }
 
+  // fused mode: sum density and set pressure, one ghost exchange
+  // not during setup, where the separate pass does not sum either
+
+  if (fixDensitySum_ && !update->setupflag) fixDensitySum_->sum_density();
+
   for (int ii = 0; ii < inum; ii++) {
     const int i = ilist[ii];
     const int itype = type[i];
@@ -423,7 +454,7 @@ void PairSphArtviscTenscorr::compute_eval(int eflag, int vflag)
         const double s = r * slComInv;
 
         // calculate value for magnitude of grad W
-        const double gradWmag = SPH_KERNEL_NS::sph_kernel_der(kernel_id,s,slCom,slComInv);
+        const double gradWmag = SPH_KERNEL_NS::sph_kernel_der<KERNEL_ID>(s,slCom,slComInv);
 
         // artificial viscosity
         artVisc = 0.0;
@@ -464,11 +495,11 @@ void PairSphArtviscTenscorr::compute_eval(int eflag, int vflag)
           } else {
             // assumption that deltaP = sl / 1.2
             const double deltaPOne = slCom/1.2;
-            wDeltaPinv = 1./SPH_KERNEL_NS::sph_kernel(kernel_id,deltaPOne * slComInv,slCom,slComInv);
+            wDeltaPinv = 1./SPH_KERNEL_NS::sph_kernel<KERNEL_ID>(deltaPOne * slComInv,slCom,slComInv);
           }
 
           //TODO: Is fAB4 in this form ok?!
-          const double fAB =  SPH_KERNEL_NS::sph_kernel(kernel_id,s,slCom,slComInv) * wDeltaPinv;
+          const double fAB =  SPH_KERNEL_NS::sph_kernel<KERNEL_ID>(s,slCom,slComInv) * wDeltaPinv;
           const double fAB2 = fAB * fAB;
           fAB4 = fAB2 * fAB2;
         }
@@ -57,7 +57,8 @@ class PairSphArtviscTenscorr : public PairSph {
 
  protected:
   void allocate();
-  template <int> void compute_eval(int, int);
+  template <int> void compute_kernel(int, int);
+  template <int,int> void compute_eval(int, int);
 
   int     artVisc_flag, tensCorr_flag; // flags for additional styles
 
@@ -73,6 +74,8 @@ class PairSphArtviscTenscorr : public PairSph {
   double  **wDeltaPTypeinv;
   double  epsilon; // coeffs for tensile correction
 
+  class   FixSPHDensitySum *fixDensitySum_; // fused density summation, if any
+
 };
 
 }
@@ -0,0 +1,330 @@
+/* ----------------------------------------------------------------------
+   LIGGGHTS - LAMMPS Improved for General Granular and Granular Heat
+   Transfer Simulations
+
+   LIGGGHTS is part of the CFDEMproject
+   www.liggghts.com | www.cfdem.com
+
+   Christoph Kloss, christoph.kloss@cfdem.com
+   Copyright 2009-2012 JKU Linz
+   Copyright 2012-     DCS Computing GmbH, Linz
+
+   LIGGGHTS is based on LAMMPS
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   This software is distributed under the GNU General Public License.
+
+   See the README file in the top-level directory.
+------------------------------------------------------------------------- */
+
+#include <string.h>
+#include <algorithm>
+#include "partitioner_sfc.h"
+#include "space_filling_curve.h"
+#include "atom.h"
+#include "comm.h"
+#include "force.h"
+#include "neighbor.h"
+#include "update.h"
+#include "error.h"
+
+using namespace LAMMPS_NS;
+
+#define MIN_ATOMS_PER_THREAD 100
+#define BINS_PER_ATOM 8          // max # of bins per local atom
+#define BIG 1.0e20
+
+/* ---------------------------------------------------------------------- */
+
+SFCPartitioner::SFCPartitioner(LAMMPS *lmp, int narg, const char * const * arg) :
+  Partitioner(lmp),
+  nevery(1000),
+  imbalance(1.1),
+  boundary(0.5),
+  last_partitioning(-1),
+  bits(0),
+  fboundary(-1.0)
+{
+  int iarg = 0;
+  while (iarg < narg) {
+    if (iarg+2 > narg) error->all(FLERR,"Illegal partitioner_style sfc command");
+    char *value = const_cast<char*>(arg[iarg+1]);
+    if (strcmp(arg[iarg],"every") == 0) {
+      nevery = force->inumeric(FLERR,value);
+      if (nevery <= 0) error->all(FLERR,"Illegal partitioner_style sfc command");
+    } else if (strcmp(arg[iarg],"imbalance") == 0) {
+      imbalance = force->numeric(FLERR,value);
+      if (imbalance < 1.0) error->all(FLERR,"Illegal partitioner_style sfc command");
+    } else if (strcmp(arg[iarg],"boundary") == 0) {
+      boundary = force->numeric(FLERR,value);
+      if (boundary < 0.0 || boundary > 1.0)
+        error->all(FLERR,"Illegal partitioner_style sfc command");
+    } else error->all(FLERR,"Illegal partitioner_style sfc command");
+    iarg += 2;
+  }
+
+  nbin[0] = nbin[1] = nbin[2] = 1;
+  binlo[0] = binlo[1] = binlo[2] = 0.0;
+  bininv[0] = bininv[1] = bininv[2] = 0.0;
+}
+
+/* ----------------------------------------------------------------------
+   partitioning only pays off with enough atoms per thread
+   if most atoms of the last partitioning were next to another thread's
+     atoms, use plain spatial sort until the next full partitioning
+------------------------------------------------------------------------- */
+
+bool SFCPartitioner::is_cost_effective() const
+{
+  if (comm->nthreads == 1) return false;
+  if (atom->nlocal < MIN_ATOMS_PER_THREAD*comm->nthreads) return false;
+  if (fboundary > boundary && last_partitioning >= 0 &&
+      update->ntimestep - last_partitioning < nevery) return false;
+  return true;
+}
+
+/* ----------------------------------------------------------------------
+   assign atoms to threads as consecutive pieces of a Hilbert curve
+     through bins of the size of the neighbor cutoff
+   full partitioning every nevery steps or if amending the previous
+     partitions leaves threads imbalanced
+------------------------------------------------------------------------- */
+
+Partitioner::Result SFCPartitioner::generate_partitions(int * permute, std::vector<int> & thread_offsets)
+{
+  const int nthreads = comm->nthreads;
+  if (atom->nlocal == 0 || nthreads == 1) return FAILED;
+
+  if (last_partitioning < 0 ||
+      update->ntimestep - last_partitioning >= nevery ||
+      static_cast<int>(cuts.size()) != nthreads+1)
+    return full_partition(permute,thread_offsets);
+
+  return amend_partition(permute,thread_offsets);
+}
+
+/* ----------------------------------------------------------------------
+   bins covering the bounding box of owned atoms
+   bins are at least as large as the neighbor cutoff, so only atoms in
+     adjacent bins can be in contact, and are coarsened if needed to
+     limit the # of bins
+------------------------------------------------------------------------- */
+
+void SFCPartitioner::setup_bins()
+{
+  double **x = atom->x;
+  const int nlocal = atom->nlocal;
+
+  double lo[3] = {BIG,BIG,BIG};
+  double hi[3] = {-BIG,-BIG,-BIG};
+  for (int i = 0; i < nlocal; i++)
+    for (int d = 0; d < 3; d++) {
+      lo[d] = std::min(lo[d],x[i][d]);
+      hi[d] = std::max(hi[d],x[i][d]);
+    }
+
+  double binsize = neighbor->cutneighmax;
+  if (binsize <= 0.0) binsize = std::max(hi[0]-lo[0],std::max(hi[1]-lo[1],hi[2]-lo[2]));
+
+  const bigint maxbins = static_cast<bigint>(BINS_PER_ATOM)*nlocal;
+  const int maxdim = 1 << SpaceFillingCurve::MAXBITS;
+
+  while (true) {
+    bigint nbins = 1;
+    bool fits = true;
+    for (int d = 0; d < 3; d++) {
+      const double n = (binsize > 0.0) ? (hi[d]-lo[d])/binsize : 1.0;
+      if (n >= maxdim) {
+        fits = false;
+        break;
+      }
+      nbin[d] = std::max(1,static_cast<int>(n));
+      nbins *= nbin[d];
+    }
+    if (fits && nbins <= maxbins) break;
+    binsize *= 1.25;
+  }
+
+  for (int d = 0; d < 3; d++) {
+    binlo[d] = lo[d];
+    bininv[d] = (hi[d] > lo[d]) ? nbin[d]/(hi[d]-lo[d]) : 0.0;
+  }
+
+  bits = SpaceFillingCurve::bits_for(std::max(nbin[0],std::max(nbin[1],nbin[2])));
+}
+
+/* ----------------------------------------------------------------------
+   bin index and curve key of a coordinate
+   coords outside the bins of the last full partitioning go to edge bins
+------------------------------------------------------------------------- */
+
+int SFCPartitioner::coord2bin(const double *xi, uint32_t &key) const
+{
+  int ib[3];
+  for (int d = 0; d < 3; d++) {
+    ib[d] = static_cast<int>((xi[d]-binlo[d])*bininv[d]);
+    ib[d] = std::max(0,std::min(ib[d],nbin[d]-1));
+  }
+  key = SpaceFillingCurve::hilbert_key(ib[0],ib[1],ib[2],bits);
+  return (ib[2]*nbin[1] + ib[1])*nbin[0] + ib[0];
+}
+
+/* ----------------------------------------------------------------------
+   sort atoms along the curve and cut it into nthreads pieces of equal load
+   load of an atom is the # of atoms in its bin, which approximates
+     its # of contacts, cuts are only placed between bins
+------------------------------------------------------------------------- */
+
+Partitioner::Result SFCPartitioner::full_partition(int * permute, std::vector<int> & thread_offsets)
+{
+  double **x = atom->x;
+  int *thread = atom->thread;
+  const int nlocal = atom->nlocal;
+  const int nthreads = comm->nthreads;
+
+  setup_bins();
+
+  const int nbins = nbin[0]*nbin[1]*nbin[2];
+  binatoms.assign(nbins,0);
+  binthread.assign(nbins,-1);
+  keys.resize(nlocal);
+
+  double total = 0.0;
+  for (int i = 0; i < nlocal; i++) {
+    uint32_t key;
+    const int ibin = coord2bin(x[i],key);
+    total += 2*binatoms[ibin] + 1;   // sums up to the squared bin counts
+    binatoms[ibin]++;
+    keys[i] = (static_cast<uint64_t>(key) << 32) | static_cast<uint32_t>(i);
+  }
+
+  std::sort(keys.begin(),keys.end());
+
+  cuts.assign(nthreads+1,UINT32_MAX);
+  cuts[0] = 0;
+  count.assign(nthreads,0);
+
+  int tid = 0;
+  double sum = 0.0;
+  uint32_t lastkey = 0;
+  for (int n = 0; n < nlocal; n++) {
+    const int i = static_cast<int>(keys[n] & 0xffffffff);
+    const uint32_t key = static_cast<uint32_t>(keys[n] >> 32);
+    if (tid < nthreads-1 && key != lastkey &&
+        sum >= (tid+1)*total/nthreads)
+      cuts[++tid] = key;
+    lastkey = key;
+
+    uint32_t dummy;
+    const int ibin = coord2bin(x[i],dummy);
+    sum += binatoms[ibin];
+    binthread[ibin] = tid;
+
+    permute[n] = i;
+    count[tid]++;
+    if (thread) thread[i] = tid;
+  }
+
+  thread_offsets.resize(nthreads+1);
+  thread_offsets[0] = 0;
+  for (int t = 0; t < nthreads; t++)
+    thread_offsets[t+1] = thread_offsets[t] + count[t];
+
+  last_partitioning = update->ntimestep;
+  measure_boundary();
+  return NEW_PARTITIONS;
+}
+
+/* ----------------------------------------------------------------------
+   assign atoms to the curve pieces of the last full partitioning
+   atoms keep their relative order within a thread, atoms that moved
+     or arrived since are appended to the thread that owns their bin
+   fall back to a full partitioning if loads have drifted apart
+------------------------------------------------------------------------- */
+
+Partitioner::Result SFCPartitioner::amend_partition(int * permute, std::vector<int> & thread_offsets)
+{
+  double **x = atom->x;
+  int *thread = atom->thread;
+  const int nlocal = atom->nlocal;
+  const int nthreads = comm->nthreads;
+
+  part.resize(nlocal);
+  std::fill(binatoms.begin(),binatoms.end(),0);
+  std::fill(binthread.begin(),binthread.end(),-1);
+  count.assign(nthreads,0);
+  load.assign(nthreads,0.0);
+
+  // a bin has a single curve key, so all its atoms go to the same thread
+
+  for (int i = 0; i < nlocal; i++) {
+    uint32_t key;
+    const int ibin = coord2bin(x[i],key);
+    const int t = std::upper_bound(cuts.begin(),cuts.end(),key) - cuts.begin() - 1;
+    part[i] = std::max(0,std::min(t,nthreads-1));
+    binatoms[ibin]++;
+    binthread[ibin] = part[i];
+    count[part[i]]++;
+  }
+
+  double total = 0.0;
+  const int nbins = binatoms.size();
+  for (int ibin = 0; ibin < nbins; ibin++) {
+    if (binthread[ibin] < 0) continue;
+    const double binload = static_cast<double>(binatoms[ibin])*binatoms[ibin];
+    load[binthread[ibin]] += binload;
+    total += binload;
+  }
+
+  const double maxload = *std::max_element(load.begin(),load.end());
+  if (maxload*nthreads > imbalance*total)
+    return full_partition(permute,thread_offsets);
+
+  thread_offsets.resize(nthreads+1);
+  thread_offsets[0] = 0;
+  for (int t = 0; t < nthreads; t++)
+    thread_offsets[t+1] = thread_offsets[t] + count[t];
+
+  for (int t = 0; t < nthreads; t++) count[t] = thread_offsets[t];
+  for (int i = 0; i < nlocal; i++) {
+    permute[count[part[i]]++] = i;
+    if (thread) thread[i] = part[i];
+  }
+
+  return NEW_PARTITIONS;
+}
+
+/* ----------------------------------------------------------------------
+   fraction of atoms whose bin touches a bin of another thread
+   these are the atoms that can have contacts across threads
+------------------------------------------------------------------------- */
+
+void SFCPartitioner::measure_boundary()
+{
+  const int nlocal = atom->nlocal;
+  bigint nboundary = 0;
+
+  for (int iz = 0; iz < nbin[2]; iz++)
+    for (int iy = 0; iy < nbin[1]; iy++)
+      for (int ix = 0; ix < nbin[0]; ix++) {
+        const int ibin = (iz*nbin[1] + iy)*nbin[0] + ix;
+        const int t = binthread[ibin];
+        if (t < 0) continue;
+
+        bool shared = false;
+        for (int dz = -1; dz <= 1 && !shared; dz++)
+          for (int dy = -1; dy <= 1 && !shared; dy++)
+            for (int dx = -1; dx <= 1 && !shared; dx++) {
+              const int jx = ix+dx, jy = iy+dy, jz = iz+dz;
+              if (jx < 0 || jx >= nbin[0] || jy < 0 || jy >= nbin[1] ||
+                  jz < 0 || jz >= nbin[2]) continue;
+              const int tj = binthread[(jz*nbin[1] + jy)*nbin[0] + jx];
+              if (tj >= 0 && tj != t) shared = true;
+            }
+        if (shared) nboundary += binatoms[ibin];
+      }
+
+  fboundary = nlocal ? static_cast<double>(nboundary)/nlocal : 0.0;
+}
@@ -0,0 +1,90 @@
+/* ----------------------------------------------------------------------
+   LIGGGHTS - LAMMPS Improved for General Granular and Granular Heat
+   Transfer Simulations
+
+   LIGGGHTS is part of the CFDEMproject
+   www.liggghts.com | www.cfdem.com
+
+   Christoph Kloss, christoph.kloss@cfdem.com
+   Copyright 2009-2012 JKU Linz
+   Copyright 2012-     DCS Computing GmbH, Linz
+
+   LIGGGHTS is based on LAMMPS
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   This software is distributed under the GNU General Public License.
+
+   See the README file in the top-level directory.
+------------------------------------------------------------------------- */
+
+#ifdef PARTITIONER_CLASS
+
+PartitionerStyle(sfc,SFCPartitioner)
+
+#else
+
+#ifndef LMP_PARTITIONER_SFC_H
+#define LMP_PARTITIONER_SFC_H
+
+#include "partitioner.h"
+#include <vector>
+
+namespace LAMMPS_NS {
+
+class SFCPartitioner : public Partitioner {
+ public:
+  SFCPartitioner(class LAMMPS *, int, const char * const *);
+  virtual ~SFCPartitioner() {}
+
+  virtual bool is_cost_effective() const;
+  virtual Result generate_partitions(int * permute, std::vector<int> & thread_offsets);
+
+  double boundary_fraction() const
+  { return fboundary; }
+
+ private:
+  int nevery;                  // max # of steps between full partitionings
+  double imbalance;            // max/avg thread load forcing a full one
+  double boundary;             // max boundary fraction worth partitioning
+  bigint last_partitioning;    // timestep of last full partitioning
+
+  // bins of last full partitioning, amended partitions reuse them
+  // so curve keys stay comparable to the cuts
+
+  double binlo[3],bininv[3];
+  int nbin[3];
+  int bits;
+
+  std::vector<uint32_t> cuts;  // 1st curve key of each thread, nthreads+1
+  double fboundary;            // fraction of atoms in bins next to
+                               // another thread's bins, -1 if not known
+
+  std::vector<uint64_t> keys;  // curve key << 32 | local index
+  std::vector<int> binatoms;   // # of atoms in each bin
+  std::vector<int> binthread;  // owning thread of each bin, -1 if empty
+  std::vector<int> part;       // thread of each local atom
+  std::vector<int> count;      // # of atoms of each thread
+  std::vector<double> load;    // estimated pair work of each thread
+
+  void setup_bins();
+  int coord2bin(const double *, uint32_t &) const;
+  Result full_partition(int *, std::vector<int> &);
+  Result amend_partition(int *, std::vector<int> &);
+  void measure_boundary();
+};
+
+}
+
+#endif
+#endif
+
+/* ERROR/WARNING messages:
+
+E: Illegal partitioner_style sfc command
+
+Self-explanatory.  Check the input script syntax and compare to the
+documentation for the command.
+
+*/
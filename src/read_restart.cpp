@@ -76,6 +76,8 @@ void ReadRestart::command(int narg, char **arg)
   MPI_Comm_rank(world,&me);
   MPI_Comm_size(world,&nprocs);
 
+  double time_start = MPI_Wtime();
+
   // if filename contains "*", search dir for latest restart file
 
   char *file = new char[strlen(arg[0]) + 16];
@@ -95,6 +97,16 @@ void ReadRestart::command(int narg, char **arg)
   if (strchr(file,'%')) multiproc = 1;
   else multiproc = 0;
 
+  // check if filename ends in ".mpiio"
+  // if so, atom chunks are read in parallel via MPI-IO
+
+  int mpiioflag = 0;
+  int nfile = strlen(file);
+  if (nfile > 6 && strcmp(&file[nfile-6],".mpiio") == 0) mpiioflag = 1;
+  if (multiproc && mpiioflag)
+    error->all(FLERR,
+               "Restart file MPI-IO input not allowed with % in filename");
+
   // open single restart file or base file for multiproc case
   // auto-detect whether byte swapping needs to be done as file is read
 
@@ -153,6 +165,8 @@ void ReadRestart::command(int narg, char **arg)
   atom->nextra_store = nextra;
   memory->create(atom->extra,n,nextra,"atom:extra");
 
+  double time_header = MPI_Wtime();
+
   // single file:
   // nprocs_file = # of chunks in file
   // proc 0 reads chunks one at a time and bcasts it to other procs
@@ -166,7 +180,11 @@ void ReadRestart::command(int narg, char **arg)
   double *buf = NULL;
   int m;
 
-  if (multiproc == 0) {
+  if (mpiioflag) {
+    read_mpiio(file);
+    migrate_atoms(nextra);
+
+  } else if (multiproc == 0) {
     int triclinic = domain->triclinic;
     double *x,lamda[3];
     double *coord,*sublo,*subhi;
@@ -247,51 +265,7 @@ void ReadRestart::command(int narg, char **arg)
 
     delete [] perproc;
 
-    // create a temporary fix to hold and migrate extra atom info
-    // necessary b/c irregular will migrate atoms
-
-    if (nextra) {
-      char cextra[8],fixextra[8];
-      sprintf(cextra,"%d",nextra);
-      sprintf(fixextra,"%d",modify->nfix_restart_peratom);
-      char **newarg = new char*[5];
-      newarg[0] = (char *) "_read_restart";
-      newarg[1] = (char *) "all";
-      newarg[2] = (char *) "READ_RESTART";
-      newarg[3] = cextra;
-      newarg[4] = fixextra;
-      modify->add_fix(5,newarg);
-      delete [] newarg;
-    }
-
-    // move atoms to new processors via irregular()
-    // in case read by different proc than wrote restart file
-    // first do map_init() since irregular->migrate_atoms() will do map_clear()
-
-    if (atom->map_style) atom->map_init();
-    if (domain->triclinic) domain->x2lamda(atom->nlocal);
-    Irregular *irregular = new Irregular(lmp);
-    irregular->migrate_atoms();
-    delete irregular;
-    if (domain->triclinic) domain->lamda2x(atom->nlocal);
-
-    // put extra atom info held by fix back into atom->extra
-    // destroy temporary fix
-
-    if (nextra) {
-      memory->destroy(atom->extra);
-      memory->create(atom->extra,atom->nmax,nextra,"atom:extra");
-      int ifix = modify->find_fix("_read_restart");
-      FixReadRestart *fix = (FixReadRestart *) modify->fix[ifix];
-      int *count = fix->count;
-      double **extra = fix->extra;
-      double **atom_extra = atom->extra;
-      int nlocal = atom->nlocal;
-      for (int i = 0; i < nlocal; i++)
-        for (int j = 0; j < count[i]; j++)
-          atom_extra[i][j] = extra[i][j];
-      modify->delete_fix("_read_restart");
-    }
+    migrate_atoms(nextra);
   }
 
   // clean-up memory
@@ -313,6 +287,13 @@ void ReadRestart::command(int narg, char **arg)
   if (natoms != atom->natoms)
     error->all(FLERR,"Did not assign all atoms correctly");
 
+  // restart time breakdown, header = everything before the atom data
+
+  double time_end = MPI_Wtime();
+  if (me == 0 && logfile)
+    fprintf(logfile,"  restart time = %g secs (header %g, atoms %g)\n",
+            time_end-time_start,time_header-time_start,time_end-time_header);
+
   if (me == 0) {
     if (atom->nbonds) {
       if (screen) fprintf(screen,"  " BIGINT_FORMAT " bonds\n",atom->nbonds);
@@ -358,6 +339,148 @@ void ReadRestart::command(int narg, char **arg)
   }
 }
 
+/* ----------------------------------------------------------------------
+   read atom chunks of a file written by WriteRestart::write_mpiio()
+   proc 0 reads the chunk index that follows the header
+   each proc reads a contiguous range of chunks in one collective call,
+     ranges are balanced by size, so any # of procs can read the file
+   all atoms read are unpacked, they are migrated to their owners later
+------------------------------------------------------------------------- */
+
+void ReadRestart::read_mpiio(char *file)
+{
+  int nchunks;
+  if (me == 0) nread_int(&nchunks,1,fp);
+  MPI_Bcast(&nchunks,1,MPI_INT,0,world);
+  if (nchunks != nprocs_file)
+    error->all(FLERR,"Invalid chunk index in MPI-IO restart file");
+
+  int *sizes;
+  memory->create(sizes,nchunks,"read_restart:sizes");
+
+  bigint headeroffset;
+  if (me == 0) {
+    nread_int(sizes,nchunks,fp);
+    headeroffset = ftell(fp);
+    fclose(fp);
+  }
+  MPI_Bcast(sizes,nchunks,MPI_INT,0,world);
+  MPI_Bcast(&headeroffset,1,MPI_LMP_BIGINT,0,world);
+
+  // chunk goes to the proc that holds the middle of the chunk
+  // if all data were split evenly across procs
+
+  bigint total = 0;
+  for (int i = 0; i < nchunks; i++) total += sizes[i];
+
+  bigint start = 0;
+  bigint mystart = 0;
+  int n = 0;
+  int first = 1;
+  for (int i = 0; i < nchunks; i++) {
+    int iproc = 0;
+    if (total > 0)
+      iproc = static_cast<int> ((start + sizes[i]/2) * nprocs / total);
+    if (iproc == me) {
+      if (first) mystart = start;
+      first = 0;
+      n += sizes[i];
+    }
+    start += sizes[i];
+  }
+
+  memory->destroy(sizes);
+
+  double *buf;
+  memory->create(buf,MAX(n,1),"read_restart:buf");
+
+  MPI_File fh;
+  MPI_Status status;
+  int err = MPI_File_open(world,file,MPI_MODE_RDONLY,MPI_INFO_NULL,&fh);
+  mpiio_check(err,file);
+
+  MPI_Offset offset = headeroffset + mystart*sizeof(double);
+  err = MPI_File_read_at_all(fh,offset,buf,n,MPI_DOUBLE,&status);
+  MPI_File_close(&fh);
+  mpiio_check(err,file);
+
+  AtomVec *avec = atom->avec;
+  int m = 0;
+  while (m < n) m += avec->unpack_restart(&buf[m]);
+
+  memory->destroy(buf);
+}
+
+/* ----------------------------------------------------------------------
+   error if an MPI-IO call failed on any proc
+------------------------------------------------------------------------- */
+
+void ReadRestart::mpiio_check(int err, char *file)
+{
+  int flag = (err == MPI_SUCCESS) ? 0 : 1;
+  int flag_all;
+  MPI_Allreduce(&flag,&flag_all,1,MPI_INT,MPI_MAX,world);
+  if (flag_all) {
+    char str[128];
+    sprintf(str,"Cannot read restart file %s via MPI-IO",file);
+    error->all(FLERR,str);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   atoms were read by a different proc than the one that owns them
+   move them to the correct procs via irregular comm
+------------------------------------------------------------------------- */
+
+void ReadRestart::migrate_atoms(int nextra)
+{
+  // create a temporary fix to hold and migrate extra atom info
+  // necessary b/c irregular will migrate atoms
+
+  if (nextra) {
+    char cextra[8],fixextra[8];
+    sprintf(cextra,"%d",nextra);
+    sprintf(fixextra,"%d",modify->nfix_restart_peratom);
+    char **newarg = new char*[5];
+    newarg[0] = (char *) "_read_restart";
+    newarg[1] = (char *) "all";
+    newarg[2] = (char *) "READ_RESTART";
+    newarg[3] = cextra;
+    newarg[4] = fixextra;
+    modify->add_fix(5,newarg);
+    delete [] newarg;
+  }
+
+  // move atoms to new processors via irregular()
+  // in case read by different proc than wrote restart file
+  // first do map_init() since irregular->migrate_atoms() will do map_clear()
+
+  if (atom->map_style) atom->map_init();
+  if (domain->triclinic) domain->x2lamda(atom->nlocal);
+  Irregular *irregular = new Irregular(lmp);
+  irregular->migrate_atoms();
+  delete irregular;
+  if (domain->triclinic) domain->lamda2x(atom->nlocal);
+
+  // put extra atom info held by fix back into atom->extra
+  // destroy temporary fix
+
+  if (nextra) {
+    memory->destroy(atom->extra);
+    memory->create(atom->extra,atom->nmax,nextra,"atom:extra");
+    int ifix = modify->find_fix("_read_restart");
+    FixReadRestart *fix = (FixReadRestart *) modify->fix[ifix];
+    int *count = fix->count;
+    double **extra = fix->extra;
+    double **atom_extra = atom->extra;
+    int nlocal = atom->nlocal;
+    for (int i = 0; i < nlocal; i++)
+      for (int j = 0; j < count[i]; j++)
+        atom_extra[i][j] = extra[i][j];
+    modify->delete_fix("_read_restart");
+  }
+}
+
 /* ----------------------------------------------------------------------
    infile contains a "*"
    search for all files which match the infile pattern
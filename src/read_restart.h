@@ -39,6 +39,9 @@ class ReadRestart : protected Pointers {
   void header();
   void type_arrays();
   void force_fields();
+  void read_mpiio(char *);
+  void migrate_atoms(int);
+  void mpiio_check(int, char *);
 
   void nread_int(int *, int, FILE *);
   void nread_double(double *, int, FILE *);
@@ -72,6 +75,19 @@ E: Cannot open restart file %s
 
 Self-explanatory.
 
+E: Restart file MPI-IO input not allowed with % in filename
+
+A file ending in .mpiio is always read as a single file.
+
+E: Invalid chunk index in MPI-IO restart file
+
+The # of chunks in the file does not match the # of processors that
+wrote it.  The file is probably corrupted or not an MPI-IO restart file.
+
+E: Cannot read restart file %s via MPI-IO
+
+The collective read of the per-processor chunks failed.
+
 E: Did not assign all atoms correctly
 
 Atoms read in from a data file were not assigned correctly to
@@ -352,6 +352,7 @@ void Respa::setup()
   modify->setup_pre_neighbor();
   neighbor->build();
   neighbor->ncalls = 0;
+  neighbor->npaircheck = neighbor->npairaccept = 0;
 
   // compute all forces
 
@@ -419,6 +420,7 @@ void Respa::setup_minimal(int flag)
     modify->setup_pre_neighbor();
     neighbor->build();
     neighbor->ncalls = 0;
+    neighbor->npaircheck = neighbor->npairaccept = 0;
   }
 
   // compute all forces
@@ -32,6 +32,8 @@
 #include <set>
 #include <map>
 #include <sstream>
+#include <climits>
+#include <cstdlib>
 
 using namespace LAMMPS_NS;
 
@@ -170,6 +172,54 @@ private:
   ValuePropagator<double> current;
 };
 
+class IntegerSetting : public Setting
+{
+public:
+  typedef int value_type;
+
+  IntegerSetting(std::string name, int default_value) : Setting(name, 1), minimum(INT_MIN)
+  {
+    setDefault(default_value);
+  }
+
+  virtual ~IntegerSetting(){}
+
+  void setDefault(int i){
+    current.setValue(i);
+  }
+
+  void setMinimum(int i){
+    minimum = i;
+  }
+
+  void registerTarget(int & target) {
+    current.registerTarget(target);
+  }
+
+  int parseArguments(char ** args) {
+    if(name != args[0]) return 0;
+    char * end;
+    const long value = strtol(args[1], &end, 10);
+    if(end == args[1] || *end != '\0' || value < minimum || value > INT_MAX) {
+      std::stringstream ss;
+      ss << "while parsing '" << name << "' argument: ";
+      ss << "expected an integer >= " << minimum << ", got '" << args[1] << "'";
+      error_message = ss.str();
+      return -1;
+    }
+    current.setValue(static_cast<int>(value));
+    return 2;
+  }
+
+  void print_value(FILE* out) {
+    fprintf(out, "%d", current.getValue());
+  }
+
+private:
+  ValuePropagator<int> current;
+  int minimum;
+};
+
 class OnOffSetting : public EnumSetting<bool> {
 public:
   OnOffSetting(std::string name, bool default_value) : EnumSetting<bool>(name)
@@ -243,6 +293,12 @@ public:
     registerSetting<DoubleSetting>(name, variable, default_value);
   }
 
+  IntegerSetting* registerIntegerSetting(std::string name, int & variable, int default_value = 0)
+  {
+    registerSetting<IntegerSetting>(name, variable, default_value);
+    return dynamic_cast<IntegerSetting*>(settings[name]);
+  }
+
   NamedIntegerSetting* registerNamedIntegerSetting(std::string name, int & variable, int default_value = 0)
   {
     registerSetting<NamedIntegerSetting>(name, variable, default_value);
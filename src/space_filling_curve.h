@@ -0,0 +1,108 @@
+/* ----------------------------------------------------------------------
+   LIGGGHTS - LAMMPS Improved for General Granular and Granular Heat
+   Transfer Simulations
+
+   LIGGGHTS is part of the CFDEMproject
+   www.liggghts.com | www.cfdem.com
+
+   Christoph Kloss, christoph.kloss@cfdem.com
+   Copyright 2009-2012 JKU Linz
+   Copyright 2012-     DCS Computing GmbH, Linz
+
+   LIGGGHTS is based on LAMMPS
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   This software is distributed under the GNU General Public License.
+
+   See the README file in the top-level directory.
+------------------------------------------------------------------------- */
+
+#ifndef LMP_SPACE_FILLING_CURVE_H
+#define LMP_SPACE_FILLING_CURVE_H
+
+#include "lmptype.h"
+
+namespace SpaceFillingCurve {
+
+  // max # of bits per dim, keys of 3 dims fit into 32 bits
+  static const int MAXBITS = 10;
+
+  inline uint32_t morton_key(uint32_t ix, uint32_t iy, uint32_t iz, int bits);
+  inline uint32_t hilbert_key(uint32_t ix, uint32_t iy, uint32_t iz, int bits);
+  inline int bits_for(int nbin);
+
+};
+
+/* ----------------------------------------------------------------------
+   interleave bits of 3 bin indices, x is the fastest dim
+------------------------------------------------------------------------- */
+
+uint32_t SpaceFillingCurve::morton_key(uint32_t ix, uint32_t iy, uint32_t iz, int bits)
+{
+  uint32_t key = 0;
+  for (int b = bits-1; b >= 0; b--)
+    key = (key << 3) | (((iz >> b) & 1) << 2) | (((iy >> b) & 1) << 1) |
+          ((ix >> b) & 1);
+  return key;
+}
+
+/* ----------------------------------------------------------------------
+   position of bin ix,iy,iz along a 3d Hilbert curve through 2^bits bins
+     per dim, consecutive keys are face-adjacent bins
+   J. Skilling, Programming the Hilbert curve, AIP Conf. Proc. 707 (2004)
+------------------------------------------------------------------------- */
+
+uint32_t SpaceFillingCurve::hilbert_key(uint32_t ix, uint32_t iy, uint32_t iz, int bits)
+{
+  if (bits == 0) return 0;
+
+  uint32_t X[3] = {ix,iy,iz};
+  const uint32_t M = 1u << (bits-1);
+  uint32_t P,Q,t;
+
+  // inverse undo of excess work
+
+  for (Q = M; Q > 1; Q >>= 1) {
+    P = Q - 1;
+    for (int i = 0; i < 3; i++) {
+      if (X[i] & Q) X[0] ^= P;
+      else {
+        t = (X[0] ^ X[i]) & P;
+        X[0] ^= t;
+        X[i] ^= t;
+      }
+    }
+  }
+
+  // Gray encode
+
+  X[1] ^= X[0];
+  X[2] ^= X[1];
+  t = 0;
+  for (Q = M; Q > 1; Q >>= 1)
+    if (X[2] & Q) t ^= Q - 1;
+  for (int i = 0; i < 3; i++) X[i] ^= t;
+
+  // transposed form to key, X[0] holds the most significant bit
+
+  uint32_t key = 0;
+  for (int b = bits-1; b >= 0; b--)
+    for (int i = 0; i < 3; i++)
+      key = (key << 1) | ((X[i] >> b) & 1);
+  return key;
+}
+
+/* ----------------------------------------------------------------------
+   # of bits needed to index nbin bins
+------------------------------------------------------------------------- */
+
+int SpaceFillingCurve::bits_for(int nbin)
+{
+  int bits = 0;
+  while ((1 << bits) < nbin) bits++;
+  return bits;
+}
+
+#endif
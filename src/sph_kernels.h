@@ -36,6 +36,25 @@ namespace SPH_KERNEL_NS {
   inline double sph_kernel(int id,double s,double h,double hinv);
   inline double sph_kernel_der(int id,double s,double h,double hinv);
   inline double sph_kernel_cut(int id);
+
+  // compile-time variants, KERNEL_ID is one of the registered kernel ids
+  // callers select the instantiation once per pass instead of once per pair
+
+  template<int KERNEL_ID> inline double sph_kernel(double s,double h,double hinv);
+  template<int KERNEL_ID> inline double sph_kernel_der(double s,double h,double hinv);
+  template<int KERNEL_ID> inline double sph_kernel_cut();
+
+  #define SPH_KERNEL_CLASS
+  #define SPHKernel(kernel_id,kernelstyle,SPHKernelCalculation,SPHKernelCalculationDer,SPHKernelCalculationCut) \
+  template<> inline double sph_kernel<kernel_id>(double s,double h,double hinv) \
+  { return SPHKernelCalculation(s,h,hinv); } \
+  template<> inline double sph_kernel_der<kernel_id>(double s,double h,double hinv) \
+  { return SPHKernelCalculationDer(s,h,hinv); } \
+  template<> inline double sph_kernel_cut<kernel_id>() \
+  { return SPHKernelCalculationCut(); }
+  #include "style_sph_kernel.h"
+  #undef SPH_KERNEL_CLASS
+  #undef SPHKernel
 }
 
 /* ---------------------------------------------------------------------- */
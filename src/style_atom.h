@@ -0,0 +1,12 @@
+#include "atom_vec_atomic.h"
+#include "atom_vec_body.h"
+#include "atom_vec_bond_gran.h"
+#include "atom_vec_charge.h"
+#include "atom_vec_ellipsoid.h"
+#include "atom_vec_hybrid.h"
+#include "atom_vec_line.h"
+#include "atom_vec_sph.h"
+#include "atom_vec_sph_var.h"
+#include "atom_vec_sphere.h"
+#include "atom_vec_superquadric.h"
+#include "atom_vec_tri.h"
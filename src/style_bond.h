@@ -0,0 +1,2 @@
+#include "bond_gran.h"
+#include "bond_hybrid.h"
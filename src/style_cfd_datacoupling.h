@@ -0,0 +1,4 @@
+#include "cfd_datacoupling_file.h"
+#include "cfd_datacoupling_mpi.h"
+#include "cfd_datacoupling_mpi_sparse.h"
+#include "cfd_datacoupling_one2one.h"
@@ -0,0 +1,5 @@
+#include "cohesion_model_capillary.h"
+#include "cohesion_model_hamaker.h"
+#include "cohesion_model_morse.h"
+#include "cohesion_model_sjkr.h"
+#include "cohesion_model_sjkr2.h"
@@ -0,0 +1,1680 @@
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_DEFAULT)
+GRAN_MODEL(JKR, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_DEFAULT)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_BREAK, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_BREAK, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_ROUGHNESS)
+GRAN_MODEL(JKR, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_ROUGHNESS)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HERTZ_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_HYSTERESIS, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_INCREMENTAL_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_OFF, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_CAPILLARY, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_HAMAKER, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_MORSE, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_SJKR, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_OFF, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_CDT, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD, SURFACE_SUPERQUADRIC)
+GRAN_MODEL(HOOKE_STIFFNESS_COLLHEAT, TANGENTIAL_NO_HISTORY, COHESION_SJKR2, ROLLING_EPSD2, SURFACE_SUPERQUADRIC)
@@ -0,0 +1,16 @@
+#include "dump_atom.h"
+#include "dump_atom_vtk.h"
+#include "dump_cfg.h"
+#include "dump_custom.h"
+#include "dump_custom_vtk.h"
+#include "dump_custom_vtp.h"
+#include "dump_dcd.h"
+#include "dump_decomposition_vtk.h"
+#include "dump_euler_vtk.h"
+#include "dump_image.h"
+#include "dump_local.h"
+#include "dump_mesh_stl.h"
+#include "dump_mesh_vtk.h"
+#include "dump_mesh_vtu.h"
+#include "dump_movie.h"
+#include "dump_xyz.h"
@@ -0,0 +1,150 @@
+#include "fix_adapt.h"
+#include "fix_addforce.h"
+#include "fix_ave_atom.h"
+#include "fix_ave_correlate.h"
+#include "fix_ave_euler.h"
+#include "fix_ave_histo.h"
+#include "fix_ave_spatial.h"
+#include "fix_ave_time.h"
+#include "fix_aveforce.h"
+#include "fix_balance.h"
+#include "fix_bond_create_gran.h"
+#include "fix_bond_propagate_gran.h"
+#include "fix_box_relax.h"
+#include "fix_break_particle.h"
+#include "fix_buoyancy.h"
+#include "fix_cfd_coupling.h"
+#include "fix_cfd_coupling_chemistry.h"
+#include "fix_cfd_coupling_convection.h"
+#include "fix_cfd_coupling_deform.h"
+#include "fix_cfd_coupling_force.h"
+#include "fix_cfd_coupling_force_implicit.h"
+#include "fix_cfd_coupling_parttempfield.h"
+#include "fix_cfd_coupling_recurrence.h"
+#include "fix_check_timestep_gran.h"
+#include "fix_check_timestep_sph.h"
+#include "fix_chem_shrink.h"
+#include "fix_chem_shrink_Arrhenius.h"
+#include "fix_chem_shrink_core.h"
+#include "fix_chem_shrink_core_single.h"
+#include "fix_contact_history.h"
+#include "fix_contact_history_mesh.h"
+#include "fix_contact_property_atom.h"
+#include "fix_contact_property_atom_wall.h"
+#include "fix_deform.h"
+#include "fix_deposit.h"
+#include "fix_diam_max.h"
+#include "fix_drag.h"
+#include "fix_dt_reset.h"
+#include "fix_enforce2d.h"
+#include "fix_execute.h"
+#include "fix_external.h"
+#include "fix_freeze.h"
+#include "fix_gravity.h"
+#include "fix_group.h"
+#include "fix_heat.h"
+#include "fix_heat_gran_conduction.h"
+#include "fix_heat_gran_radiation.h"
+#include "fix_indent.h"
+#include "fix_insert.h"
+#include "fix_insert_pack.h"
+#include "fix_insert_pack_dense.h"
+#include "fix_insert_rate_region.h"
+#include "fix_insert_stream.h"
+#include "fix_insert_stream_moving.h"
+#include "fix_langevin.h"
+#include "fix_lb_coupling_onetoone.h"
+#include "fix_limit_vel.h"
+#include "fix_lineforce.h"
+#include "fix_massflow_mesh.h"
+#include "fix_mean_free_time.h"
+#include "fix_mesh.h"
+#include "fix_mesh_surface.h"
+#include "fix_mesh_surface_stress.h"
+#include "fix_mesh_surface_stress_6dof.h"
+#include "fix_mesh_surface_stress_contact.h"
+#include "fix_mesh_surface_stress_servo.h"
+#include "fix_minimize.h"
+#include "fix_momentum.h"
+#include "fix_move.h"
+#include "fix_move_mesh.h"
+#include "fix_multisphere.h"
+#include "fix_neighlist_mesh.h"
+#include "fix_nph.h"
+#include "fix_nph_sphere.h"
+#include "fix_npt.h"
+#include "fix_npt_sphere.h"
+#include "fix_nve.h"
+#include "fix_nve_asphere_base.h"
+#include "fix_nve_limit.h"
+#include "fix_nve_noforce.h"
+#include "fix_nve_sph.h"
+#include "fix_nve_sph_limit.h"
+#include "fix_nve_sph_stationary.h"
+#include "fix_nve_sphere.h"
+#include "fix_nve_sphere_limit.h"
+#include "fix_nve_superquadric.h"
+#include "fix_nvt.h"
+#include "fix_nvt_sllod.h"
+#include "fix_nvt_sphere.h"
+#include "fix_particledistribution_discrete.h"
+#include "fix_planeforce.h"
+#include "fix_pour.h"
+#include "fix_press_berendsen.h"
+#include "fix_print.h"
+#include "fix_property_atom.h"
+#include "fix_property_atom_cumulativetracer.h"
+#include "fix_property_atom_lammps.h"
+#include "fix_property_atom_polydispparcel.h"
+#include "fix_property_atom_timetracer.h"
+#include "fix_property_atom_tracer.h"
+#include "fix_property_atom_tracer_stream.h"
+#include "fix_property_global.h"
+#include "fix_read_restart.h"
+#include "fix_recenter.h"
+#include "fix_region_variable.h"
+#include "fix_remove.h"
+#include "fix_respa.h"
+#include "fix_restrain.h"
+#include "fix_rigid.h"
+#include "fix_rigid_nph.h"
+#include "fix_rigid_npt.h"
+#include "fix_rigid_nve.h"
+#include "fix_rigid_nvt.h"
+#include "fix_rigid_small.h"
+#include "fix_roughness.h"
+#include "fix_scalar_transport_equation.h"
+#include "fix_scale_diameter.h"
+#include "fix_setforce.h"
+#include "fix_shake.h"
+#include "fix_shear_history.h"
+#include "fix_speedcontrol.h"
+#include "fix_sph_density_continuity.h"
+#include "fix_sph_density_corr.h"
+#include "fix_sph_density_summation.h"
+#include "fix_sph_pressure.h"
+#include "fix_spring.h"
+#include "fix_spring_rg.h"
+#include "fix_spring_self.h"
+#include "fix_store.h"
+#include "fix_store_force.h"
+#include "fix_store_state.h"
+#include "fix_temp_berendsen.h"
+#include "fix_temp_rescale.h"
+#include "fix_template_fragments.h"
+#include "fix_template_multiplespheres.h"
+#include "fix_template_multisphere.h"
+#include "fix_template_sphere.h"
+#include "fix_template_superquadric.h"
+#include "fix_tmd.h"
+#include "fix_viscous.h"
+#include "fix_wall_gran.h"
+#include "fix_wall_harmonic.h"
+#include "fix_wall_lj1043.h"
+#include "fix_wall_lj126.h"
+#include "fix_wall_lj93.h"
+#include "fix_wall_reflect.h"
+#include "fix_wall_region.h"
+#include "fix_wall_region_sph.h"
+#include "fix_wall_sph.h"
+#include "fix_wall_sph_general_simple.h"
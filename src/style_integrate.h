@@ -0,0 +1,3 @@
+#include "respa.h"
+#include "verlet.h"
+#include "verlet_implicit.h"
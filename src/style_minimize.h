@@ -0,0 +1,5 @@
+#include "min_cg.h"
+#include "min_fire.h"
+#include "min_hftn.h"
+#include "min_quickmin.h"
+#include "min_sd.h"
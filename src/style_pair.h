@@ -0,0 +1,35 @@
+#include "pair_beck.h"
+#include "pair_born.h"
+#include "pair_born_coul_wolf.h"
+#include "pair_buck.h"
+#include "pair_buck_coul_cut.h"
+#include "pair_coul_cut.h"
+#include "pair_coul_debye.h"
+#include "pair_coul_dsf.h"
+#include "pair_coul_wolf.h"
+#include "pair_dpd.h"
+#include "pair_dpd_tstat.h"
+#include "pair_gauss.h"
+#include "pair_gran.h"
+#include "pair_gran_proxy.h"
+#include "pair_hybrid.h"
+#include "pair_hybrid_overlay.h"
+#include "pair_lj96_cut.h"
+#include "pair_lj_cubic.h"
+#include "pair_lj_cut.h"
+#include "pair_lj_cut_coul_cut.h"
+#include "pair_lj_cut_coul_debye.h"
+#include "pair_lj_cut_coul_dsf.h"
+#include "pair_lj_expand.h"
+#include "pair_lj_gromacs.h"
+#include "pair_lj_gromacs_coul_gromacs.h"
+#include "pair_lj_smooth.h"
+#include "pair_lj_smooth_linear.h"
+#include "pair_mie_cut.h"
+#include "pair_morse.h"
+#include "pair_soft.h"
+#include "pair_sph.h"
+#include "pair_sph_artvisc_tenscorr.h"
+#include "pair_table.h"
+#include "pair_yukawa.h"
+#include "pair_zbl.h"
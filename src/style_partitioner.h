@@ -0,0 +1 @@
+#include "partitioner_sfc.h"
@@ -0,0 +1,2 @@
+#include "reader_native.h"
+#include "reader_xyz.h"
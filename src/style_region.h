@@ -0,0 +1,10 @@
+#include "region_block.h"
+#include "region_cone.h"
+#include "region_cylinder.h"
+#include "region_intersect.h"
+#include "region_mesh_tet.h"
+#include "region_plane.h"
+#include "region_prism.h"
+#include "region_sphere.h"
+#include "region_union.h"
+#include "region_wedge.h"
@@ -0,0 +1,3 @@
+#include "rolling_model_cdt.h"
+#include "rolling_model_epsd.h"
+#include "rolling_model_epsd2.h"
@@ -0,0 +1,6 @@
+#include "sph_kernel_cubicspline.h"
+#include "sph_kernel_cubicspline2D.h"
+#include "sph_kernel_spiky.h"
+#include "sph_kernel_spiky2D.h"
+#include "sph_kernel_wendland.h"
+#include "sph_kernel_wendland2D.h"
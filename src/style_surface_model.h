@@ -0,0 +1,3 @@
+#include "surface_model_default.h"
+#include "surface_model_roughness.h"
+#include "surface_model_superquadric.h"
@@ -38,6 +38,10 @@
 #include "mpi_liggghts.h"
 #include "comm.h"
 #include <cmath>
+#include <algorithm>
+#include <vector>
+#include <unordered_map>
+#include <utility>
 #include "math_extra_liggghts.h"
 
 #define EPSILON_CURVATURE 0.00001
@@ -138,6 +142,10 @@ class SurfaceMesh : public TrackingMesh<NUM_NODES>
         void buildNeighbours();
         void parallelCorrection();
 
+        // element pairs (i,j) with i < nCheck and i < j < nall that
+        // share at least one node, sorted, found via node spatial hash
+        void nodeSharingPairs(int nCheck, int nall, std::vector<std::pair<int,int> > &pairs);
+
         // returns true if surfaces share an edge
         // called with local index
         // iEdge, jEdge return indices of first shared edge
@@ -197,6 +205,13 @@ class SurfaceMesh : public TrackingMesh<NUM_NODES>
 
         int searchElementByAreaAcc(double area,int lo, int hi);
 
+        static inline unsigned long long nodeCellKey(bigint ix, bigint iy, bigint iz)
+        {
+            return (static_cast<unsigned long long>(ix)*73856093ULL) ^
+                   (static_cast<unsigned long long>(iy)*19349663ULL) ^
+                   (static_cast<unsigned long long>(iz)*83492791ULL);
+        }
+
         void growSurface(int iSrf, double by = 1e-13);
 
         // mesh properties
@@ -446,6 +446,8 @@ void SurfaceMesh<NUM_NODES,NUM_NEIGH_MAX>::buildNeighbours()
 {
     /*NL*/ //if (this->screen) fprintf(this->screen,"building neigh topology\n");
 
+    double time_start = MPI_Wtime();
+
     // iterate over all surfaces, over ghosts as well
     //NP this is important for parallel correction!!
     int nall = this->sizeLocal()+this->sizeGhost();
@@ -471,19 +473,24 @@ void SurfaceMesh<NUM_NODES,NUM_NEIGH_MAX>::buildNeighbours()
         hasNonCoplanarSharedNode_.set(i,f);
     }
 
-    // build neigh topology and edge activity, ~n*n/2
-    for(int i = 0; i < nall; i++)
+    // build neigh topology and edge activity, ~n
+    //NP only pairs that share a node can share an edge, so candidates come
+    //NP from the node hash; they are sorted, so pairs are handled in the same
+    //NP order as a full i < j loop would, which keeps neighFaces_ identical
+    std::vector<std::pair<int,int> > pairs;
+    nodeSharingPairs(nall,nall,pairs);
+
+    const int npairs = pairs.size();
+    for(int ipair = 0; ipair < npairs; ipair++)
     {
-      for(int j = i+1; j < nall; j++)
-      {
-        //NP continue of do not share any node so can not share an edge
+        const int i = pairs[ipair].first;
+        const int j = pairs[ipair].second;
         int iEdge(0), jEdge(0);
 
         //NP assumption: 2 surface elements only share 1 edge at maximum
         //NP so for duplicate elements, only 1 edge is handled here!!
         if(shareEdge(i,j,iEdge,jEdge))
           handleSharedEdge(i,iEdge,j,jEdge, areCoplanar(TrackingMesh<NUM_NODES>::id(i),TrackingMesh<NUM_NODES>::id(j)));
-      }
     }
 
     int *idListVisited = new int[nall];
@@ -509,6 +516,98 @@ void SurfaceMesh<NUM_NODES,NUM_NEIGH_MAX>::buildNeighbours()
     //NP this is to avoid false positives for cases where edges and corners are
     //NP not located at the proc where the element is owned
     parallelCorrection();
+
+    double time_elapsed = MPI_Wtime() - time_start;
+    MPI_Max_Scalar(time_elapsed,this->world);
+    if(0 == this->comm->me)
+    {
+        if(this->screen) fprintf(this->screen,"Mesh %s: topology of %d element(s) built in %g seconds\n",
+                                 this->mesh_id_,this->sizeGlobal(),time_elapsed);
+        if(this->logfile) fprintf(this->logfile,"Mesh %s: topology of %d element(s) built in %g seconds\n",
+                                  this->mesh_id_,this->sizeGlobal(),time_elapsed);
+    }
+}
+
+/* ----------------------------------------------------------------------
+   find element pairs that share at least one node
+   nodes are hashed into cells of size 2*precision, so equal nodes
+   (per component within precision) are in the same or adjacent cells
+------------------------------------------------------------------------- */
+
+template<int NUM_NODES, int NUM_NEIGH_MAX>
+void SurfaceMesh<NUM_NODES,NUM_NEIGH_MAX>::nodeSharingPairs(int nCheck, int nall,
+                                                         std::vector<std::pair<int,int> > &pairs)
+{
+    pairs.clear();
+    if(nall < 2)
+        return;
+
+    // cell size, large enough to keep cell indices within range
+    double maxcoord = 0.;
+    for(int i = 0; i < nall; i++)
+        for(int iNode = 0; iNode < NUM_NODES; iNode++)
+            for(int dim = 0; dim < 3; dim++)
+                maxcoord = MathExtraLiggghts::max(maxcoord,fabs(this->node_(i)[iNode][dim]));
+    const double cellsize = MathExtraLiggghts::max(2.*this->precision(),1e-15*maxcoord);
+    const double cellinv = 1./cellsize;
+
+    // hash all nodes, linked list per cell as done for atom bins
+    //NP hash collisions only add candidates, they are filtered by nodesAreEqual
+    const int nentry = NUM_NODES*nall;
+    std::vector<bigint> cell(3*nentry);
+    std::vector<int> next(nentry,-1);
+    std::unordered_map<unsigned long long,int> head;
+    head.reserve(nentry);
+
+    for(int e = 0; e < nentry; e++)
+    {
+        double *nd = this->node_(e/NUM_NODES)[e%NUM_NODES];
+        for(int dim = 0; dim < 3; dim++)
+            cell[3*e+dim] = static_cast<bigint>(floor(nd[dim]*cellinv));
+
+        std::pair<std::unordered_map<unsigned long long,int>::iterator,bool> ins =
+            head.insert(std::make_pair(nodeCellKey(cell[3*e],cell[3*e+1],cell[3*e+2]),e));
+        if(!ins.second)
+        {
+            next[e] = ins.first->second;
+            ins.first->second = e;
+        }
+    }
+
+    // loop nodes of elements to check, search own and adjacent cells
+    std::vector<unsigned long long> keys;
+    keys.reserve(27);
+    for(int e = 0; e < NUM_NODES*nCheck; e++)
+    {
+        const int i = e/NUM_NODES;
+        const int iNode = e%NUM_NODES;
+
+        keys.clear();
+        for(int ix = -1; ix <= 1; ix++)
+            for(int iy = -1; iy <= 1; iy++)
+                for(int iz = -1; iz <= 1; iz++)
+                    keys.push_back(nodeCellKey(cell[3*e]+ix,cell[3*e+1]+iy,cell[3*e+2]+iz));
+
+        //NP adjacent cells may hash to the same key, do not visit a list twice
+        std::sort(keys.begin(),keys.end());
+        keys.erase(std::unique(keys.begin(),keys.end()),keys.end());
+
+        for(size_t ik = 0; ik < keys.size(); ik++)
+        {
+            std::unordered_map<unsigned long long,int>::const_iterator it = head.find(keys[ik]);
+            if(it == head.end())
+                continue;
+            for(int f = it->second; f >= 0; f = next[f])
+            {
+                const int j = f/NUM_NODES;
+                if(j > i && this->nodesAreEqual(i,iNode,j,f%NUM_NODES))
+                    pairs.push_back(std::make_pair(i,j));
+            }
+        }
+    }
+
+    std::sort(pairs.begin(),pairs.end());
+    pairs.erase(std::unique(pairs.begin(),pairs.end()),pairs.end());
 }
 
 /* ----------------------------------------------------------------------
@@ -524,25 +623,28 @@ void SurfaceMesh<NUM_NODES,NUM_NEIGH_MAX>::qualityCheck()
     int nall = this->sizeLocal()+this->sizeGhost();
     int me = this->comm->me;
 
-    // check duplicate elements, n^2/2 operation
-    //NP doing here makes it a local n^2/2 operation
+    // check duplicate elements, ~n
+    //NP duplicates share all nodes, so only node sharing pairs are checked
     //NP checking local elements only is ok, since if they are
     //NP duplicate, they must be owned by same proc
-    for(int i = 0; i < nlocal; i++)
+    std::vector<std::pair<int,int> > pairs;
+    nodeSharingPairs(nlocal,nall,pairs);
+
+    const int npairs = pairs.size();
+    for(int ipair = 0; ipair < npairs; ipair++)
     {
-        for(int j = i+1; j < nall; j++)
+        const int i = pairs[ipair].first;
+        const int j = pairs[ipair].second;
+        if(this->nSharedNodes(i,j) == NUM_NODES)
         {
-            if(this->nSharedNodes(i,j) == NUM_NODES)
-            {
-                if(this->screen) fprintf(this->screen,"ERROR: Mesh %s: elements %d and %d (lines %d and %d) are duplicate\n",
-                        this->mesh_id_,TrackingMesh<NUM_NODES>::id(i),TrackingMesh<NUM_NODES>::id(j),
-                        TrackingMesh<NUM_NODES>::lineNo(i),TrackingMesh<NUM_NODES>::lineNo(j));
-                if(!this->removeDuplicates())
-                    this->error->one(FLERR,"Fix mesh: Bad mesh, cannot continue. You can try re-running with 'heal auto_remove_duplicates'");
-                else
-                    this->error->one(FLERR,"Fix mesh: Bad mesh, cannot continue. The mesh probably reached the precision you defined. "
-                                           "You can try re-running with a lower value for 'precision'");
-            }
+            if(this->screen) fprintf(this->screen,"ERROR: Mesh %s: elements %d and %d (lines %d and %d) are duplicate\n",
+                    this->mesh_id_,TrackingMesh<NUM_NODES>::id(i),TrackingMesh<NUM_NODES>::id(j),
+                    TrackingMesh<NUM_NODES>::lineNo(i),TrackingMesh<NUM_NODES>::lineNo(j));
+            if(!this->removeDuplicates())
+                this->error->one(FLERR,"Fix mesh: Bad mesh, cannot continue. You can try re-running with 'heal auto_remove_duplicates'");
+            else
+                this->error->one(FLERR,"Fix mesh: Bad mesh, cannot continue. The mesh probably reached the precision you defined. "
+                                       "You can try re-running with a lower value for 'precision'");
         }
     }
 
@@ -42,7 +42,8 @@ namespace ContactModels
   class SurfaceModel<SURFACE_DEFAULT> : protected Pointers
   {
   public:
-    static const int MASK = CM_COLLISION;
+    static const int MASK = CM_COLLISION | CM_COLLISION_BATCH;
+    static const int NSTATISTICS = 0;
 
     SurfaceModel(LAMMPS * lmp, IContactHistorySetup*) : Pointers(lmp)
     {
@@ -126,9 +127,60 @@ namespace ContactModels
       cdata.vtr3 = vtr3;
     }
 
+    inline void collision(PairStyles::ContactBatch & batch, CollisionData&)
+    {
+      for (int k = 0; k < batch.n; k++) {
+        const double enx = batch.enx[k];
+        const double eny = batch.eny[k];
+        const double enz = batch.enz[k];
+
+        // relative translational velocity
+        const double vr1 = batch.vrx[k];
+        const double vr2 = batch.vry[k];
+        const double vr3 = batch.vrz[k];
+
+        // normal component
+        const double vn = vr1 * enx + vr2 * eny + vr3 * enz;
+        const double vn1 = vn * enx;
+        const double vn2 = vn * eny;
+        const double vn3 = vn * enz;
+
+        // tangential component
+        const double vt1 = vr1 - vn1;
+        const double vt2 = vr2 - vn2;
+        const double vt3 = vr3 - vn3;
+
+        // relative rotational velocity
+        const double deltan = batch.radsum[k] - batch.r[k];
+        const double dx = batch.delx[k];
+        const double dy = batch.dely[k];
+        const double dz = batch.delz[k];
+        const double rinv = batch.rinv[k];
+        const double cri = batch.radi[k] - 0.5 * deltan;
+        const double crj = batch.radj[k] - 0.5 * deltan;
+        const double wr1 = (cri * batch.omegaix[k] + crj * batch.omegajx[k]) * rinv;
+        const double wr2 = (cri * batch.omegaiy[k] + crj * batch.omegajy[k]) * rinv;
+        const double wr3 = (cri * batch.omegaiz[k] + crj * batch.omegajz[k]) * rinv;
+
+        // relative velocities
+        batch.vtr1[k] = vt1 - (dz * wr2 - dy * wr3);
+        batch.vtr2[k] = vt2 - (dx * wr3 - dz * wr1);
+        batch.vtr3[k] = vt3 - (dy * wr1 - dx * wr2);
+
+        batch.vn[k] = vn;
+        batch.deltan[k] = deltan;
+        batch.cri[k] = cri;
+        batch.crj[k] = crj;
+        batch.wr1[k] = wr1;
+        batch.wr2[k] = wr2;
+        batch.wr3[k] = wr3;
+      }
+    }
+
     inline void noCollision(ContactData&, ForceData&, ForceData&){}
     void beginPass(CollisionData&, ForceData&, ForceData&){}
     void endPass(CollisionData&, ForceData&, ForceData&){}
+    inline void statistics(double*) {}
   };
 }
 }
@@ -44,6 +44,7 @@ namespace ContactModels
   {
   public:
     static const int MASK = CM_COLLISION;
+    static const int NSTATISTICS = 0;
 
     SurfaceModel(LAMMPS * lmp, IContactHistorySetup * hsetup) : Pointers(lmp)
     {
@@ -458,6 +459,7 @@ namespace ContactModels
     inline void noCollision(ContactData&, ForceData&, ForceData&){}
     void beginPass(CollisionData&, ForceData&, ForceData&){}
     void endPass(CollisionData&, ForceData&, ForceData&){}
+    inline void statistics(double*) {}
 
   protected:
     int history_offset;
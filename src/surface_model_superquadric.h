@@ -40,6 +40,7 @@ SURFACE_MODEL(SURFACE_SUPERQUADRIC,superquadric,5)
 #include "contact_models.h"
 #include <cmath>
 #include <algorithm>
+#include <vector>
 #include "atom.h"
 #include "force.h"
 #include "update.h"
@@ -61,11 +62,43 @@ namespace ContactModels
     Superquadric particle_j;
     enum {SURFACES_FAR, SURFACES_CLOSE, SURFACES_INTERSECT};
 
+    // shape data (rotation matrix, koef, ...) of each particle is set up
+    // once per pass on first use; lazily, because ghost orientations of a
+    // split pass are only communicated after the interior part
+
+    std::vector<Superquadric> shapes_;
+    std::vector<double> shapeRadius_;   // volume equivalent radius
+    std::vector<int> shapePass_;
+    int pass_;
+
+    // counters of the current pass, reported by compute pair
+    enum {STAT_CHECKED, STAT_NEWTON_SOLVES, STAT_NEWTON_ITERATIONS,
+          STAT_FALLBACKS, STAT_NOT_CONVERGED, STAT_CONTACTS};
+    double stats_[6];
+
+    inline void setShape(const int i, Superquadric & particle, double & radius)
+    {
+      if(i >= static_cast<int>(shapePass_.size())) {
+        particle.set(atom->x[i], atom->quaternion[i], atom->shape[i], atom->blockiness[i]);
+        radius = cbrt(particle.shape[0]*particle.shape[1]*particle.shape[2]);
+        return;
+      }
+      if(shapePass_[i] != pass_) {
+        shapes_[i].set(atom->x[i], atom->quaternion[i], atom->shape[i], atom->blockiness[i]);
+        shapeRadius_[i] = cbrt(atom->shape[i][0]*atom->shape[i][1]*atom->shape[i][2]);
+        shapePass_[i] = pass_;
+      }
+      particle = shapes_[i];
+      radius = shapeRadius_[i];
+    }
+
   public:
-    static const int MASK = CM_COLLISION;
+    static const int MASK = CM_COLLISION | CM_BEGIN_PASS;
+    static const int NSTATISTICS = 6;
 
     SurfaceModel(LAMMPS * lmp, IContactHistorySetup* hsetup) :
-        Pointers(lmp)
+        Pointers(lmp),
+        pass_(0)
     {
       if(!atom->superquadric_flag)
         error->one(FLERR,"Applying surface model superquadric to a non-superquadric particle!");
@@ -77,6 +110,7 @@ namespace ContactModels
       hsetup->add_history_value("cpz", "0");
       alpha1_offset = hsetup->add_history_value("a1", "0");
       alpha2_offset = hsetup->add_history_value("a2", "0");
+      std::fill(stats_, stats_ + NSTATISTICS, 0.0);
     }
 
     inline void registerSettings(Settings& settings)
@@ -84,6 +118,7 @@ namespace ContactModels
       settings.registerDoubleSetting("curvatureLimitFactor",curvatureLimitFactor, 0.0);
       settings.registerYesNo("meanCurvature", meanCurvature, false);
       settings.registerYesNo("gaussianCurvature", gaussianCurvature, false);
+      settings.registerIntegerSetting("maxNewtonIterations", maxNewtonIterations, 100000)->setMinimum(1);
       if(curvatureLimitFactor < 0.0)
         error->one(FLERR,"Curvature limiter cannot be negative!");
       if(!meanCurvature && !gaussianCurvature)
@@ -94,6 +129,25 @@ namespace ContactModels
 
     inline void connectToProperties(PropertyRegistry&) {}
 
+    inline void beginPass(CollisionData&, ForceData&, ForceData&)
+    {
+      const int nall = atom->nlocal + atom->nghost;
+      if(static_cast<int>(shapePass_.size()) < nall) {
+        shapes_.resize(atom->nmax);
+        shapeRadius_.resize(atom->nmax);
+        shapePass_.resize(atom->nmax, -1);
+      }
+      pass_++;
+      std::fill(stats_, stats_ + NSTATISTICS, 0.0);
+    }
+
+    inline void endPass(CollisionData&, ForceData&, ForceData&) {}
+
+    inline void statistics(double * values)
+    {
+      std::copy(stats_, stats_ + NSTATISTICS, values);
+    }
+
     inline bool checkSurfaceIntersect(CollisionData & cdata)
     {
       cdata.is_non_spherical = true;
@@ -105,8 +159,10 @@ namespace ContactModels
       const int iPart = cdata.i;
       const int jPart = cdata.j;
 
-      particle_i.set(atom->x[iPart], atom->quaternion[iPart], atom->shape[iPart], atom->blockiness[iPart]);
-      particle_j.set(atom->x[jPart], atom->quaternion[jPart], atom->shape[jPart], atom->blockiness[jPart]);
+      double ri, rj;
+      setShape(iPart, particle_i, ri);
+      setShape(jPart, particle_j, rj);
+      stats_[STAT_CHECKED] += 1.0;
 
       unsigned int int_inequality_start = MathExtraLiggghtsNonspherical::round_int(*inequality_start);
 
@@ -119,19 +175,26 @@ namespace ContactModels
       if(obb_intersect) {//OBB intersect particles in possible contact
 
         double fi, fj;
-        const double ri = cbrt(particle_i.shape[0]*particle_i.shape[1]*particle_i.shape[2]);
-        const double rj = cbrt(particle_j.shape[0]*particle_j.shape[1]*particle_j.shape[2]);
         double ratio = ri / (ri + rj);
+        const int max_iters = maxNewtonIterations;
+        int iters = 0;
+        bool fail;
 
-        if(*particles_were_in_contact == SURFACES_FAR)
-          MathExtraLiggghtsNonspherical::calc_contact_point_if_no_previous_point_avaialable(cdata, &particle_i, &particle_j, cdata.contact_point, fi, fj, this->error);
-        else
-          MathExtraLiggghtsNonspherical::calc_contact_point_using_prev_step(cdata, &particle_i, &particle_j, ratio, update->dt, prev_step_point, cdata.contact_point, fi, fj, this->error);
+        if(*particles_were_in_contact == SURFACES_FAR) {
+          fail = MathExtraLiggghtsNonspherical::calc_contact_point_if_no_previous_point_avaialable(cdata, &particle_i, &particle_j, cdata.contact_point, fi, fj, max_iters, &iters, this->error);
+          stats_[STAT_FALLBACKS] += 1.0;
+        } else
+          fail = MathExtraLiggghtsNonspherical::calc_contact_point_using_prev_step(cdata, &particle_i, &particle_j, ratio, update->dt, prev_step_point, cdata.contact_point, fi, fj, max_iters, &iters, this->error);
         vectorCopy3D(cdata.contact_point, prev_step_point); //store contact point in contact history for the next DEM time step
 
+        stats_[STAT_NEWTON_SOLVES] += 1.0;
+        stats_[STAT_NEWTON_ITERATIONS] += iters;
+        if(fail) stats_[STAT_NOT_CONVERGED] += 1.0;
+
         particles_in_contact = std::max(fi, fj) < 0.0;
 
         if(particles_in_contact) {
+          stats_[STAT_CONTACTS] += 1.0;
           double contact_point_i[3], contact_point_j[3];
           vectorSubtract3D(particle_j.gradient, particle_i.gradient, cdata.en);
           vectorNormalize3D(cdata.en); //normalize
@@ -175,13 +238,12 @@ namespace ContactModels
     }
 
     inline void noCollision(ContactData&, ForceData&, ForceData&){}
-    void beginPass(CollisionData&, ForceData&, ForceData&){}
-    void endPass(CollisionData&, ForceData&, ForceData&){}
 
   protected:
      double curvatureLimitFactor;
      bool meanCurvature;
      bool gaussianCurvature;
+     int maxNewtonIterations;
   };
 }
 }
@@ -198,6 +260,7 @@ class SurfaceModel<SURFACE_SUPERQUADRIC> : protected Pointers
 {
 public:
     static const int MASK = CM_COLLISION;
+    static const int NSTATISTICS = 0;
 
     SurfaceModel(LAMMPS * lmp, IContactHistorySetup * hsetup) :
       Pointers(lmp)
@@ -211,6 +274,7 @@ public:
     inline bool checkSurfaceIntersect(CollisionData&) { return false; }
     inline void collision(CollisionData&, ForceData&, ForceData&) {}
     inline void noCollision(ContactData&, ForceData&, ForceData&) {}
+    inline void statistics(double*) {}
   };
 }
 }
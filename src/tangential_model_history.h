@@ -46,7 +46,7 @@ namespace ContactModels
     int history_offset;
 
   public:
-    static const int MASK = CM_CONNECT_TO_PROPERTIES | CM_COLLISION | CM_NO_COLLISION;
+    static const int MASK = CM_CONNECT_TO_PROPERTIES | CM_COLLISION | CM_NO_COLLISION | CM_COLLISION_BATCH;
 
     TangentialModel(LAMMPS * lmp, IContactHistorySetup * hsetup) : Pointers(lmp),
       coeffFrict(NULL)
@@ -187,6 +187,90 @@ namespace ContactModels
       }
     }
 
+    // spherical particle pairs of a ContactBatch, same as collision() above
+    inline void collision(PairStyles::ContactBatch & batch, CollisionData & cdata)
+    {
+      const int n = batch.n;
+      const bool update_shear = cdata.shearupdate && cdata.computeflag;
+      const double dt = update->dt;
+
+      for (int k = 0; k < n; k++) {
+        if(batch.touch[k]) *batch.touch[k] |= TOUCH_TANGENTIAL_MODEL;
+        double * const shear = &batch.contact_history[k][history_offset];
+        const double enx = batch.enx[k];
+        const double eny = batch.eny[k];
+        const double enz = batch.enz[k];
+        double sh0 = shear[0];
+        double sh1 = shear[1];
+        double sh2 = shear[2];
+
+        if (update_shear) {
+          sh0 += batch.vtr1[k] * dt;
+          sh1 += batch.vtr2[k] * dt;
+          sh2 += batch.vtr3[k] * dt;
+
+          // project vector into normal plane and
+          // subtract normal component from shear displacement vector
+          const double rsht = sh0*enx + sh1*eny + sh2*enz;
+          sh0 -= rsht * enx;
+          sh1 -= rsht * eny;
+          sh2 -= rsht * enz;
+        }
+
+        const double shrmag = sqrt(sh0*sh0 + sh1*sh1 + sh2*sh2);
+        const double kt = batch.kt[k];
+        const double xmu = coeffFrict[batch.itype[k]][batch.jtype[k]];
+
+        // tangential forces = shear + tangential velocity damping
+        double Ft1 = -(kt * sh0);
+        double Ft2 = -(kt * sh1);
+        double Ft3 = -(kt * sh2);
+
+        // rescale frictional displacements and forces if needed
+        const double Ft_shear = kt * shrmag;
+        const double Ft_friction = xmu * fabs(batch.Fn[k]);
+
+        // energy loss from sliding or damping
+        if (Ft_shear > Ft_friction) {
+          if (shrmag != 0.0) {
+            const double ratio = Ft_friction / Ft_shear;
+            Ft1 *= ratio;
+            Ft2 *= ratio;
+            Ft3 *= ratio;
+            sh0 = -Ft1/kt;
+            sh1 = -Ft2/kt;
+            sh2 = -Ft3/kt;
+          }
+          else Ft1 = Ft2 = Ft3 = 0.0;
+        }
+        else
+        {
+          const double gammat = batch.gammat[k];
+          Ft1 -= (gammat*batch.vtr1[k]);
+          Ft2 -= (gammat*batch.vtr2[k]);
+          Ft3 -= (gammat*batch.vtr3[k]);
+        }
+
+        shear[0] = sh0;
+        shear[1] = sh1;
+        shear[2] = sh2;
+
+        // forces & torques
+        const double tor1 = eny * Ft3 - enz * Ft2;
+        const double tor2 = enz * Ft1 - enx * Ft3;
+        const double tor3 = enx * Ft2 - eny * Ft1;
+
+        batch.fx[k] += Ft1;
+        batch.fy[k] += Ft2;
+        batch.fz[k] += Ft3;
+        batch.torqueix[k] += -batch.cri[k] * tor1;
+        batch.torqueiy[k] += -batch.cri[k] * tor2;
+        batch.torqueiz[k] += -batch.cri[k] * tor3;
+        batch.torquejx[k] += -batch.crj[k] * tor1;
+        batch.torquejy[k] += -batch.crj[k] * tor2;
+        batch.torquejz[k] += -batch.crj[k] * tor3;
+      }
+    }
 
     inline void noCollision(ContactData & cdata, ForceData&, ForceData&)
     {
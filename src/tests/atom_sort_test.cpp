@@ -0,0 +1,47 @@
+#include "gtest/gtest.h"
+#include <mpi.h>
+#include "atom.h"
+#include "input.h"
+#include "lammps.h"
+
+using namespace LAMMPS_NS;
+
+// upper part of the pack is pushed into the lower part, which is not integrated
+static void run_pushed_pack(LAMMPS & lammps, const char * atom_modify) {
+  lammps.input->file();
+  lammps.input->one(atom_modify);
+  lammps.input->one("pair_style gran model hertz tangential history");
+  lammps.input->one("pair_coeff * *");
+  lammps.input->one("region top block INF INF INF INF 0.06 INF units box");
+  lammps.input->one("group top region top");
+  lammps.input->one("unfix integr");
+  lammps.input->one("fix integr top nve/sphere");
+  lammps.input->one("velocity top set 0. 0. -0.5");
+  lammps.input->one("run 600");
+}
+
+TEST(atom, hilbert_sort_keeps_contact_history) {
+  const char * argv[7] = {"liggghts", "-in", "scripts/in.contactPack", "-screen", "none", "-log", "none"};
+  LAMMPS a(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  LAMMPS b(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  run_pushed_pack(a, "atom_modify sort 0 0.0");
+  run_pushed_pack(b, "atom_modify sort 20 0.0 sortorder hilbert");
+
+  ASSERT_EQ(a.atom->nlocal, b.atom->nlocal);
+  ASSERT_GT(a.atom->nlocal, 0);
+
+  // a freshly sorted list has no atom far from its successor
+  EXPECT_GE(b.atom->sort_scatter(), 0.);
+  EXPECT_LT(b.atom->sort_scatter(), 0.1);
+
+  // tangential history moves with its atoms, otherwise velocities diverge
+  for (int i = 0; i < a.atom->nlocal; i++) {
+    const int j = b.atom->map(a.atom->tag[i]);
+    ASSERT_GE(j, 0);
+    for (int k = 0; k < 3; k++) {
+      EXPECT_NEAR(a.atom->x[i][k], b.atom->x[j][k], 1e-12);
+      EXPECT_NEAR(a.atom->v[i][k], b.atom->v[j][k], 1e-8);
+      EXPECT_NEAR(a.atom->omega[i][k], b.atom->omega[j][k], 1e-4);
+    }
+  }
+}
@@ -0,0 +1,38 @@
+#include "gtest/gtest.h"
+#include <mpi.h>
+#include "comm.h"
+#include "input.h"
+#include "lammps.h"
+
+using namespace LAMMPS_NS;
+
+// particles in the right half of the pack also touch their edge neighbors,
+// so they have 18 instead of 6 contacts
+static void setup_contact_gradient_pack(LAMMPS & lammps, const char * balance) {
+  lammps.input->one("processors * 1 1");
+  lammps.input->file();
+  lammps.input->one("region right block 0.05 INF INF INF INF INF units box");
+  lammps.input->one("set region right diameter 0.0068");
+  lammps.input->one("pair_style gran model hertz tangential history");
+  lammps.input->one("pair_coeff * *");
+  lammps.input->one("run 0");
+  lammps.input->one(balance);
+}
+
+TEST(parallel, balance_weighted_cuts_follow_contacts) {
+  int nprocs;
+  MPI_Comm_size(MPI_COMM_WORLD, &nprocs);
+  if (nprocs < 2) GTEST_SKIP() << "needs more than one proc";
+
+  const char * argv[7] = {"liggghts", "-in", "scripts/in.contactPack", "-screen", "none", "-log", "none"};
+  LAMMPS a(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  LAMMPS b(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  setup_contact_gradient_pack(a, "balance dynamic x 20 1.0");
+  setup_contact_gradient_pack(b, "balance dynamic x 20 1.0 weight counts 0 1 0");
+
+  ASSERT_EQ(nprocs, b.comm->procgrid[0]);
+
+  // all cuts move into the region with the more expensive particles
+  for (int i = 1; i < nprocs; i++)
+    EXPECT_GT(b.comm->xsplit[i], a.comm->xsplit[i] + 0.02) << "cut " << i;
+}
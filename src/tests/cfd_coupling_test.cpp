@@ -0,0 +1,106 @@
+#include "gtest/gtest.h"
+#include <mpi.h>
+#include <stdio.h>
+#include <vector>
+#include "atom.h"
+#include "input.h"
+#include "lammps.h"
+#include "memory.h"
+#include "modify.h"
+#include "fix_property_atom.h"
+#include "library_cfd_coupling.h"
+
+using namespace LAMMPS_NS;
+
+static void setup_coupling(LAMMPS & lammps, const char * datacoupling) {
+  char fix_cfd[128];
+  snprintf(fix_cfd, sizeof(fix_cfd), "fix cfd all couple/cfd couple_every 1 %s", datacoupling);
+
+  lammps.input->file();
+  lammps.input->one("pair_style gran model hertz tangential history");
+  lammps.input->one("pair_coeff * *");
+  lammps.input->one(fix_cfd);
+  lammps.input->one("fix cfd2 all couple/cfd/force");
+  lammps.input->one("run 1");
+}
+
+static double ** dragforce(LAMMPS & lammps) {
+  Fix * fix = lammps.modify->find_fix_property("dragforce", "property/atom", "vector", 3, 0, "test");
+  return static_cast<FixPropertyAtom*>(fix)->array_atom;
+}
+
+// push positions, pull a tag dependent drag force, compare with mpi
+static void expect_same_as_mpi(const double * lo, const double * hi) {
+  const char * argv[7] = {"liggghts", "-in", "scripts/in.contactPack", "-screen", "none", "-log", "none"};
+  LAMMPS dense(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  LAMMPS sparse(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  setup_coupling(dense, "mpi");
+  setup_coupling(sparse, "mpi/sparse");
+  if (lo) sparse_set_boundingbox(&sparse, const_cast<double*>(lo), const_cast<double*>(hi));
+
+  const int ntags = liggghts_get_maxtag(&dense);
+  ASSERT_EQ(ntags, liggghts_get_maxtag(&sparse));
+  ASSERT_GT(ntags, 0);
+
+  double ** x_dense = NULL, ** x_sparse = NULL;
+  allocate_external_double(x_dense, 3, "nparticles", 0.0, &dense);
+  allocate_external_double(x_sparse, 3, "nparticles", 0.0, &sparse);
+  data_liggghts_to_of("x", "vector-atom", &dense, (void*&)x_dense, "double");
+  data_liggghts_to_of("x", "vector-atom", &sparse, (void*&)x_sparse, "double");
+
+  // only particles in the box are routed
+  int * tags = NULL;
+  const int nreceived = sparse_get_tags(&sparse, "atom", tags);
+  std::vector<bool> received(ntags, false);
+  for (int k = 0; k < nreceived; k++)
+    received[tags[k]-1] = true;
+
+  int ninside = 0;
+  for (int t = 0; t < ntags; t++) {
+    const double * xt = x_dense[t];
+    const bool inside = !lo || (xt[0] >= lo[0] && xt[0] <= hi[0] &&
+                                xt[1] >= lo[1] && xt[1] <= hi[1] &&
+                                xt[2] >= lo[2] && xt[2] <= hi[2]);
+    ASSERT_EQ(inside, received[t]);
+    if (inside) ninside++;
+    for (int k = 0; k < 3; k++)
+      EXPECT_DOUBLE_EQ(inside ? xt[k] : 0.0, x_sparse[t][k]);
+  }
+  ASSERT_GT(ninside, 0);
+
+  // the CFD side only writes rows of particles it has got
+  double ** f_dense = NULL, ** f_sparse = NULL;
+  allocate_external_double(f_dense, 3, "nparticles", 0.0, &dense);
+  allocate_external_double(f_sparse, 3, "nparticles", 0.0, &sparse);
+  for (int t = 0; t < ntags; t++) {
+    if (!received[t]) continue;
+    for (int k = 0; k < 3; k++)
+      f_dense[t][k] = f_sparse[t][k] = t + 0.25*k;
+  }
+  data_of_to_liggghts("dragforce", "vector-atom", &dense, f_dense, "double");
+  data_of_to_liggghts("dragforce", "vector-atom", &sparse, f_sparse, "double");
+
+  double ** drag_dense = dragforce(dense);
+  double ** drag_sparse = dragforce(sparse);
+  ASSERT_EQ(dense.atom->nlocal, sparse.atom->nlocal);
+  for (int i = 0; i < dense.atom->nlocal; i++) {
+    ASSERT_EQ(dense.atom->tag[i], sparse.atom->tag[i]);
+    for (int k = 0; k < 3; k++)
+      EXPECT_DOUBLE_EQ(drag_dense[i][k], drag_sparse[i][k]);
+  }
+
+  dense.memory->destroy(x_dense);
+  dense.memory->destroy(f_dense);
+  sparse.memory->destroy(x_sparse);
+  sparse.memory->destroy(f_sparse);
+}
+
+TEST(cfd_coupling, mpi_sparse_whole_domain) {
+  expect_same_as_mpi(NULL, NULL);
+}
+
+TEST(cfd_coupling, mpi_sparse_bounding_box) {
+  const double lo[3] = {0.0, 0.0, 0.0};
+  const double hi[3] = {0.05, 0.1, 0.1};
+  expect_same_as_mpi(lo, hi);
+}
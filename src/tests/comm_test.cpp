@@ -0,0 +1,51 @@
+#include "gtest/gtest.h"
+#include <mpi.h>
+#include "atom.h"
+#include "comm.h"
+#include "input.h"
+#include "lammps.h"
+
+using namespace LAMMPS_NS;
+
+// periodic drifting pack with a wide ghost cutoff, so that exchange,
+// borders and forward comm all see more than 1000 atoms per loop
+static void run_drifting_pack(LAMMPS & lammps, int nthreads) {
+  lammps.comm->nthreads = nthreads;
+  lammps.input->file();
+  lammps.input->one("unfix gravi");
+  lammps.input->one("change_box all boundary p p p");
+  lammps.input->one("communicate single cutoff 0.03 vel yes");
+  lammps.input->one("neigh_modify every 1 delay 0 check no");
+  lammps.input->one("velocity all set 3. 2. 1. units box");
+  lammps.input->one("run 1500");
+}
+
+// owned and ghost atoms of both runs must agree in order, not only as sets
+static void expect_same_atoms(LAMMPS & a, LAMMPS & b) {
+  ASSERT_EQ(a.atom->nlocal, b.atom->nlocal);
+  ASSERT_EQ(a.atom->nghost, b.atom->nghost);
+  const int nall = a.atom->nlocal + a.atom->nghost;
+
+  for (int i = 0; i < nall; i++) {
+    ASSERT_EQ(a.atom->tag[i], b.atom->tag[i]) << (i < a.atom->nlocal ? "owned " : "ghost ") << i;
+    EXPECT_EQ(a.atom->x[i][0], b.atom->x[i][0]);
+    EXPECT_EQ(a.atom->x[i][1], b.atom->x[i][1]);
+    EXPECT_EQ(a.atom->x[i][2], b.atom->x[i][2]);
+    EXPECT_EQ(a.atom->v[i][0], b.atom->v[i][0]);
+  }
+}
+
+TEST(parallel, threaded_comm_matches_serial) {
+#if !defined(_OPENMP)
+  GTEST_SKIP() << "built without USE_OPENMP";
+#endif
+  const char * argv[7] = {"liggghts", "-in", "scripts/in.contactPack", "-screen", "none", "-log", "none"};
+  LAMMPS a(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  LAMMPS b(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  run_drifting_pack(a, 1);
+  run_drifting_pack(b, 4);
+
+  EXPECT_GT(a.atom->nlocal, 1000 / a.comm->nprocs);
+  EXPECT_GT(a.atom->nghost, 1000);
+  expect_same_atoms(a, b);
+}
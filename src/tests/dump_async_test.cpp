@@ -0,0 +1,49 @@
+#include "gtest/gtest.h"
+#include <mpi.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include "dump.h"
+#include "input.h"
+#include "lammps.h"
+#include "output.h"
+
+using namespace LAMMPS_NS;
+
+static std::string read_file(const char * name) {
+  std::ifstream in(name, std::ios::binary);
+  std::stringstream ss;
+  ss << in.rdbuf();
+  return ss.str();
+}
+
+TEST(dump, async_output_matches_synchronous_output) {
+  const char * argv[7] = {"liggghts", "-in", "scripts/in.contactPack", "-screen", "none", "-log", "none"};
+  LAMMPS lammps(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  lammps.input->file();
+  lammps.input->one("pair_style gran model hertz tangential history");
+  lammps.input->one("pair_coeff * *");
+  lammps.input->one("dump sync all custom 10 sync_*.dump id type x y z vx vy vz");
+  lammps.input->one("dump async all custom 10 async_*.dump id type x y z vx vy vz");
+  lammps.input->one("dump_modify async async yes");
+  lammps.input->one("run 50");
+
+  int me;
+  MPI_Comm_rank(MPI_COMM_WORLD, &me);
+  if (me != 0) return;
+
+  // proc 0 writes all snapshots, they are complete once the run has finished
+  Dump * dump = lammps.output->dump[1];
+  EXPECT_EQ(1, dump->async_flag);
+  EXPECT_EQ(6, dump->async_nwrite);
+  EXPECT_GE(dump->async_stall, 0.);
+
+  for (int step = 0; step <= 50; step += 10) {
+    std::ostringstream sync, async;
+    sync << "sync_" << step << ".dump";
+    async << "async_" << step << ".dump";
+    const std::string expected = read_file(sync.str().c_str());
+    EXPECT_FALSE(expected.empty());
+    EXPECT_EQ(expected, read_file(async.str().c_str()));
+  }
+}
@@ -0,0 +1,114 @@
+#include "gtest/gtest.h"
+#include <mpi.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "atom.h"
+#include "fix_mesh_surface.h"
+#include "input.h"
+#include "lammps.h"
+#include "modify.h"
+#include "tri_mesh.h"
+
+using namespace LAMMPS_NS;
+
+static std::string read_file(const char * name) {
+  std::ifstream in(name, std::ios::binary);
+  std::stringstream ss;
+  ss << in.rdbuf();
+  return ss.str();
+}
+
+// integer value of attribute attr in the first tag containing key
+static long attribute(const std::string & xml, const char * key, const char * attr) {
+  const size_t tag = xml.find(key);
+  if (tag == std::string::npos) return -1;
+  const size_t pos = xml.find(std::string(attr) + "=\"", xml.rfind('<', tag));
+  return atol(xml.c_str() + pos + strlen(attr) + 2);
+}
+
+// values of the appended block at offset, after its 8 byte size header
+template<typename T>
+static std::vector<T> appended_block(const std::string & xml, long offset) {
+  const size_t start = xml.find("<AppendedData encoding=\"raw\">");
+  const size_t data = xml.find('_', start) + 1 + offset;
+  uint64_t nbytes;
+  memcpy(&nbytes, xml.data() + data, sizeof(uint64_t));
+  std::vector<T> values(nbytes/sizeof(T));
+  memcpy(values.data(), xml.data() + data + sizeof(uint64_t), nbytes);
+  return values;
+}
+
+TEST(dump, custom_vtp_writes_owned_atoms_to_piece) {
+  const char * argv[7] = {"liggghts", "-in", "scripts/in.contactPack", "-screen", "none", "-log", "none"};
+  LAMMPS lammps(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  lammps.input->file();
+  lammps.input->one("pair_style gran model hertz tangential history");
+  lammps.input->one("pair_coeff * *");
+  lammps.input->one("dump d all custom/vtp 1 vtp_*.pvtp id type x y z vx vy vz radius");
+  lammps.input->one("run 0");
+
+  int me;
+  MPI_Comm_rank(MPI_COMM_WORLD, &me);
+  std::ostringstream piece;
+  piece << "vtp_0_" << me << ".vtp";
+  const std::string vtp = read_file(piece.str().c_str());
+  const int nlocal = lammps.atom->nlocal;
+  ASSERT_EQ(nlocal, attribute(vtp, "<Piece", "NumberOfPoints"));
+
+  // vx vy vz are combined to one vector
+  EXPECT_NE(std::string::npos, vtp.find("Name=\"v\" NumberOfComponents=\"3\""));
+
+  const std::vector<int32_t> id = appended_block<int32_t>(vtp, attribute(vtp, "Name=\"id\"", "offset"));
+  const std::vector<double> x = appended_block<double>(vtp, attribute(vtp, "<Points>", "offset"));
+  ASSERT_EQ(static_cast<size_t>(nlocal), id.size());
+  ASSERT_EQ(static_cast<size_t>(3*nlocal), x.size());
+  for (int i = 0; i < nlocal; i++) {
+    EXPECT_EQ(lammps.atom->tag[i], id[i]);
+    for (int k = 0; k < 3; k++) EXPECT_EQ(lammps.atom->x[i][k], x[3*i+k]);
+  }
+
+  if (me == 0) {
+    const std::string pvtp = read_file("vtp_0.pvtp");
+    EXPECT_NE(std::string::npos, pvtp.find("<Piece Source=\"vtp_0_0.vtp\"/>"));
+  }
+}
+
+TEST(dump, mesh_vtu_writes_owned_triangles_to_piece) {
+  const char * argv[7] = {"liggghts", "-in", "scripts/in.contactPack", "-screen", "none", "-log", "none"};
+  LAMMPS lammps(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  lammps.input->file();
+  lammps.input->one("pair_style gran model hertz tangential history");
+  lammps.input->one("pair_coeff * *");
+  lammps.input->one("fix cad all mesh/surface file scripts/meshes/ground.stl type 1 scale 0.05 move 0.05 0.05 0.01");
+  lammps.input->one("dump d all mesh/vtu 1 vtu_*.pvtu cad");
+  lammps.input->one("run 0");
+
+  int me;
+  MPI_Comm_rank(MPI_COMM_WORLD, &me);
+  std::ostringstream piece;
+  piece << "vtu_0_" << me << ".vtu";
+  const std::string vtu = read_file(piece.str().c_str());
+
+  TriMesh * mesh = static_cast<FixMeshSurface*>(lammps.modify->find_fix_id("cad"))->triMesh();
+  const int ntri = (mesh->isParallel() || me == 0) ? mesh->sizeLocal() : 0;
+  ASSERT_EQ(ntri, attribute(vtu, "<Piece", "NumberOfCells"));
+  ASSERT_EQ(3*ntri, attribute(vtu, "<Piece", "NumberOfPoints"));
+
+  const std::vector<double> x = appended_block<double>(vtu, attribute(vtu, "<Points>", "offset"));
+  const std::vector<int32_t> offsets = appended_block<int32_t>(vtu, attribute(vtu, "Name=\"offsets\"", "offset"));
+  ASSERT_EQ(static_cast<size_t>(9*ntri), x.size());
+  ASSERT_EQ(static_cast<size_t>(ntri), offsets.size());
+  for (int i = 0; i < ntri; i++) {
+    EXPECT_EQ(3*(i+1), offsets[i]);
+    double node[3];
+    for (int j = 0; j < 3; j++) {
+      mesh->node(i, j, node);
+      for (int k = 0; k < 3; k++) EXPECT_EQ(node[k], x[9*i+3*j+k]);
+    }
+  }
+}
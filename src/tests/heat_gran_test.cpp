@@ -0,0 +1,71 @@
+#include "gtest/gtest.h"
+#include <mpi.h>
+#include <stdio.h>
+#include "atom.h"
+#include "input.h"
+#include "lammps.h"
+#include "modify.h"
+#include "fix_property_atom.h"
+
+using namespace LAMMPS_NS;
+
+static void run_heat_pack(LAMMPS & lammps, const char * pair_style, const char * fix_heat) {
+  lammps.input->file();
+  lammps.input->one(pair_style);
+  lammps.input->one("pair_coeff * *");
+  lammps.input->one("fix tc all property/global thermalConductivity peratomtype 100.");
+  lammps.input->one("fix cap all property/global thermalCapacity peratomtype 10.");
+  lammps.input->one(fix_heat);
+  lammps.input->one("run 0");
+  lammps.input->one("region hot block 0.0 0.05 0.0 0.1 0.0 0.1 units box");
+  lammps.input->one("set region hot property/atom Temp 800.");
+  lammps.input->one("run 50");
+}
+
+static double * per_atom(LAMMPS & lammps, const char * name) {
+  Fix * fix = lammps.modify->find_fix_property(name, "property/atom", "scalar", 0, 0, "test");
+  return static_cast<FixPropertyAtom*>(fix)->vector_atom;
+}
+
+static void expect_same_heat(const char * pair_style, const char * contact_area) {
+  const char * argv[7] = {"liggghts", "-in", "scripts/in.contactPack", "-screen", "none", "-log", "none"};
+  char fix_a[256], fix_b[256];
+  snprintf(fix_a, sizeof(fix_a), "fix heat all heat/gran/conduction initial_temperature 300. %s", contact_area);
+  snprintf(fix_b, sizeof(fix_b), "fix heat all heat/gran/conduction initial_temperature 300. %s fused yes", contact_area);
+
+  LAMMPS a(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  LAMMPS b(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  run_heat_pack(a, pair_style, fix_a);
+  run_heat_pack(b, pair_style, fix_b);
+
+  ASSERT_EQ(a.atom->nlocal, b.atom->nlocal);
+  ASSERT_GT(a.atom->nlocal, 0);
+
+  double * temp_a = per_atom(a, "Temp");
+  double * temp_b = per_atom(b, "Temp");
+  double * flux_a = per_atom(a, "heatFlux");
+  double * flux_b = per_atom(b, "heatFlux");
+
+  int nheated = 0;
+  for (int i = 0; i < a.atom->nlocal; i++) {
+    ASSERT_EQ(a.atom->tag[i], b.atom->tag[i]);
+    EXPECT_DOUBLE_EQ(temp_a[i], temp_b[i]);
+    EXPECT_DOUBLE_EQ(flux_a[i], flux_b[i]);
+    if (temp_a[i] > 300. && temp_a[i] < 800.) nheated++;
+  }
+
+  // make sure heat was actually conducted
+  ASSERT_GT(nheated, 0);
+}
+
+TEST(heat_gran, fused_overlap_no_history) {
+  expect_same_heat("pair_style gran model hooke tangential no_history", "contact_area overlap");
+}
+
+TEST(heat_gran, fused_projection_history) {
+  expect_same_heat("pair_style gran model hertz tangential history", "contact_area projection");
+}
+
+TEST(heat_gran, fused_batched) {
+  expect_same_heat("pair_style gran model hertz tangential history batched on", "contact_area overlap");
+}
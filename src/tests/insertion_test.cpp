@@ -1,6 +1,11 @@
 #include "gtest/gtest.h"
 #include <mpi.h>
+#include <math.h>
+#include <stdio.h>
+#include <vector>
 #include "atom.h"
+#include "comm.h"
+#include "domain.h"
 #include "input.h"
 #include "lammps.h"
 
@@ -27,3 +32,87 @@ TEST(insertion, insertPack_150k) {
 
   EXPECT_EQ(150000, lammps.atom->natoms);
 }
+
+// dense packing of 0.1^3 in the middle of the box, which is cut by the
+// subdomain borders if the box is decomposed along x
+static void pack_dense(LAMMPS & lammps, const char * seamless) {
+  char fix_pack[256];
+  snprintf(fix_pack, sizeof(fix_pack), "fix pack all insert/pack/dense seed 100001 distributiontemplate pdd1 region pack volumefraction_region 0.5 seamless %s", seamless);
+  lammps.input->one("processors * 1 1");
+  lammps.input->file();
+  lammps.input->one("region pack block 0.2 0.3 0.2 0.3 0.2 0.3 units box");
+  lammps.input->one(fix_pack);
+  lammps.input->one("run 1");
+}
+
+// positions and radii of all atoms of all procs, ordered by tag
+static void gather_spheres(LAMMPS & lammps, std::vector<double> & spheres) {
+  Atom * atom = lammps.atom;
+  std::vector<double> local(4*atom->natoms, 0.);
+  for (int i = 0; i < atom->nlocal; i++) {
+    const int k = 4*(atom->tag[i]-1);
+    local[k] = atom->x[i][0];
+    local[k+1] = atom->x[i][1];
+    local[k+2] = atom->x[i][2];
+    local[k+3] = atom->radius[i];
+  }
+  spheres.resize(local.size());
+  MPI_Allreduce(&local[0], &spheres[0], local.size(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+}
+
+TEST(insertion, insertPackDense_seamless_same_in_serial) {
+  const char * argv[7] = {"liggghts", "-in", "scripts/in.insertPack", "-screen", "none", "-log", "none"};
+  LAMMPS a(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  LAMMPS b(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+
+  // on more procs, seamless packing is meant to differ
+  if (a.comm->nprocs > 1) GTEST_SKIP() << "needs a single proc";
+
+  pack_dense(a, "no");
+  pack_dense(b, "yes");
+
+  ASSERT_GT(a.atom->natoms, 1000);
+  ASSERT_EQ(a.atom->natoms, b.atom->natoms);
+  ASSERT_EQ(a.atom->nlocal, b.atom->nlocal);
+
+  for (int i = 0; i < a.atom->nlocal; i++) {
+    ASSERT_EQ(a.atom->tag[i], b.atom->tag[i]);
+    EXPECT_EQ(a.atom->radius[i], b.atom->radius[i]);
+    for (int k = 0; k < 3; k++)
+      EXPECT_EQ(a.atom->x[i][k], b.atom->x[i][k]);
+  }
+}
+
+TEST(parallel, insertPackDense_seamless_no_overlap_across_subdomains) {
+  const char * argv[7] = {"liggghts", "-in", "scripts/in.insertPack", "-screen", "none", "-log", "none"};
+  LAMMPS lammps(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  if (lammps.comm->nprocs < 2) GTEST_SKIP() << "needs more than one proc";
+
+  pack_dense(lammps, "yes");
+  ASSERT_GT(lammps.comm->procgrid[0], 1);
+  ASSERT_GT(lammps.atom->natoms, 1000);
+
+  std::vector<double> spheres;
+  gather_spheres(lammps, spheres);
+  const int n = lammps.atom->natoms;
+
+  // the packing continues across the subdomain borders instead of
+  // keeping a layer of one radius clear on both sides
+  const double cut = lammps.comm->xsplit[1]*lammps.domain->xprd + lammps.domain->boxlo[0];
+  int nseam = 0;
+  for (int i = 0; i < n; i++)
+    if (fabs(spheres[4*i] - cut) < spheres[4*i+3]) nseam++;
+  EXPECT_GT(nseam, 0);
+
+  int noverlap = 0;
+  for (int i = 0; i < n; i++) {
+    for (int j = i+1; j < n; j++) {
+      const double dx = spheres[4*i] - spheres[4*j];
+      const double dy = spheres[4*i+1] - spheres[4*j+1];
+      const double dz = spheres[4*i+2] - spheres[4*j+2];
+      const double radsum = (spheres[4*i+3] + spheres[4*j+3])*(1. - 1e-8);
+      if (dx*dx + dy*dy + dz*dz < radsum*radsum) noverlap++;
+    }
+  }
+  EXPECT_EQ(0, noverlap);
+}
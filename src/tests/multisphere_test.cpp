@@ -0,0 +1,176 @@
+#include "gtest/gtest.h"
+#include <mpi.h>
+#include <math.h>
+#include <vector>
+#include "atom.h"
+#include "domain.h"
+#include "fix_multisphere.h"
+#include "fix_property_atom.h"
+#include "input.h"
+#include "lammps.h"
+#include "modify.h"
+#include "multisphere_parallel.h"
+
+using namespace LAMMPS_NS;
+
+static FixMultisphere * setup_clumps(LAMMPS & lammps) {
+  lammps.input->file();
+  return static_cast<FixMultisphere*>(lammps.modify->find_fix_id("integr"));
+}
+
+// per-body data of all procs, indexed by body tag, nrigid is 0 for
+// tags of bodies that do not exist (any more)
+struct Bodies {
+  std::vector<double> xcm, vcm, mass;
+  std::vector<int> nrigid;
+
+  explicit Bodies(FixMultisphere * fix) {
+    Multisphere & ms = fix->data();
+    int tagmax = fix->tag_max_body();
+    MPI_Allreduce(MPI_IN_PLACE, &tagmax, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+
+    xcm.assign(3*(tagmax+1), 0.);
+    vcm.assign(3*(tagmax+1), 0.);
+    mass.assign(tagmax+1, 0.);
+    nrigid.assign(tagmax+1, 0);
+
+    for (int ibody = 0; ibody < fix->n_body(); ibody++) {
+      const int tag = ms.tag(ibody);
+      ms.xcm(&xcm[3*tag], ibody);
+      ms.vcm(&vcm[3*tag], ibody);
+      mass[tag] = ms.mass(ibody);
+      nrigid[tag] = ms.nrigid(ibody);
+    }
+
+    MPI_Allreduce(MPI_IN_PLACE, &xcm[0], xcm.size(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    MPI_Allreduce(MPI_IN_PLACE, &vcm[0], vcm.size(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    MPI_Allreduce(MPI_IN_PLACE, &mass[0], mass.size(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    MPI_Allreduce(MPI_IN_PLACE, &nrigid[0], nrigid.size(), MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+  }
+
+  int nrigid_of(int tag) const {
+    return tag >= 0 && tag < (int) nrigid.size() ? nrigid[tag] : 0;
+  }
+
+  int natoms() const {
+    int n = 0;
+    for (size_t tag = 0; tag < nrigid.size(); tag++)
+      n += nrigid[tag];
+    return n;
+  }
+
+  void momentum(double * p) const {
+    p[0] = p[1] = p[2] = 0.;
+    for (size_t tag = 0; tag < mass.size(); tag++)
+      for (int k = 0; k < 3; k++)
+        p[k] += mass[tag]*vcm[3*tag+k];
+  }
+
+  double energy() const {
+    double ke = 0.;
+    for (size_t tag = 0; tag < mass.size(); tag++)
+      ke += 0.5*mass[tag]*(vcm[3*tag]*vcm[3*tag] + vcm[3*tag+1]*vcm[3*tag+1] + vcm[3*tag+2]*vcm[3*tag+2]);
+    return ke;
+  }
+};
+
+static int count_atoms(LAMMPS & lammps) {
+  int n = lammps.atom->nlocal;
+  MPI_Allreduce(MPI_IN_PLACE, &n, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+  return n;
+}
+
+// owned and ghost atoms move with their body, wherever it is owned:
+// v = vcm + omega x (x - xcm), x - xcm taken as the minimum image
+static void expect_atoms_follow_bodies(LAMMPS & lammps, FixMultisphere * fix, const Bodies & bodies) {
+  double **x = lammps.atom->x;
+  double **v = lammps.atom->v;
+  double **omega = lammps.atom->omega;
+  const int nall = lammps.atom->nlocal + lammps.atom->nghost;
+
+  for (int i = 0; i < nall; i++) {
+    const int body = fix->belongs_to(i);
+    ASSERT_GE(body, 0) << "atom " << lammps.atom->tag[i];
+    ASSERT_EQ(3, bodies.nrigid_of(body)) << "atom " << lammps.atom->tag[i];
+
+    double r[3];
+    for (int k = 0; k < 3; k++)
+      r[k] = x[i][k] - bodies.xcm[3*body+k];
+    lammps.domain->minimum_image(r);
+    EXPECT_LT(sqrt(r[0]*r[0] + r[1]*r[1] + r[2]*r[2]), 0.006);
+
+    const double * vcm = &bodies.vcm[3*body];
+    EXPECT_NEAR(vcm[0] + omega[i][1]*r[2] - omega[i][2]*r[1], v[i][0], 1e-9);
+    EXPECT_NEAR(vcm[1] + omega[i][2]*r[0] - omega[i][0]*r[2], v[i][1], 1e-9);
+    EXPECT_NEAR(vcm[2] + omega[i][0]*r[1] - omega[i][1]*r[0], v[i][2], 1e-9);
+  }
+}
+
+// body and image travel in one forward exchange on re-neighboring steps,
+// deletion and existence flags in one reverse exchange, force and torque
+// of atoms whose body is owned elsewhere are sent with their flag only
+TEST(parallel, multisphere_fused_comm_keeps_bodies_consistent) {
+  const char * argv[7] = {"liggghts", "-in", "scripts/in.multispherePack", "-screen", "none", "-log", "none"};
+  LAMMPS lammps(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  FixMultisphere * fix = setup_clumps(lammps);
+  ASSERT_TRUE(fix != NULL);
+
+  lammps.input->one("run 1");
+  const Bodies before(fix);
+  ASSERT_EQ(900, count_atoms(lammps));
+  ASSERT_EQ(900, before.natoms());
+
+  lammps.input->one("run 3000");
+  const Bodies after(fix);
+
+  // no atom or body went missing
+  EXPECT_EQ(900, count_atoms(lammps));
+  EXPECT_EQ(900, after.natoms());
+  expect_atoms_follow_bodies(lammps, fix, after);
+
+  // contacts took energy out, but momentum is only conserved if the
+  // forces of all atoms ended up on their body
+  EXPECT_LT(after.energy(), 0.9*before.energy());
+
+  double p0[3], p1[3];
+  before.momentum(p0);
+  after.momentum(p1);
+  double pscale = 0.;
+  for (size_t tag = 0; tag < before.mass.size(); tag++)
+    pscale += before.mass[tag]*fabs(before.vcm[3*tag]);
+  for (int k = 0; k < 3; k++)
+    EXPECT_NEAR(p0[k], p1[k], 1e-8*pscale) << "component " << k;
+}
+
+// atoms lost through a fixed border take their whole body with them, the
+// remaining atoms of the body are flagged and deleted at the next exchange
+TEST(parallel, multisphere_lost_atoms_delete_whole_bodies) {
+  const char * argv[7] = {"liggghts", "-in", "scripts/in.multispherePack", "-screen", "none", "-log", "none"};
+  LAMMPS lammps(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  FixMultisphere * fix = setup_clumps(lammps);
+  ASSERT_TRUE(fix != NULL);
+
+  lammps.input->one("change_box all boundary p p f");
+  lammps.input->one("fix gravi all gravity 100. vector 0.0 0.0 -1.0");
+  lammps.input->one("run 2000");
+
+  const Bodies bodies(fix);
+  const double * delflag = fix->fix_delflag()->vector_atom;
+  const int nlocal = lammps.atom->nlocal;
+
+  int nkept = 0;
+  for (int i = 0; i < nlocal; i++) {
+    const int body = fix->belongs_to(i);
+    if (round(delflag[i]) == 1.) {
+      EXPECT_EQ(0, bodies.nrigid_of(body)) << "atom " << lammps.atom->tag[i] << " of a live body flagged";
+    } else {
+      EXPECT_EQ(3, bodies.nrigid_of(body)) << "atom " << lammps.atom->tag[i] << " of a deleted body kept";
+      nkept++;
+    }
+  }
+  MPI_Allreduce(MPI_IN_PLACE, &nkept, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+
+  EXPECT_LT(bodies.natoms(), 900);
+  EXPECT_GT(bodies.natoms(), 0);
+  EXPECT_EQ(bodies.natoms(), nkept);
+}
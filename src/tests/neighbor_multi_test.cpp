@@ -0,0 +1,67 @@
+#include "gtest/gtest.h"
+#include <mpi.h>
+#include <set>
+#include <utility>
+#include "atom.h"
+#include "force.h"
+#include "input.h"
+#include "lammps.h"
+#include "neigh_list.h"
+#include "neighbor.h"
+#include "pair.h"
+
+using namespace LAMMPS_NS;
+
+// three size classes in slabs along z, radius ratio 10:4:1
+static void setup_polydisperse_pack(LAMMPS & lammps, const char * neighbor) {
+  lammps.input->file();
+  lammps.input->one(neighbor);
+  lammps.input->one("region small block INF INF INF INF INF 0.04 units box");
+  lammps.input->one("region medium block INF INF INF INF 0.04 0.06 units box");
+  lammps.input->one("set region small diameter 0.0005");
+  lammps.input->one("set region medium diameter 0.002");
+  lammps.input->one("pair_style gran model hertz tangential history");
+  lammps.input->one("pair_coeff * *");
+  lammps.input->one("run 0");
+}
+
+static std::set<std::pair<int,int> > list_pairs(LAMMPS & lammps) {
+  std::set<std::pair<int,int> > pairs;
+  NeighList * list = lammps.force->pair->list;
+  int * tag = lammps.atom->tag;
+
+  for (int ii = 0; ii < list->inum; ii++) {
+    const int i = list->ilist[ii];
+    for (int jj = 0; jj < list->numneigh[i]; jj++) {
+      const int j = list->firstneigh[i][jj] & NEIGHMASK;
+      pairs.insert(std::make_pair(std::min(tag[i], tag[j]), std::max(tag[i], tag[j])));
+    }
+  }
+  return pairs;
+}
+
+TEST(neighbor, multi_level_grid_matches_single_level) {
+  const char * argv[7] = {"liggghts", "-in", "scripts/in.contactPack", "-screen", "none", "-log", "none"};
+  LAMMPS a(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  LAMMPS b(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  setup_polydisperse_pack(a, "neighbor 0.002 bin");
+  setup_polydisperse_pack(b, "neighbor 0.002 multi");
+
+  EXPECT_EQ(0, a.neighbor->multi_levels());
+  EXPECT_GE(b.neighbor->multi_levels(), 3);
+
+  const std::set<std::pair<int,int> > pairs_a = list_pairs(a);
+  const std::set<std::pair<int,int> > pairs_b = list_pairs(b);
+
+  ASSERT_GT(pairs_a.size(), 0u);
+  EXPECT_EQ(pairs_a.size(), pairs_b.size());
+  EXPECT_TRUE(pairs_a == pairs_b);
+
+  // the fine levels do not scan the bins of the largest particles,
+  // the counters are reset after the build during setup
+  a.neighbor->build();
+  b.neighbor->build();
+  ASSERT_GT(a.neighbor->npaircheck, 0);
+  EXPECT_LT(b.neighbor->npaircheck, a.neighbor->npaircheck);
+  EXPECT_TRUE(list_pairs(a) == list_pairs(b));
+}
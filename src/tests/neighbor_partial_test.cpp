@@ -0,0 +1,49 @@
+#include "gtest/gtest.h"
+#include <mpi.h>
+#include "atom.h"
+#include "input.h"
+#include "lammps.h"
+#include "neighbor.h"
+
+using namespace LAMMPS_NS;
+
+// upper part of the pack is pushed into the lower part, which is not integrated
+static void run_pushed_pack(LAMMPS & lammps, const char * neigh_modify) {
+  lammps.input->file();
+  lammps.input->one(neigh_modify);
+  lammps.input->one("pair_style gran model hertz tangential history");
+  lammps.input->one("pair_coeff * *");
+  lammps.input->one("region top block INF INF INF INF 0.06 INF units box");
+  lammps.input->one("group top region top");
+  lammps.input->one("unfix integr");
+  lammps.input->one("fix integr top nve/sphere");
+  lammps.input->one("velocity top set 0. 0. -0.5");
+  lammps.input->one("run 600");
+}
+
+TEST(neighbor, partial_rebuild_matches_full_rebuild) {
+  const char * argv[7] = {"liggghts", "-in", "scripts/in.contactPack", "-screen", "none", "-log", "none"};
+  LAMMPS a(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  LAMMPS b(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  run_pushed_pack(a, "neigh_modify partial no");
+  run_pushed_pack(b, "neigh_modify partial yes");
+
+  ASSERT_EQ(a.atom->nlocal, b.atom->nlocal);
+  ASSERT_GT(a.atom->nlocal, 0);
+
+  // lists were partially rebuilt, most entries are reused
+  EXPECT_GT(b.neighbor->ncalls, 2);
+  EXPECT_GT(b.neighbor->npartialbuild, 0);
+  EXPECT_GT(b.neighbor->npartialreuse, b.neighbor->npartialbuild);
+
+  // pairs are stored in a different order, so results only agree to roundoff
+  for (int i = 0; i < a.atom->nlocal; i++) {
+    const int j = b.atom->map(a.atom->tag[i]);
+    ASSERT_GE(j, 0);
+    for (int k = 0; k < 3; k++) {
+      EXPECT_NEAR(a.atom->x[i][k], b.atom->x[j][k], 1e-12);
+      EXPECT_NEAR(a.atom->v[i][k], b.atom->v[j][k], 1e-8);
+      EXPECT_NEAR(a.atom->omega[i][k], b.atom->omega[j][k], 1e-4);
+    }
+  }
+}
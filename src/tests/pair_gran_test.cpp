@@ -0,0 +1,81 @@
+#include "gtest/gtest.h"
+#include <mpi.h>
+#include "atom.h"
+#include "input.h"
+#include "lammps.h"
+
+using namespace LAMMPS_NS;
+
+static void run_contact_pack(LAMMPS & lammps, const char * pair_style) {
+  lammps.input->file();
+  lammps.input->one(pair_style);
+  lammps.input->one("pair_coeff * *");
+  lammps.input->one("run 50");
+}
+
+static void expect_same_forces(const char * pair_style_a, const char * pair_style_b) {
+  const char * argv[7] = {"liggghts", "-in", "scripts/in.contactPack", "-screen", "none", "-log", "none"};
+  LAMMPS a(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  LAMMPS b(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  run_contact_pack(a, pair_style_a);
+  run_contact_pack(b, pair_style_b);
+
+  ASSERT_EQ(a.atom->nlocal, b.atom->nlocal);
+  ASSERT_GT(a.atom->nlocal, 0);
+
+  for (int i = 0; i < a.atom->nlocal; i++) {
+    ASSERT_EQ(a.atom->tag[i], b.atom->tag[i]);
+    for (int k = 0; k < 3; k++) {
+      EXPECT_DOUBLE_EQ(a.atom->x[i][k], b.atom->x[i][k]);
+      EXPECT_DOUBLE_EQ(a.atom->f[i][k], b.atom->f[i][k]);
+      EXPECT_DOUBLE_EQ(a.atom->torque[i][k], b.atom->torque[i][k]);
+    }
+  }
+}
+
+TEST(pair_gran, batched_hooke_no_history) {
+  expect_same_forces("pair_style gran model hooke tangential no_history",
+                     "pair_style gran model hooke tangential no_history batched on");
+}
+
+TEST(pair_gran, batched_hertz_history) {
+  expect_same_forces("pair_style gran model hertz tangential history",
+                     "pair_style gran model hertz tangential history batched on");
+}
+
+TEST(pair_gran, batched_hooke_history) {
+  expect_same_forces("pair_style gran model hooke tangential history",
+                     "pair_style gran model hooke tangential history batched on");
+}
+
+// pack made periodic in x at lattice spacing, so atoms at the x faces
+// have ghost neighbors and go to the border part of the split pass
+static void run_periodic_pack(LAMMPS & lammps, const char * communicate) {
+  lammps.input->file();
+  lammps.input->one("change_box all x final 0.02115 0.08225 boundary p m m units box");
+  lammps.input->one(communicate);
+  lammps.input->one("pair_style gran model hertz tangential history batched on");
+  lammps.input->one("pair_coeff * *");
+  lammps.input->one("run 200");
+}
+
+TEST(pair_gran, comm_overlap_matches_blocking) {
+  const char * argv[7] = {"liggghts", "-in", "scripts/in.contactPack", "-screen", "none", "-log", "none"};
+  LAMMPS a(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  LAMMPS b(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  run_periodic_pack(a, "communicate single vel yes overlap no");
+  run_periodic_pack(b, "communicate single vel yes overlap yes");
+
+  ASSERT_EQ(a.atom->nlocal, b.atom->nlocal);
+  ASSERT_GT(a.atom->nghost, 0);
+
+  // forces are summed in a different order, so results agree to roundoff
+  for (int i = 0; i < a.atom->nlocal; i++) {
+    const int j = b.atom->map(a.atom->tag[i]);
+    ASSERT_GE(j, 0);
+    for (int k = 0; k < 3; k++) {
+      EXPECT_NEAR(a.atom->x[i][k], b.atom->x[j][k], 1e-12);
+      EXPECT_NEAR(a.atom->v[i][k], b.atom->v[j][k], 1e-8);
+    }
+  }
+}
@@ -0,0 +1,73 @@
+#include "gtest/gtest.h"
+#include <mpi.h>
+#include <algorithm>
+#include <vector>
+#include "atom.h"
+#include "comm.h"
+#include "force.h"
+#include "input.h"
+#include "lammps.h"
+#include "neigh_list.h"
+#include "pair.h"
+
+using namespace LAMMPS_NS;
+
+// thread ranges are generated for 4 threads, the run itself stays serial
+static void setup_pack(LAMMPS & lammps, const char * partitioner) {
+  lammps.input->file();
+  lammps.comm->nthreads = 4;
+  if (partitioner) lammps.input->one(partitioner);
+  lammps.input->one("pair_style gran model hertz tangential history");
+  lammps.input->one("pair_coeff * *");
+  lammps.input->one("run 0");
+}
+
+static int thread_of(const std::vector<int> & offsets, int i) {
+  return std::upper_bound(offsets.begin(), offsets.end(), i) - offsets.begin() - 1;
+}
+
+// fraction of neighbor pairs of owned atoms whose atoms are in different threads
+static double cross_thread_fraction(LAMMPS & lammps) {
+  const std::vector<int> & offsets = lammps.atom->thread_offsets;
+  NeighList * list = lammps.force->pair->list;
+  const int nlocal = lammps.atom->nlocal;
+  int npair = 0, ncross = 0;
+
+  for (int ii = 0; ii < list->inum; ii++) {
+    const int i = list->ilist[ii];
+    for (int jj = 0; jj < list->numneigh[i]; jj++) {
+      const int j = list->firstneigh[i][jj] & NEIGHMASK;
+      if (j >= nlocal) continue;
+      npair++;
+      if (thread_of(offsets, i) != thread_of(offsets, j)) ncross++;
+    }
+  }
+  return npair ? static_cast<double>(ncross)/npair : 0.;
+}
+
+TEST(partitioner, sfc_gives_balanced_compact_thread_blocks) {
+  const char * argv[7] = {"liggghts", "-in", "scripts/in.contactPack", "-screen", "none", "-log", "none"};
+  LAMMPS sfc(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  LAMMPS plain(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  setup_pack(sfc, "partitioner_style sfc");
+  setup_pack(plain, NULL);
+
+  const std::vector<int> & offsets = sfc.atom->thread_offsets;
+  const int nlocal = sfc.atom->nlocal;
+  ASSERT_EQ(5u, offsets.size());
+  EXPECT_EQ(0, offsets.front());
+  EXPECT_EQ(nlocal, offsets.back());
+
+  // uniform pack, so equal load means equal # of atoms
+  for (int t = 0; t < 4; t++) {
+    const int n = offsets[t+1] - offsets[t];
+    EXPECT_GT(n, 0.75*nlocal/4);
+    EXPECT_LT(n, 1.25*nlocal/4);
+  }
+
+  // Hilbert blocks share less surface than the z slabs of the plain sort
+  const double fsfc = cross_thread_fraction(sfc);
+  const double fplain = cross_thread_fraction(plain);
+  EXPECT_GT(fplain, 0.);
+  EXPECT_LT(fsfc, fplain);
+}
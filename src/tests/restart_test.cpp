@@ -0,0 +1,48 @@
+#include "gtest/gtest.h"
+#include <mpi.h>
+#include <stdio.h>
+#include <vector>
+#include "atom.h"
+#include "input.h"
+#include "lammps.h"
+
+using namespace LAMMPS_NS;
+
+static void read_restart(LAMMPS & lammps, const char * file, std::vector<double> & x) {
+  char cmd[128];
+  snprintf(cmd, sizeof(cmd), "read_restart %s", file);
+  lammps.input->one(cmd);
+
+  Atom * atom = lammps.atom;
+  x.assign(3*atom->natoms, 0.0);
+  for (int i = 0; i < atom->nlocal; i++)
+    for (int k = 0; k < 3; k++)
+      x[3*(atom->tag[i]-1)+k] = atom->x[i][k];
+  MPI_Allreduce(MPI_IN_PLACE, &x[0], x.size(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+}
+
+TEST(restart, mpiio_same_as_single_file) {
+  const char * argv[7] = {"liggghts", "-in", "scripts/in.contactPack", "-screen", "none", "-log", "none"};
+  LAMMPS lammps(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  lammps.input->file();
+  lammps.input->one("pair_style gran model hertz tangential history");
+  lammps.input->one("pair_coeff * *");
+  lammps.input->one("run 10");
+  lammps.input->one("write_restart restart_test.single");
+  lammps.input->one("write_restart restart_test.mpiio");
+
+  const char * argv_empty[5] = {"liggghts", "-screen", "none", "-log", "none"};
+  LAMMPS single(5, const_cast<char**>(argv_empty), MPI_COMM_WORLD);
+  LAMMPS mpiio(5, const_cast<char**>(argv_empty), MPI_COMM_WORLD);
+
+  std::vector<double> x_single, x_mpiio;
+  read_restart(single, "restart_test.single", x_single);
+  read_restart(mpiio, "restart_test.mpiio", x_mpiio);
+
+  ASSERT_EQ(lammps.atom->natoms, single.atom->natoms);
+  ASSERT_EQ(lammps.atom->natoms, mpiio.atom->natoms);
+  ASSERT_GT(x_single.size(), 0u);
+
+  for (size_t i = 0; i < x_single.size(); i++)
+    EXPECT_DOUBLE_EQ(x_single[i], x_mpiio[i]);
+}
@@ -0,0 +1,59 @@
+#include "gtest/gtest.h"
+#include <mpi.h>
+#include <math.h>
+#include <stdio.h>
+#include <algorithm>
+#include "atom.h"
+#include "comm.h"
+#include "input.h"
+#include "lammps.h"
+
+using namespace LAMMPS_NS;
+
+static void run_sph_pack(LAMMPS & lammps, const char * fused) {
+  char fix_density[256];
+  snprintf(fix_density, sizeof(fix_density), "fix density all sph/density/summation sphkernel cubicspline fused %s", fused);
+  lammps.input->file();
+  lammps.input->one(fix_density);
+  lammps.input->one("fix pressure all sph/pressure Tait 1000. 1000. 7.");
+  lammps.input->one("fix integr all nve/sph");
+  lammps.input->one("run 200");
+}
+
+TEST(sph, fused_density_summation_matches_separate_pass) {
+  const char * argv[7] = {"liggghts", "-in", "scripts/in.sphPack", "-screen", "none", "-log", "none"};
+  LAMMPS a(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  LAMMPS b(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+
+  // ghosts get the pressure one step later without the fused pass, results
+  // only agree if there are no ghosts
+  if (a.comm->nprocs > 1) GTEST_SKIP() << "needs a single proc";
+
+  run_sph_pack(a, "no");
+  run_sph_pack(b, "yes");
+
+  Atom * atom_a = a.atom;
+  Atom * atom_b = b.atom;
+  ASSERT_GT(atom_a->nlocal, 0);
+  ASSERT_EQ(atom_a->nlocal, atom_b->nlocal);
+  ASSERT_EQ(0, atom_a->nghost);
+
+  // forces are summed in a different order, velocities only agree up to
+  // round-off of the largest ones
+  double vmax = 0.;
+  for (int i = 0; i < atom_a->nlocal; i++)
+    for (int k = 0; k < 3; k++)
+      vmax = std::max(vmax, fabs(atom_a->v[i][k]));
+  ASSERT_GT(vmax, 0.);
+
+  for (int i = 0; i < atom_a->nlocal; i++) {
+    ASSERT_EQ(atom_a->tag[i], atom_b->tag[i]);
+    EXPECT_GT(atom_a->rho[i], 0.);
+    EXPECT_DOUBLE_EQ(atom_a->rho[i], atom_b->rho[i]);
+    EXPECT_DOUBLE_EQ(atom_a->p[i], atom_b->p[i]);
+    for (int k = 0; k < 3; k++) {
+      EXPECT_NEAR(atom_a->x[i][k], atom_b->x[i][k], 1e-12*0.01);
+      EXPECT_NEAR(atom_a->v[i][k], atom_b->v[i][k], 1e-10*vmax);
+    }
+  }
+}
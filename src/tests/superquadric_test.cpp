@@ -0,0 +1,66 @@
+#include "gtest/gtest.h"
+#include <mpi.h>
+#include <stdio.h>
+#include "atom.h"
+#include "compute.h"
+#include "input.h"
+#include "lammps.h"
+#include "modify.h"
+
+using namespace LAMMPS_NS;
+
+static Compute * run_superquadric_pack(LAMMPS & lammps, const char * batched) {
+  char pair_style[256];
+  snprintf(pair_style, sizeof(pair_style), "pair_style gran model hertz tangential history surface superquadric batched %s", batched);
+  lammps.input->file();
+  lammps.input->one(pair_style);
+  lammps.input->one("pair_coeff * *");
+  lammps.input->one("compute sq all pair gran");
+  lammps.input->one("run 3000");
+
+  Compute * sq = lammps.modify->compute[lammps.modify->find_compute("sq")];
+  sq->compute_vector();
+  return sq;
+}
+
+// counters of the last force pass, see gran_surface_superquadric
+enum { NPAIRS, NSEARCHES, NITERATIONS, NCOLDSTARTS, NUNCONVERGED, NCONTACTS, NCOUNTERS };
+
+TEST(superquadric, batched_pass_matches_pairwise_and_counts_detection) {
+#if !defined(SUPERQUADRIC_ACTIVE_FLAG)
+  GTEST_SKIP() << "built without USE_SUPERQUADRIC";
+#endif
+  const char * argv[7] = {"liggghts", "-in", "scripts/in.superquadricPack", "-screen", "none", "-log", "none"};
+  LAMMPS a(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  LAMMPS b(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  Compute * sq_a = run_superquadric_pack(a, "off");
+  Compute * sq_b = run_superquadric_pack(b, "on");
+
+  ASSERT_EQ(NCOUNTERS, sq_a->size_vector);
+  ASSERT_EQ(NCOUNTERS, sq_b->size_vector);
+  const double * counts = sq_a->vector;
+
+  EXPECT_GT(counts[NPAIRS], 0.);
+  EXPECT_GT(counts[NSEARCHES], 0.);
+  EXPECT_GT(counts[NITERATIONS], 0.);
+  EXPECT_GT(counts[NCONTACTS], 0.);
+  EXPECT_LE(counts[NSEARCHES], counts[NPAIRS]);
+  EXPECT_LE(counts[NCONTACTS], counts[NSEARCHES]);
+  EXPECT_LE(counts[NCOLDSTARTS], counts[NSEARCHES]);
+  EXPECT_LE(counts[NUNCONVERGED], counts[NSEARCHES]);
+  EXPECT_GE(counts[NITERATIONS], counts[NSEARCHES]);
+
+  // same pairs in the same order, so the same counts and trajectories
+  for (int k = 0; k < NCOUNTERS; k++)
+    EXPECT_EQ(sq_a->vector[k], sq_b->vector[k]) << "counter " << k;
+
+  ASSERT_EQ(a.atom->nlocal, b.atom->nlocal);
+  for (int i = 0; i < a.atom->nlocal; i++) {
+    ASSERT_EQ(a.atom->tag[i], b.atom->tag[i]);
+    for (int k = 0; k < 3; k++) {
+      EXPECT_DOUBLE_EQ(a.atom->x[i][k], b.atom->x[i][k]);
+      EXPECT_DOUBLE_EQ(a.atom->v[i][k], b.atom->v[i][k]);
+      EXPECT_DOUBLE_EQ(a.atom->omega[i][k], b.atom->omega[i][k]);
+    }
+  }
+}
@@ -0,0 +1,120 @@
+#include "gtest/gtest.h"
+#include <mpi.h>
+#include <stdio.h>
+#include <set>
+#include "fix_mesh_surface.h"
+#include "input.h"
+#include "lammps.h"
+#include "math_extra_liggghts.h"
+#include "modify.h"
+#include "tri_mesh.h"
+
+using namespace LAMMPS_NS;
+
+// planar grid of 2*n*n triangles, every node written with its own offset of
+// up to 0.4*precision per component, so copies of a node fall into different
+// cells of the node hash but are still equal within the mesh precision
+static void write_jittered_grid(const char * filename, int n, double precision) {
+  FILE * fp = fopen(filename, "w");
+  ASSERT_TRUE(fp != NULL);
+  unsigned int seed = 12345;
+  const double h = 0.08 / n;
+
+  fprintf(fp, "solid grid\n");
+  for (int ix = 0; ix < n; ix++) {
+    for (int iy = 0; iy < n; iy++) {
+      const double x0 = 0.01 + ix*h, y0 = 0.01 + iy*h;
+      const double corners[2][3][2] = {
+        {{x0, y0}, {x0+h, y0}, {x0+h, y0+h}},
+        {{x0, y0}, {x0+h, y0+h}, {x0, y0+h}}
+      };
+      for (int t = 0; t < 2; t++) {
+        fprintf(fp, "facet normal 0 0 1\n  outer loop\n");
+        for (int k = 0; k < 3; k++) {
+          double jitter[3];
+          for (int dim = 0; dim < 3; dim++) {
+            seed = 1103515245u*seed + 12345u;
+            jitter[dim] = 0.8*precision*((seed >> 8) / 16777216. - 0.5);
+          }
+          fprintf(fp, "    vertex %.17g %.17g %.17g\n", corners[t][k][0] + jitter[0],
+                  corners[t][k][1] + jitter[1], 0.05 + jitter[2]);
+        }
+        fprintf(fp, "  endloop\nendfacet\n");
+      }
+    }
+  }
+  fprintf(fp, "endsolid grid\n");
+  fclose(fp);
+}
+
+// compare neighbor topology against an all-pairs search over the nodes
+static void expect_brute_force_neighbors(TriMesh * mesh, double precision) {
+  const int nall = mesh->sizeLocal() + mesh->sizeGhost();
+  int nshared_edges = 0;
+
+  for (int i = 0; i < nall; i++) {
+    std::set<int> expected;
+    for (int j = 0; j < nall; j++) {
+      if (j == i) continue;
+      int nshared = 0;
+      for (int iNode = 0; iNode < 3; iNode++) {
+        double ni[3];
+        mesh->node(i, iNode, ni);
+        for (int jNode = 0; jNode < 3; jNode++) {
+          double nj[3];
+          mesh->node(j, jNode, nj);
+          if (MathExtraLiggghts::compDouble(ni[0], nj[0], precision) &&
+              MathExtraLiggghts::compDouble(ni[1], nj[1], precision) &&
+              MathExtraLiggghts::compDouble(ni[2], nj[2], precision))
+            nshared++;
+        }
+      }
+      if (nshared == 2)
+        expected.insert(mesh->id(j));
+    }
+
+    std::set<int> found;
+    for (int k = 0; k < mesh->nNeighs(i); k++)
+      found.insert(mesh->neighFaces(i, k));
+
+    EXPECT_TRUE(expected == found) << "element " << mesh->id(i);
+    nshared_edges += expected.size();
+  }
+  EXPECT_GT(nshared_edges, 0);
+}
+
+static TriMesh * load_mesh(LAMMPS & lammps, const char * fix_mesh) {
+  lammps.input->file();
+  lammps.input->one("pair_style gran model hertz tangential history");
+  lammps.input->one("pair_coeff * *");
+  lammps.input->one(fix_mesh);
+  lammps.input->one("fix walls all wall/gran model hertz tangential history mesh n_meshes 1 meshes cad");
+  lammps.input->one("run 0");
+  FixMeshSurface * fix = static_cast<FixMeshSurface*>(lammps.modify->find_fix_id("cad"));
+  return fix ? fix->triMesh() : NULL;
+}
+
+TEST(surface_mesh, node_hash_neighbors_of_stl_mesh) {
+  const char * argv[7] = {"liggghts", "-in", "scripts/in.contactPack", "-screen", "none", "-log", "none"};
+  LAMMPS lammps(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  TriMesh * mesh = load_mesh(lammps, "fix cad all mesh/surface file scripts/meshes/cylinder.stl type 1 scale 0.04 move 0.05 0.05 0.02");
+  ASSERT_TRUE(mesh != NULL);
+  expect_brute_force_neighbors(mesh, EPSILON_PRECISION);
+}
+
+TEST(surface_mesh, node_hash_neighbors_within_precision) {
+  write_jittered_grid("jittered_grid.stl", 10, 1e-8);
+  const char * argv[7] = {"liggghts", "-in", "scripts/in.contactPack", "-screen", "none", "-log", "none"};
+  LAMMPS lammps(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  TriMesh * mesh = load_mesh(lammps, "fix cad all mesh/surface file jittered_grid.stl type 1 precision 1e-8");
+  ASSERT_TRUE(mesh != NULL);
+  ASSERT_EQ(200, mesh->sizeLocal());
+
+  // every triangle of the grid has 3 neighbors except along the border
+  int nneighs = 0;
+  for (int i = 0; i < mesh->sizeLocal(); i++)
+    nneighs += mesh->nNeighs(i);
+  EXPECT_EQ(3*200 - 4*10, nneighs);
+
+  expect_brute_force_neighbors(mesh, 1e-8);
+}
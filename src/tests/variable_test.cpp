@@ -0,0 +1,71 @@
+#include "gtest/gtest.h"
+#include <mpi.h>
+#include <math.h>
+#include <vector>
+#include "atom.h"
+#include "group.h"
+#include "input.h"
+#include "lammps.h"
+#include "variable.h"
+
+using namespace LAMMPS_NS;
+
+static void setup_pack(LAMMPS & lammps) {
+  lammps.input->file();
+  lammps.input->one("pair_style gran model hertz tangential history");
+  lammps.input->one("pair_coeff * *");
+}
+
+TEST(variable, compiled_equal_style_follows_step_and_redefinition) {
+  const char * argv[7] = {"liggghts", "-in", "scripts/in.contactPack", "-screen", "none", "-log", "none"};
+  LAMMPS lammps(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  setup_pack(lammps);
+  Variable * variable = lammps.input->variable;
+  lammps.input->one("variable a equal 2*step+1");
+  lammps.input->one("variable b equal v_a*dt+cos(PI*step/4)^2");
+
+  lammps.input->one("run 3");
+  EXPECT_EQ(variable->compute_equal(const_cast<char*>("v_a*dt+cos(PI*step/4)^2")),
+            variable->compute_equal(variable->find("b")));
+  EXPECT_DOUBLE_EQ(7*1e-5 + pow(cos(3*M_PI/4), 2), variable->compute_equal(variable->find("b")));
+
+  // compiled tree reads the thermo keyword again on the next step
+  lammps.input->one("run 2");
+  EXPECT_DOUBLE_EQ(11*1e-5 + pow(cos(5*M_PI/4), 2), variable->compute_equal(variable->find("b")));
+
+  // redefining a variable rebuilds the trees that refer to it
+  lammps.input->one("variable a equal step-1");
+  EXPECT_DOUBLE_EQ(4*1e-5 + pow(cos(5*M_PI/4), 2), variable->compute_equal(variable->find("b")));
+}
+
+TEST(variable, atom_style_is_evaluated_for_group_only) {
+  const char * argv[7] = {"liggghts", "-in", "scripts/in.contactPack", "-screen", "none", "-log", "none"};
+  LAMMPS lammps(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  setup_pack(lammps);
+  lammps.input->one("region top block INF INF INF INF 0.06 INF units box");
+  lammps.input->one("group top region top");
+
+  // atoms outside the group would take the log of a negative value
+  lammps.input->one("variable r atom ln(z-0.06)+(x>0.05)*sqrt(x*x+y*y)/radius-mass");
+
+  Variable * variable = lammps.input->variable;
+  Atom * atom = lammps.atom;
+  const int nlocal = atom->nlocal;
+  const int igroup = lammps.group->find("top");
+  const int groupbit = lammps.group->bitmask[igroup];
+  std::vector<double> result(2*nlocal, -1.);
+  variable->compute_atom(variable->find("r"), igroup, &result[0], 2, 0);
+
+  int ngroup = 0;
+  for (int i = 0; i < nlocal; i++) {
+    double * x = atom->x[i];
+    if (atom->mask[i] & groupbit) {
+      const double expected = log(x[2]-0.06) + (x[0] > 0.05)*sqrt(x[0]*x[0]+x[1]*x[1])/atom->radius[i] - atom->rmass[i];
+      EXPECT_NEAR(expected, result[2*i], 1e-12*fabs(expected));
+      ngroup++;
+    } else EXPECT_EQ(0., result[2*i]);
+    EXPECT_EQ(-1., result[2*i+1]);
+  }
+  EXPECT_GT(ngroup, 0);
+  EXPECT_LT(ngroup, nlocal);
+}
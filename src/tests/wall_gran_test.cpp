@@ -0,0 +1,171 @@
+#include "gtest/gtest.h"
+#include <mpi.h>
+#include <algorithm>
+#include <set>
+#include <vector>
+#include "atom.h"
+#include "input.h"
+#include "lammps.h"
+#include "modify.h"
+#include "fix.h"
+#include "fix_neighlist_mesh.h"
+
+using namespace LAMMPS_NS;
+
+// particle block in a cylinder that is narrower than the block,
+// so there are face, edge and corner contacts
+static void run_contact_pack(LAMMPS & lammps, bool moving, const char * batched, const char * incremental = "no", int nsteps = 50, bool fixed_box = false) {
+  char wall[256], mesh[256], run[32];
+  snprintf(wall, sizeof(wall), "fix walls all wall/gran model hertz tangential history mesh n_meshes 1 meshes cad batched %s", batched);
+  snprintf(mesh, sizeof(mesh), "fix cad all mesh/surface file scripts/meshes/cylinder.stl type 1 scale 0.04 move 0.05 0.05 0.02 incremental_neighlist %s", incremental);
+  snprintf(run, sizeof(run), "run %d", nsteps);
+
+  lammps.input->file();
+  if (fixed_box)
+    lammps.input->one("change_box all boundary f f f");
+  lammps.input->one("pair_style gran model hertz tangential history");
+  lammps.input->one("pair_coeff * *");
+  lammps.input->one(mesh);
+  lammps.input->one(wall);
+  if (moving)
+    lammps.input->one("fix rot all move/mesh mesh cad rotate origin 0.05 0.05 0.0 axis 0. 0. 1. period 0.05");
+  lammps.input->one(run);
+}
+
+static void expect_same_state(LAMMPS & a, LAMMPS & b) {
+  ASSERT_EQ(a.atom->nlocal, b.atom->nlocal);
+  ASSERT_GT(a.atom->nlocal, 0);
+
+  for (int i = 0; i < a.atom->nlocal; i++) {
+    ASSERT_EQ(a.atom->tag[i], b.atom->tag[i]);
+    for (int k = 0; k < 3; k++) {
+      EXPECT_DOUBLE_EQ(a.atom->x[i][k], b.atom->x[i][k]);
+      EXPECT_DOUBLE_EQ(a.atom->f[i][k], b.atom->f[i][k]);
+      EXPECT_DOUBLE_EQ(a.atom->torque[i][k], b.atom->torque[i][k]);
+    }
+  }
+}
+
+static void expect_same_forces(bool moving) {
+  const char * argv[7] = {"liggghts", "-in", "scripts/in.contactPack", "-screen", "none", "-log", "none"};
+  LAMMPS a(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  LAMMPS b(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  run_contact_pack(a, moving, "no");
+  run_contact_pack(b, moving, "yes");
+  expect_same_state(a, b);
+}
+
+TEST(wall_gran, batched_mesh) {
+  expect_same_forces(false);
+}
+
+TEST(wall_gran, batched_moving_mesh) {
+  expect_same_forces(true);
+}
+
+// lists of a static mesh built incrementally, over several reneighborings
+// a shrink-wrapped box counts as changing domain and always builds fully
+TEST(wall_gran, incremental_mesh_neighlist) {
+  const char * argv[7] = {"liggghts", "-in", "scripts/in.contactPack", "-screen", "none", "-log", "none"};
+  LAMMPS a(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  LAMMPS b(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  run_contact_pack(a, false, "no", "no", 300, true);
+  run_contact_pack(b, false, "no", "yes", 300, true);
+  expect_same_state(a, b);
+}
+
+// neighbors of each triangle as particle tags
+static std::vector<std::set<int> > mesh_contacts(LAMMPS & lammps, FixNeighlistMesh * neighlist) {
+  std::vector<std::set<int> > contacts(neighlist->getSizeNumContacts());
+  for (size_t iTri = 0; iTri < contacts.size(); iTri++) {
+    const int * neighbors;
+    const int numneigh = neighlist->get_contact_list(iTri, neighbors);
+    for (int k = 0; k < numneigh; k++)
+      contacts[iTri].insert(lammps.atom->tag[neighbors[k]]);
+  }
+  return contacts;
+}
+
+// only particles at one side of the cylinder move, so the incremental build
+// rebuilds the triangles close to them and takes over the lists of all others
+// lists are built every step, so the last build is at the final positions
+TEST(wall_gran, incremental_mesh_neighlist_local_perturbation) {
+  const char * argv[7] = {"liggghts", "-in", "scripts/in.contactPack", "-screen", "none", "-log", "none"};
+  LAMMPS lammps(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  lammps.input->file();
+  lammps.input->one("change_box all boundary f f f");
+  lammps.input->one("neigh_modify every 1 delay 0 check no");
+  lammps.input->one("pair_style gran model hertz tangential history");
+  lammps.input->one("pair_coeff * *");
+  lammps.input->one("fix cad all mesh/surface file scripts/meshes/cylinder.stl type 1 scale 0.04 move 0.05 0.05 0.02 incremental_neighlist yes");
+  lammps.input->one("fix walls all wall/gran model hertz tangential history mesh n_meshes 1 meshes cad");
+  lammps.input->one("region side block 0.065 INF INF INF 0.04 INF units box");
+  lammps.input->one("group side region side");
+  lammps.input->one("unfix integr");
+  lammps.input->one("fix integr side nve/sphere");
+  lammps.input->one("run 300");
+
+  FixNeighlistMesh * neighlist = dynamic_cast<FixNeighlistMesh*>(lammps.modify->find_fix_id("wall_neighlist_cad"));
+  ASSERT_TRUE(neighlist != NULL);
+  const double rebuilt = neighlist->compute_vector(1);
+  const double ntri = neighlist->compute_vector(2);
+  EXPECT_GT(rebuilt, 0.0);
+  EXPECT_LT(rebuilt, ntri);
+  const std::vector<std::set<int> > incremental = mesh_contacts(lammps, neighlist);
+
+  // a new run starts with a full build at the same positions
+  lammps.input->one("run 0");
+  EXPECT_EQ(ntri, neighlist->compute_vector(1));
+  const std::vector<std::set<int> > full = mesh_contacts(lammps, neighlist);
+
+  ASSERT_EQ(full.size(), incremental.size());
+  int ncontacts = 0;
+  for (size_t iTri = 0; iTri < full.size(); iTri++) {
+    EXPECT_TRUE(full[iTri] == incremental[iTri]) << "triangle " << iTri;
+    ncontacts += full[iTri].size();
+  }
+  EXPECT_GT(ncontacts, 0);
+}
+
+// exposes the bin lists of the mesh neighbor list
+class FixNeighlistMeshBins : public FixNeighlistMesh {
+ public:
+  using FixNeighlistMesh::voxelizeTriangle;
+  using FixNeighlistMesh::boundingBoxBins;
+  double cutoff() const { return distmax + skin; }
+};
+
+static void expect_slab_bins_match_bounding_box(const char * fix_mesh) {
+  const char * argv[7] = {"liggghts", "-in", "scripts/in.contactPack", "-screen", "none", "-log", "none"};
+  LAMMPS lammps(7, const_cast<char**>(argv), MPI_COMM_WORLD);
+  lammps.input->file();
+  lammps.input->one("pair_style gran model hertz tangential history");
+  lammps.input->one("pair_coeff * *");
+  lammps.input->one(fix_mesh);
+  lammps.input->one("fix walls all wall/gran model hertz tangential history mesh n_meshes 1 meshes cad");
+  lammps.input->one("run 0");
+
+  FixNeighlistMesh * fix = dynamic_cast<FixNeighlistMesh*>(lammps.modify->find_fix_id("wall_neighlist_cad"));
+  ASSERT_TRUE(fix != NULL);
+  FixNeighlistMeshBins * neighlist = static_cast<FixNeighlistMeshBins*>(fix);
+
+  int nbox_all = 0, nused_all = 0;
+  for (int iTri = 0; iTri < neighlist->getSizeNumContacts(); iTri++) {
+    std::vector<int> slab, box;
+    const int nslab = neighlist->voxelizeTriangle(iTri, neighlist->cutoff(), true, slab);
+    const int nbox = neighlist->boundingBoxBins(iTri, neighlist->cutoff(), true, box);
+    EXPECT_EQ(nbox, nslab);
+    std::sort(slab.begin(), slab.end());
+    std::sort(box.begin(), box.end());
+    EXPECT_TRUE(box == slab) << "triangle " << iTri;
+    nbox_all += nbox;
+    nused_all += slab.size();
+  }
+  EXPECT_GT(nused_all, 0);
+  EXPECT_LT(nused_all, nbox_all);
+}
+
+TEST(wall_gran, slab_voxelization_matches_bounding_box_bins) {
+  expect_slab_bins_match_bounding_box("fix cad all mesh/surface file scripts/meshes/cylinder.stl type 1 scale 0.04 move 0.05 0.05 0.02");
+  expect_slab_bins_match_bounding_box("fix cad all mesh/surface file scripts/meshes/cylinder.stl type 1 scale 0.04 rotate axis 1. 1. 0. angle 30. move 0.05 0.05 0.03");
+}
@@ -54,6 +54,13 @@ namespace LAMMPS_NS
         double resolveTriSphereContactBary(int iPart, int nTri, double rSphere, double *cSphere,
                                            double *contactPoint,double *bary);
 
+        // overlap algorithm for n spheres against the same triangle
+        // gives the same results as resolveTriSphereContactBary for each of them
+        // delta and bary are 3*n arrays
+        void resolveTriSphereContactBatch(int nTri, int n, const int *iPart, double **x,
+                                          const double *radius, double r0,
+                                          double *deltan, double *delta, double *bary);
+
 #ifdef SUPERQUADRIC_ACTIVE_FLAG
         double resolveTriSuperquadricContact(int nTri, double *normal, double *contactPoint, Superquadric particle);
         double resolveTriSuperquadricContact(int nTri, double *normal, double *contactPoint, Superquadric particle, double *bary);
@@ -79,6 +86,23 @@ namespace LAMMPS_NS
 
       private:
 
+        // triangle data read once per batch instead of once per sphere
+        struct TriangleData {
+          double node0[3];
+          double edgeVec0[3];
+          double edgeVec2[3];
+          double surfNorm[3];
+          double baryDenom1, baryDenom2;
+          double edgeCos;
+          double epsilon;
+        };
+
+        static const int BATCH_TRIMESH = 64;
+
+        void packTriangle(int nTri, TriangleData &tri);
+        double resolveEdgeCornerContactBary(int iPart, int nTri, int barySign,
+                                            double *p, double *delta, double *bary);
+
         inline double precision_trimesh()
         { return MultiNodeMesh<3>::precision(); }
         double calcDist(double *cs, double *closestPoint, double *en0);
@@ -97,55 +97,173 @@
     /*NL*/
     /*NL*/ }
 
+    if(barySign == 7) // face contact - all three barycentric coordinates are > 0
+      d = resolveFaceContactBary(nTri,cSphere,node0ToSphereCenter,delta);
+    else
+      d = resolveEdgeCornerContactBary(iPart,nTri,barySign,cSphere,delta,bary);
+
+    /*NL*/ double deltan = d - rSphere;
+    /*NL*/ if(screen && DEBUGMODE_LMP_TRI_MESH_I_H && DEBUGMODE_LMP_TRI_MESH_I_H_MESH_ID == id(nTri))
+    /*NL*/ // if(5879 == id(nTri))
+    /*NL*/     fprintf(screen,"step " BIGINT_FORMAT ": deltan %f\n",
+    /*NL*/                    update->ntimestep,deltan);
+
+    /*NL*/ // if(screen) printVec3D(screen,"bary tri_mesh_I",bary);
+
+    // return distance - radius of the particle
+    return d - rSphere;
+  }
+
+  /* ----------------------------------------------------------------------
+   batched version of resolveTriSphereContactBary
+   the triangle is packed once, then barycentric coordinates and face
+   distance are computed for a block of spheres in unit-stride loops
+   without branches. only spheres that see an edge or a corner take the
+   scalar path
+   the arithmetic is the same as in the scalar version, so are the results
+  ------------------------------------------------------------------------- */
+
+  inline void TriMesh::packTriangle(int nTri, TriangleData &tri)
+  {
+    double **n = node_(nTri);
+    double **edge = edgeVec(nTri);
+    double *len = edgeLen(nTri);
+
+    vectorCopy3D(n[0],tri.node0);
+    vectorCopy3D(edge[0],tri.edgeVec0);
+    vectorCopy3D(edge[2],tri.edgeVec2);
+    vectorCopy3D(SurfaceMeshBase::surfaceNorm(nTri),tri.surfNorm);
+
+    // see MathExtraLiggghts::calcBaryTriCoords
+    tri.edgeCos = vectorDot3D(edge[0],edge[2]);
+    double oneMinCSqr = 1 - tri.edgeCos*tri.edgeCos;
+    tri.baryDenom1 = len[0] * oneMinCSqr;
+    tri.baryDenom2 = len[2] * oneMinCSqr;
+
+    tri.epsilon = -precision_trimesh()/(2.*rBound_(nTri));
+  }
+
+  inline void TriMesh::resolveTriSphereContactBatch(int nTri, int n, const int *iPart, double **x,
+                                                    const double *radius, double r0,
+                                                    double *deltan, double *delta, double *bary)
+  {
+    TriangleData tri;
+    packTriangle(nTri,tri);
+
+    const double n0x = tri.node0[0], n0y = tri.node0[1], n0z = tri.node0[2];
+    const double e0x = tri.edgeVec0[0], e0y = tri.edgeVec0[1], e0z = tri.edgeVec0[2];
+    const double e2x = tri.edgeVec2[0], e2y = tri.edgeVec2[1], e2z = tri.edgeVec2[2];
+    const double sx = tri.surfNorm[0], sy = tri.surfNorm[1], sz = tri.surfNorm[2];
+    const double c = tri.edgeCos;
+
+    double px[BATCH_TRIMESH], py[BATCH_TRIMESH], pz[BATCH_TRIMESH];
+    double b0[BATCH_TRIMESH], b1[BATCH_TRIMESH], b2[BATCH_TRIMESH];
+    double dx[BATCH_TRIMESH], dy[BATCH_TRIMESH], dz[BATCH_TRIMESH], d[BATCH_TRIMESH];
+
+    for(int k0 = 0; k0 < n; k0 += BATCH_TRIMESH)
+    {
+      const int nk = (n-k0 < BATCH_TRIMESH) ? n-k0 : BATCH_TRIMESH;
+
+      for(int k = 0; k < nk; k++)
+      {
+        const double *xk = x[iPart[k0+k]];
+        px[k] = xk[0];
+        py[k] = xk[1];
+        pz[k] = xk[2];
+      }
+
+      // barycentric coordinates and distance to the plane of the triangle
+      for(int k = 0; k < nk; k++)
+      {
+        const double ax = px[k] - n0x;
+        const double ay = py[k] - n0y;
+        const double az = pz[k] - n0z;
+
+        const double a = ax*e0x+ay*e0y+az*e0z;
+        const double b = ax*e2x+ay*e2y+az*e2z;
+        b1[k] = (a - b*c)/tri.baryDenom1;
+        b2[k] = (a*c - b)/tri.baryDenom2;
+        b0[k] = 1. - b1[k] - b2[k];
+
+        const double dNorm = sx*ax+sy*ay+sz*az;
+        const double csx = px[k] - dNorm*sx;
+        const double csy = py[k] - dNorm*sy;
+        const double csz = pz[k] - dNorm*sz;
+        dx[k] = csx - px[k];
+        dy[k] = csy - py[k];
+        dz[k] = csz - pz[k];
+        d[k] = sqrt((px[k]-csx)*(px[k]-csx) + (py[k]-csy)*(py[k]-csy) + (pz[k]-csz)*(pz[k]-csz));
+      }
+
+      for(int k = 0; k < nk; k++)
+      {
+        const int i = iPart[k0+k];
+        double *deltak = &delta[3*(k0+k)];
+        double *baryk = &bary[3*(k0+k)];
+        const double rSphere = radius ? radius[i] : r0;
+
+        baryk[0] = b0[k];
+        baryk[1] = b1[k];
+        baryk[2] = b2[k];
+
+        const int barySign = (b0[k] > tri.epsilon) + 2*(b1[k] > tri.epsilon) + 4*(b2[k] > tri.epsilon);
+
+        if(barySign == 7)
+        {
+          deltak[0] = dx[k];
+          deltak[1] = dy[k];
+          deltak[2] = dz[k];
+          deltan[k0+k] = d[k] - rSphere;
+        }
+        else
+        {
+          double p[3] = { px[k], py[k], pz[k] };
+          deltan[k0+k] = resolveEdgeCornerContactBary(i,nTri,barySign,p,deltak,baryk) - rSphere;
+        }
+      }
+    }
+  }
+
+  /* ---------------------------------------------------------------------- */
+
+  /* ----------------------------------------------------------------------
+   corner and edge contacts, barySign as computed in resolveTriSphereContactBary
+  ------------------------------------------------------------------------- */
+
+  inline double TriMesh::resolveEdgeCornerContactBary(int iPart, int nTri, int barySign,
+                                                      double *p, double *delta, double *bary)
+  {
+    int obtuseAngleIndex = SurfaceMeshBase::obtuseAngleIndex(nTri);
+    double d(0.);
+
     switch(barySign)
     {
     case 1: //NP bary[0] > 0, corner contact node 0
-      d = resolveCornerContactBary(nTri,0,obtuseAngleIndex == 0,cSphere,delta,bary);
+      d = resolveCornerContactBary(nTri,0,obtuseAngleIndex == 0,p,delta,bary);
       break;
     case 2: //NP bary[1] > 0, corner contact node 1
-      d = resolveCornerContactBary(nTri,1,obtuseAngleIndex == 1,cSphere,delta,bary);
+      d = resolveCornerContactBary(nTri,1,obtuseAngleIndex == 1,p,delta,bary);
       break;
     case 3: //NP bary[2] < 0, edge contact edge 0
-      d = resolveEdgeContactBary(nTri,0,cSphere,delta,bary);
+      d = resolveEdgeContactBary(nTri,0,p,delta,bary);
       break;
     case 4: //NP bary[2] > 0, corner contact node 2
-      d = resolveCornerContactBary(nTri,2,obtuseAngleIndex == 2,cSphere,delta,bary);
+      d = resolveCornerContactBary(nTri,2,obtuseAngleIndex == 2,p,delta,bary);
       break;
     case 5: //NP bary[1] < 0, edge contact edge 2
-      d = resolveEdgeContactBary(nTri,2,cSphere,delta,bary);
+      d = resolveEdgeContactBary(nTri,2,p,delta,bary);
       break;
     case 6: //NP bary[0] < 0 --> edge contact on edge[1]
-      d = resolveEdgeContactBary(nTri,1,cSphere,delta,bary);
-      break;
-    case 7: // face contact - all three barycentric coordinates are > 0
-      d = resolveFaceContactBary(nTri,cSphere,node0ToSphereCenter,delta);
+      d = resolveEdgeContactBary(nTri,1,p,delta,bary);
       break;
     default:
       /*NL*/ if(screen) fprintf(screen,"barySign %d bary %f %f %f tag %d tri id %d\n",barySign,bary[0],bary[1],bary[2],this->atom->tag[iPart],id(nTri));
-      /*NL*/ //if(screen) {
-      /*NL*/ //printVec3D(screen,"node0ToSphereCenter",node0ToSphereCenter);
-      /*NL*/ //printVec3D(screen,"cSphere",cSphere);
-      /*NL*/ //printVec3D(screen,"n[0]",n[0]);
-      /*NL*/ //printVec3D(screen,"edgeLen(nTri)",edgeLen(nTri));
-      /*NL*/ //printVec3D(screen,"edgeVec(nTri)[0]",edgeVec(nTri)[0]);
-      /*NL*/ //printVec3D(screen,"edgeVec(nTri)[1]",edgeVec(nTri)[1]);
-      /*NL*/ //printVec3D(screen,"edgeVec(nTri)[2]",edgeVec(nTri)[2]);
-      /*NL*/ //}
       this->error->one(FLERR,"Internal error");
       d = 1.; // doesn't exist, just to satisfy the compiler
       break;
     }
 
-    /*NL*/ double deltan = d - rSphere;
-    /*NL*/ if(screen && DEBUGMODE_LMP_TRI_MESH_I_H && DEBUGMODE_LMP_TRI_MESH_I_H_MESH_ID == id(nTri))
-    /*NL*/ // if(5879 == id(nTri))
-    /*NL*/     fprintf(screen,"step " BIGINT_FORMAT ": deltan %f\n",
-    /*NL*/                    update->ntimestep,deltan);
-
-    /*NL*/ // if(screen) printVec3D(screen,"bary tri_mesh_I",bary);
-
-    // return distance - radius of the particle
-    return d - rSphere;
+    return d;
   }
 
   /* ---------------------------------------------------------------------- */
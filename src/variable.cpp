@@ -66,7 +66,7 @@ enum{DONE,ADD,SUBTRACT,MULTIPLY,DIVIDE,CARAT,MODULO,UNARY,
      SQRT,EXP,LN,LOG,ABS,SIN,COS,TAN,ASIN,ACOS,ATAN,ATAN2,
      RANDOM,NORMAL,CEIL,FLOOR,ROUND,RAMP,STAGGER,LOGFREQ,STRIDE,
      VDISPLACE,SWIGGLE,CWIGGLE,GMASK,RMASK,GRMASK,
-     VALUE,ATOMARRAY,TYPEARRAY,INTARRAY};
+     VALUE,ATOMARRAY,TYPEARRAY,INTARRAY,KEYWORD,SCALARVAR};
 
 // customize by adding a special function
 
@@ -91,6 +91,10 @@ Variable::Variable(LAMMPS *lmp) : Pointers(lmp)
 
   eval_in_progress = NULL;
 
+  compiled = NULL;
+  compileflag = NULL;
+  compiling = 0;
+
   randomequal = NULL;
   randomatom = NULL;
 
@@ -111,6 +115,7 @@ Variable::Variable(LAMMPS *lmp) : Pointers(lmp)
 
 Variable::~Variable()
 {
+  uncompile();
   for (int i = 0; i < nvar; i++) {
     delete [] names[i];
     delete reader[i];
@@ -127,6 +132,8 @@ Variable::~Variable()
   memory->sfree(data);
 
   memory->destroy(eval_in_progress);
+  memory->sfree(compiled);
+  memory->destroy(compileflag);
 
   delete randomequal;
   delete randomatom;
@@ -566,7 +573,7 @@ char *Variable::retrieve(char *name)
     str = data[ivar][0];
   } else if (style[ivar] == EQUAL) {
     char result[64];
-    double answer = evaluate(data[ivar][0],NULL);
+    double answer = compute_equal(ivar);
     sprintf(result,"%.15g",answer);
     int n = strlen(result) + 1;
     if (data[ivar][1]) delete [] data[ivar][1];
@@ -594,9 +601,13 @@ double Variable::compute_equal(int ivar)
 {
   // eval_in_progress used to detect circle dependencies
   // could extend this later to check v_a = c_b + v_a constructs?
+  // formula is compiled on first use, re-parsed if it cannot be compiled
 
   eval_in_progress[ivar] = 1;
-  double value = evaluate(data[ivar][0],NULL);
+  if (compileflag[ivar] == 0) compile(ivar);
+  double value;
+  if (compileflag[ivar] == 1) value = eval_tree(compiled[ivar],0);
+  else value = evaluate(data[ivar][0],NULL);
   eval_in_progress[ivar] = 0;
   return value;
 }
@@ -616,6 +627,7 @@ double Variable::compute_equal(char *str)
    only computed for atoms in igroup, else result is 0.0
    answers are placed every stride locations into result
    if sumflag, add variable values to existing result
+   atom-style tree is evaluated for the list of atoms in igroup at once
 ------------------------------------------------------------------------- */
 
 void Variable::compute_atom(int ivar, int igroup,
@@ -634,22 +646,41 @@ void Variable::compute_atom(int ivar, int igroup,
   int nlocal = atom->nlocal;
 
   if (style[ivar] == ATOM) {
+    int *ilist;
+    double *values;
+    memory->create(ilist,nlocal,"variable:ilist");
+    int n = 0;
+    for (int i = 0; i < nlocal; i++)
+      if (mask[i] & groupbit) ilist[n++] = i;
+    memory->create(values,n,"variable:values");
+
+    // random numbers are drawn atom by atom to keep their sequence
+
+    if (random_in_tree(tree))
+      for (int k = 0; k < n; k++) values[k] = eval_tree(tree,ilist[k]);
+    else eval_tree(tree,n,ilist,values);
+
     if (sumflag == 0) {
       int m = 0;
+      int k = 0;
       for (int i = 0; i < nlocal; i++) {
-        if (mask[i] & groupbit) result[m] = eval_tree(tree,i);
+        if (mask[i] & groupbit) result[m] = values[k++];
         else result[m] = 0.0;
         m += stride;
       }
 
     } else {
       int m = 0;
+      int k = 0;
       for (int i = 0; i < nlocal; i++) {
-        if (mask[i] & groupbit) result[m] += eval_tree(tree,i);
+        if (mask[i] & groupbit) result[m] += values[k++];
         m += stride;
       }
     }
 
+    memory->destroy(ilist);
+    memory->destroy(values);
+
   } else {
     if (sumflag == 0) {
       int m = 0;
@@ -710,6 +741,10 @@ int Variable::atomstyle(int ivar)
 
 void Variable::remove(int n)
 {
+  // compiled trees refer to other variables by index
+
+  uncompile();
+
   delete [] names[n];
   if (style[n] == LOOP || style[n] == ULOOP) delete [] data[n][0];
   else for (int i = 0; i < num[n]; i++) delete [] data[n][i];
@@ -750,6 +785,14 @@ void Variable::grow()
 
   memory->grow(eval_in_progress,maxvar,"var:eval_in_progress");
   for (int i = 0; i < maxvar; i++) eval_in_progress[i] = 0;
+
+  compiled = (Tree **)
+    memory->srealloc(compiled,maxvar*sizeof(Tree *),"var:compiled");
+  memory->grow(compileflag,maxvar,"var:compileflag");
+  for (int i = old; i < maxvar; i++) {
+    compiled[i] = NULL;
+    compileflag[i] = 0;
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -1311,8 +1354,19 @@ double Variable::evaluate(char *str, Tree **tree)
         }
 
         // v_name = scalar from non atom/atomfile variable
+        // compiled tree retrieves it each time the tree is evaluated
+
+        if (nbracket == 0 && compiling &&
+            style[ivar] != ATOM && style[ivar] != ATOMFILE) {
+
+          Tree *newtree = new Tree();
+          newtree->type = SCALARVAR;
+          newtree->ivalue1 = ivar;
+          newtree->left = newtree->middle = newtree->right = NULL;
+          treestack[ntreestack++] = newtree;
 
-        if (nbracket == 0 && style[ivar] != ATOM && style[ivar] != ATOMFILE) {
+        } else if (nbracket == 0 &&
+                   style[ivar] != ATOM && style[ivar] != ATOMFILE) {
 
           char *var = retrieve(id);
           if (var == NULL)
@@ -1455,7 +1509,14 @@ double Variable::evaluate(char *str, Tree **tree)
           int flag = output->thermo->evaluate_keyword(word,&value1);
           if (flag)
             error->all(FLERR,"Invalid thermo keyword in variable formula");
-          if (tree) {
+          if (tree && compiling) {
+            Tree *newtree = new Tree();
+            newtree->type = KEYWORD;
+            newtree->keyword = new char[strlen(word)+1];
+            strcpy(newtree->keyword,word);
+            newtree->left = newtree->middle = newtree->right = NULL;
+            treestack[ntreestack++] = newtree;
+          } else if (tree) {
             Tree *newtree = new Tree();
             newtree->type = VALUE;
             newtree->value = value1;
@@ -2095,6 +2156,22 @@ double Variable::eval_tree(Tree *tree, int i)
   if (tree->type == TYPEARRAY) return tree->array[atom->type[i]];
   if (tree->type == INTARRAY) return (double) tree->iarray[i*tree->nstride];
 
+  if (tree->type == KEYWORD) {
+    if (domain->box_exist == 0)
+      error->one(FLERR,"Variable evaluation before simulation box is defined");
+    if (output->thermo->evaluate_keyword(tree->keyword,&arg))
+      error->one(FLERR,"Invalid thermo keyword in variable formula");
+    return arg;
+  }
+  if (tree->type == SCALARVAR) {
+    if (eval_in_progress[tree->ivalue1])
+      error->one(FLERR,"Variable has circular dependency");
+    char *var = retrieve(names[tree->ivalue1]);
+    if (var == NULL)
+      error->one(FLERR,"Invalid variable evaluation in variable formula");
+    return atof(var);
+  }
+
   if (tree->type == ADD)
     return eval_tree(tree->left,i) + eval_tree(tree->right,i);
   if (tree->type == SUBTRACT)
@@ -2237,6 +2314,8 @@ double Variable::eval_tree(Tree *tree, int i)
     return MYROUND(eval_tree(tree->left,i));
 
   if (tree->type == RAMP) {
+    if (update->whichflag == 0)
+      error->one(FLERR,"Cannot use ramp in variable formula between runs");
     arg1 = eval_tree(tree->left,i);
     arg2 = eval_tree(tree->right,i);
     double delta = update->ntimestep - update->beginstep;
@@ -2290,6 +2369,8 @@ double Variable::eval_tree(Tree *tree, int i)
   }
 
   if (tree->type == VDISPLACE) {
+    if (update->whichflag == 0)
+      error->one(FLERR,"Cannot use vdisplace in variable formula between runs");
     arg1 = eval_tree(tree->left,i);
     arg2 = eval_tree(tree->right,i);
     double delta = update->ntimestep - update->beginstep;
@@ -2298,6 +2379,8 @@ double Variable::eval_tree(Tree *tree, int i)
   }
 
   if (tree->type == SWIGGLE) {
+    if (update->whichflag == 0)
+      error->one(FLERR,"Cannot use swiggle in variable formula between runs");
     arg1 = eval_tree(tree->left,i);
     arg2 = eval_tree(tree->middle,i);
     arg3 = eval_tree(tree->right,i);
@@ -2310,6 +2393,8 @@ double Variable::eval_tree(Tree *tree, int i)
   }
 
   if (tree->type == CWIGGLE) {
+    if (update->whichflag == 0)
+      error->one(FLERR,"Cannot use cwiggle in variable formula between runs");
     arg1 = eval_tree(tree->left,i);
     arg2 = eval_tree(tree->middle,i);
     arg3 = eval_tree(tree->right,i);
@@ -2354,10 +2439,277 @@ void Variable::free_tree(Tree *tree)
 
   if (tree->type == ATOMARRAY && tree->selfalloc)
     memory->destroy(tree->array);
+  if (tree->type == KEYWORD) delete [] tree->keyword;
 
   delete tree;
 }
 
+/* ----------------------------------------------------------------------
+   evaluate an atom-style variable parse tree for N atoms in ilist
+   each node is evaluated for all atoms before its parent node
+   result = N values, children beyond the left one use scratch arrays
+   functions without a loop here, and AND/OR which only evaluate
+     their right side when needed, are evaluated atom by atom
+---------------------------------------------------------------------- */
+
+void Variable::eval_tree(Tree *tree, int n, int *ilist, double *result)
+{
+  int k;
+  int type = tree->type;
+
+  if (type == VALUE) {
+    double value = tree->value;
+    for (k = 0; k < n; k++) result[k] = value;
+    return;
+  }
+  if (type == ATOMARRAY) {
+    double *array = tree->array;
+    int nstride = tree->nstride;
+    for (k = 0; k < n; k++) result[k] = array[ilist[k]*nstride];
+    return;
+  }
+  if (type == TYPEARRAY) {
+    double *array = tree->array;
+    int *atype = atom->type;
+    for (k = 0; k < n; k++) result[k] = array[atype[ilist[k]]];
+    return;
+  }
+  if (type == INTARRAY) {
+    int *iarray = tree->iarray;
+    int nstride = tree->nstride;
+    for (k = 0; k < n; k++) result[k] = (double) iarray[ilist[k]*nstride];
+    return;
+  }
+  if (type == GMASK) {
+    int *amask = atom->mask;
+    int groupbit = tree->ivalue1;
+    for (k = 0; k < n; k++)
+      result[k] = (amask[ilist[k]] & groupbit) ? 1.0 : 0.0;
+    return;
+  }
+
+  // binary operators
+
+  if (type == ADD || type == SUBTRACT || type == MULTIPLY ||
+      type == DIVIDE || type == MODULO || type == CARAT ||
+      type == EQ || type == NE || type == LT || type == LE ||
+      type == GT || type == GE || type == ATAN2) {
+    double *arg2;
+    memory->create(arg2,n,"variable:arg2");
+    eval_tree(tree->left,n,ilist,result);
+    eval_tree(tree->right,n,ilist,arg2);
+
+    if (type == ADD)
+      for (k = 0; k < n; k++) result[k] += arg2[k];
+    else if (type == SUBTRACT)
+      for (k = 0; k < n; k++) result[k] -= arg2[k];
+    else if (type == MULTIPLY)
+      for (k = 0; k < n; k++) result[k] *= arg2[k];
+    else if (type == DIVIDE) {
+      for (k = 0; k < n; k++)
+        if (arg2[k] == 0.0) error->one(FLERR,"Divide by 0 in variable formula");
+      for (k = 0; k < n; k++) result[k] /= arg2[k];
+    } else if (type == MODULO) {
+      for (k = 0; k < n; k++) {
+        if (arg2[k] == 0.0) error->one(FLERR,"Modulo 0 in variable formula");
+        result[k] = fmod(result[k],arg2[k]);
+      }
+    } else if (type == CARAT) {
+      for (k = 0; k < n; k++) {
+        if (arg2[k] == 0.0) error->one(FLERR,"Power by 0 in variable formula");
+        result[k] = pow(result[k],arg2[k]);
+      }
+    } else if (type == EQ)
+      for (k = 0; k < n; k++) result[k] = (result[k] == arg2[k]) ? 1.0 : 0.0;
+    else if (type == NE)
+      for (k = 0; k < n; k++) result[k] = (result[k] != arg2[k]) ? 1.0 : 0.0;
+    else if (type == LT)
+      for (k = 0; k < n; k++) result[k] = (result[k] < arg2[k]) ? 1.0 : 0.0;
+    else if (type == LE)
+      for (k = 0; k < n; k++) result[k] = (result[k] <= arg2[k]) ? 1.0 : 0.0;
+    else if (type == GT)
+      for (k = 0; k < n; k++) result[k] = (result[k] > arg2[k]) ? 1.0 : 0.0;
+    else if (type == GE)
+      for (k = 0; k < n; k++) result[k] = (result[k] >= arg2[k]) ? 1.0 : 0.0;
+    else if (type == ATAN2)
+      for (k = 0; k < n; k++) result[k] = atan2(result[k],arg2[k]);
+
+    memory->destroy(arg2);
+    return;
+  }
+
+  // unary operators and functions of one argument
+
+  if (type == UNARY || type == NOT || type == SQRT || type == EXP ||
+      type == LN || type == LOG || type == ABS || type == SIN ||
+      type == COS || type == TAN || type == ASIN || type == ACOS ||
+      type == ATAN || type == CEIL || type == FLOOR || type == ROUND) {
+    eval_tree(tree->left,n,ilist,result);
+
+    if (type == UNARY)
+      for (k = 0; k < n; k++) result[k] = -result[k];
+    else if (type == NOT)
+      for (k = 0; k < n; k++) result[k] = (result[k] == 0.0) ? 1.0 : 0.0;
+    else if (type == SQRT) {
+      for (k = 0; k < n; k++) {
+        if (result[k] < 0.0)
+          error->one(FLERR,"Sqrt of negative value in variable formula");
+        result[k] = sqrt(result[k]);
+      }
+    } else if (type == EXP)
+      for (k = 0; k < n; k++) result[k] = exp(result[k]);
+    else if (type == LN) {
+      for (k = 0; k < n; k++) {
+        if (result[k] <= 0.0)
+          error->one(FLERR,"Log of zero/negative value in variable formula");
+        result[k] = log(result[k]);
+      }
+    } else if (type == LOG) {
+      for (k = 0; k < n; k++) {
+        if (result[k] <= 0.0)
+          error->one(FLERR,"Log of zero/negative value in variable formula");
+        result[k] = log10(result[k]);
+      }
+    } else if (type == ABS)
+      for (k = 0; k < n; k++) result[k] = fabs(result[k]);
+    else if (type == SIN)
+      for (k = 0; k < n; k++) result[k] = sin(result[k]);
+    else if (type == COS)
+      for (k = 0; k < n; k++) result[k] = cos(result[k]);
+    else if (type == TAN)
+      for (k = 0; k < n; k++) result[k] = tan(result[k]);
+    else if (type == ASIN) {
+      for (k = 0; k < n; k++) {
+        if (result[k] < -1.0 || result[k] > 1.0)
+          error->one(FLERR,"Arcsin of invalid value in variable formula");
+        result[k] = asin(result[k]);
+      }
+    } else if (type == ACOS) {
+      for (k = 0; k < n; k++) {
+        if (result[k] < -1.0 || result[k] > 1.0)
+          error->one(FLERR,"Arccos of invalid value in variable formula");
+        result[k] = acos(result[k]);
+      }
+    } else if (type == ATAN)
+      for (k = 0; k < n; k++) result[k] = atan(result[k]);
+    else if (type == CEIL)
+      for (k = 0; k < n; k++) result[k] = ceil(result[k]);
+    else if (type == FLOOR)
+      for (k = 0; k < n; k++) result[k] = floor(result[k]);
+    else if (type == ROUND)
+      for (k = 0; k < n; k++) result[k] = MYROUND(result[k]);
+    return;
+  }
+
+  for (k = 0; k < n; k++) result[k] = eval_tree(tree,ilist[k]);
+}
+
+/* ----------------------------------------------------------------------
+   return 1 if tree draws random numbers, 0 if not
+---------------------------------------------------------------------- */
+
+int Variable::random_in_tree(Tree *tree)
+{
+  if (tree->type == RANDOM || tree->type == NORMAL) return 1;
+  if (tree->left && random_in_tree(tree->left)) return 1;
+  if (tree->middle && random_in_tree(tree->middle)) return 1;
+  if (tree->right && random_in_tree(tree->right)) return 1;
+  return 0;
+}
+
+/* ----------------------------------------------------------------------
+   one-time parsing of an equal-style variable into a tree
+   thermo keywords and other variables stay nodes of the tree,
+     so it is re-evaluated via eval_tree() without parsing the formula
+   formulas with items whose value cannot be re-evaluated from the tree,
+     e.g. computes, fixes, group functions, are parsed on every evaluation
+------------------------------------------------------------------------- */
+
+void Variable::compile(int ivar)
+{
+  compileflag[ivar] = -1;
+  if (style[ivar] != EQUAL || !compilable(data[ivar][0])) return;
+
+  compiling = 1;
+  evaluate(data[ivar][0],&compiled[ivar]);
+  compiling = 0;
+  compileflag[ivar] = 1;
+}
+
+/* ----------------------------------------------------------------------
+   return 1 if formula str contains only items a compiled tree supports:
+     numbers, constants, thermo keywords, operators,
+     math functions except random() and normal(),
+     v_name of non atom/atomfile variables
+   return 0 if not
+------------------------------------------------------------------------- */
+
+int Variable::compilable(char *str)
+{
+  int i = 0;
+
+  while (str[i]) {
+
+    // number, skip exponent so it is not read as a word
+
+    if (isdigit(str[i]) || str[i] == '.') {
+      while (isdigit(str[i]) || str[i] == '.') i++;
+      if (str[i] == 'e' || str[i] == 'E') {
+        i++;
+        if (str[i] == '+' || str[i] == '-') i++;
+      }
+
+    } else if (isalpha(str[i])) {
+      int istart = i;
+      while (isalnum(str[i]) || str[i] == '_') i++;
+      int n = i - istart;
+      char *word = new char[n+1];
+      strncpy(word,&str[istart],n);
+      word[n] = '\0';
+
+      int flag = 1;
+      if (strncmp(word,"c_",2) == 0 || strncmp(word,"f_",2) == 0) flag = 0;
+      else if (strncmp(word,"v_",2) == 0) {
+        int ivar = find(&word[2]);
+        if (ivar < 0 || str[i] == '[' ||
+            style[ivar] == ATOM || style[ivar] == ATOMFILE) flag = 0;
+      } else if (str[i] == '(') {
+        if (strcmp(word,"sqrt") && strcmp(word,"exp") &&
+            strcmp(word,"ln") && strcmp(word,"log") &&
+            strcmp(word,"abs") &&
+            strcmp(word,"sin") && strcmp(word,"cos") &&
+            strcmp(word,"tan") && strcmp(word,"asin") &&
+            strcmp(word,"acos") && strcmp(word,"atan") &&
+            strcmp(word,"atan2") && strcmp(word,"ceil") &&
+            strcmp(word,"floor") && strcmp(word,"round") &&
+            strcmp(word,"ramp") && strcmp(word,"stagger") &&
+            strcmp(word,"logfreq") && strcmp(word,"stride") &&
+            strcmp(word,"vdisplace") &&
+            strcmp(word,"swiggle") && strcmp(word,"cwiggle")) flag = 0;
+      } else if (str[i] == '[' || is_atom_vector(word)) flag = 0;
+
+      delete [] word;
+      if (!flag) return 0;
+
+    } else i++;
+  }
+
+  return 1;
+}
+
+/* ----------------------------------------------------------------------
+   free all compiled trees, they are rebuilt on next evaluation
+------------------------------------------------------------------------- */
+
+void Variable::uncompile()
+{
+  for (int i = 0; i < nvar; i++) {
+    if (compiled[i]) free_tree(compiled[i]);
+    compiled[i] = NULL;
+    compileflag[i] = 0;
+  }
+}
+
 /* ----------------------------------------------------------------------
    find matching parenthesis in str, allocate contents = str between parens
    i = left paren
@@ -2742,7 +3094,7 @@ int Variable::math_function(char *word, char *contents, Tree **tree,
       error->all(FLERR,"Invalid math function in variable formula");
     if (update->whichflag == 0)
       error->all(FLERR,"Cannot use swiggle in variable formula between runs");
-    if (tree) newtree->type = CWIGGLE;
+    if (tree) newtree->type = SWIGGLE;
     else {
       if (value3 == 0.0)
         error->all(FLERR,"Invalid math function in variable formula");
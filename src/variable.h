@@ -58,8 +58,9 @@ class Variable : protected Pointers {
   int precedence[17];      // precedence level of math operators
                            // set length to include up to OR in enum
   int me;
+  int compiling;           // 1 if evaluate() builds a tree for compile()
 
-  struct Tree {            // parse tree for atom-style variables
+  struct Tree {            // parse tree for atom-style or compiled variables
     double value;          // single scalar
     double *array;         // per-atom or per-type list of doubles
     int *iarray;           // per-atom list of ints
@@ -67,16 +68,25 @@ class Variable : protected Pointers {
     int nstride;           // stride between atoms if array is a 2d array
     int selfalloc;         // 1 if array is allocated here, else 0
     int ivalue1,ivalue2;   // extra values for needed for gmask,rmask,grmask
+    char *keyword;         // thermo keyword evaluated by compiled tree
     Tree *left,*middle,*right;    // ptrs further down tree
   };
 
+  Tree **compiled;         // parse tree of equal-style variable, built once
+  int *compileflag;        // 0 = not yet compiled, 1 = compiled, -1 = cannot
+
   void remove(int);
   void grow();
   void copy(int, char **, char **);
   double evaluate(char *, Tree **);
   double collapse_tree(Tree *);
   double eval_tree(Tree *, int);
+  void eval_tree(Tree *, int, int *, double *);
+  int random_in_tree(Tree *);
   void free_tree(Tree *);
+  void compile(int);
+  int compilable(char *);
+  void uncompile();
   int find_matching_paren(char *, int, char *&);
   int math_function(char *, char *, Tree **, Tree **, int &, double *, int &);
   int group_function(char *, char *, Tree **, Tree **, int &, double *, int &);
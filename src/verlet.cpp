@@ -42,13 +42,15 @@
 #include "timer.h"
 #include "memory.h"
 #include "error.h"
+#include <stdio.h>
 
 using namespace LAMMPS_NS;
+using namespace FixConst;
 
 /* ---------------------------------------------------------------------- */
 
 Verlet::Verlet(LAMMPS *lmp, int narg, char **arg) :
-  Integrate(lmp, narg, arg) {}
+  Integrate(lmp, narg, arg), overlap(0) {}
 
 /* ----------------------------------------------------------------------
    initialization before run
@@ -123,6 +125,7 @@ void Verlet::setup()
   modify->setup_pre_neighbor(); //NP modified C.K.
   neighbor->build();
   neighbor->ncalls = 0;
+  neighbor->npaircheck = neighbor->npairaccept = 0;
 
   // compute all forces
 
@@ -151,6 +154,27 @@ void Verlet::setup()
   modify->setup(vflag);
   output->setup();
   update->setupflag = 0;
+
+  // overlap of forward comm and pair forces of interior atoms
+  // pre_force() moves behind the interior pass, so all fixes using it
+  //   must allow for that
+
+  overlap = 0;
+  if (comm->overlap_flag) {
+    char str[128];
+    str[0] = '\0';
+    if (!pair_compute_flag || !force->pair->comm_overlap)
+      sprintf(str,"Communicate overlap not supported by pair style, ignored");
+    else
+      for (int i = 0; i < modify->nfix; i++)
+        if ((modify->fmask[i] & PRE_FORCE) && !modify->fix[i]->comm_overlap) {
+          sprintf(str,"Communicate overlap not supported by fix %s, ignored",
+                  modify->fix[i]->style);
+          break;
+        }
+    if (str[0] == '\0') overlap = 1;
+    else if (comm->me == 0) error->warning(FLERR,str);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -182,6 +206,7 @@ void Verlet::setup_minimal(int flag)
     modify->setup_pre_neighbor();
     neighbor->build();
     neighbor->ncalls = 0;
+    neighbor->npaircheck = neighbor->npairaccept = 0;
   }
 
   // compute all forces
@@ -247,7 +272,8 @@ void Verlet::run(int n)
 
     if (nflag == 0) {
       timer->stamp();
-      comm->forward_comm();
+      if (overlap) comm->forward_comm_start();
+      else comm->forward_comm();
       timer->stamp(TIME_COMM);
     } else {
       if (n_pre_exchange) modify->pre_exchange();
@@ -284,13 +310,31 @@ void Verlet::run(int n)
     // and Pair:ev_tally() needs to be called before any tallying
 
     force_clear();
-    if (n_pre_force) modify->pre_force(vflag);
 
-    timer->stamp();
+    // with overlap, atoms w/o ghost neighbors are computed while
+    // ghost coords are in transit, rest of the step sees complete ghosts
+
+    if (overlap && nflag == 0) {
+      timer->stamp();
+      force->pair->compute_interior(eflag,vflag);
+      timer->stamp(TIME_PAIR);
+      comm->forward_comm_finish();
+      timer->stamp(TIME_COMM);
+
+      if (n_pre_force) modify->pre_force(vflag);
 
-    if (pair_compute_flag) {
-      force->pair->compute(eflag,vflag);
+      timer->stamp();
+      force->pair->compute_border(eflag,vflag);
       timer->stamp(TIME_PAIR);
+    } else {
+      if (n_pre_force) modify->pre_force(vflag);
+
+      timer->stamp();
+
+      if (pair_compute_flag) {
+        force->pair->compute(eflag,vflag);
+        timer->stamp(TIME_PAIR);
+      }
     }
 
     if (atom->molecular) {
@@ -38,6 +38,7 @@ class Verlet : public Integrate {
   int triclinic;                    // 0 if domain is orthog, 1 if triclinic
   int torqueflag,erforceflag;
   int e_flag,rho_flag;
+  int overlap;                      // 1 if forward comm overlaps pair forces
 
   void force_clear();
 };
@@ -54,4 +55,15 @@ W: No fixes defined, atoms won't move
 If you are not using a fix like nve, nvt, npt then atom velocities and
 coordinates will not be updated during timestepping.
 
+W: Communicate overlap not supported by pair style, ignored
+
+Only granular pair styles can split their force computation into atoms
+with and without ghost neighbors.
+
+W: Communicate overlap not supported by fix %s, ignored
+
+The fix does work in pre_force() that has to see up-to-date ghost atoms
+or that the pair style depends on, so forward communication cannot
+overlap with the pair style.
+
 */
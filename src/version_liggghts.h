@@ -0,0 +1 @@
+#define LIGGGHTS_VERSION "LIGGGHTS-PFM 20.09, compiled 2026-10-17-06:00:58 by root, git commit 207ff4b0677ce33e6f44fd6a4a75bd1af2df7980,"
@@ -0,0 +1,390 @@
+/* ----------------------------------------------------------------------
+   LIGGGHTS - LAMMPS Improved for General Granular and Granular Heat
+   Transfer Simulations
+
+   LIGGGHTS is part of the CFDEMproject
+   www.liggghts.com | www.cfdem.com
+
+   Christoph Kloss, christoph.kloss@cfdem.com
+   Copyright 2009-2012 JKU Linz
+   Copyright 2012-     DCS Computing GmbH, Linz
+
+   LIGGGHTS is based on LAMMPS
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   This software is distributed under the GNU General Public License.
+
+   See the README file in the top-level directory.
+------------------------------------------------------------------------- */
+
+#include <string.h>
+#include "vtk_xml_writer.h"
+
+using namespace LAMMPS_NS;
+
+#define CHUNK 4096               // values converted per fwrite
+
+/* ----------------------------------------------------------------------
+   PolyData piece of points, each point is also a vertex cell so that
+     readers render it without a glyph filter
+------------------------------------------------------------------------- */
+
+bool VTKXMLWriter::write_points(const char *file, int npoints,
+                                const double *x, int stride, int offset,
+                                const std::vector<Array> &pointdata)
+{
+  FILE *fp = fopen(file,"wb");
+  if (!fp) return false;
+
+  std::vector<Block> blocks;
+  bigint pos = 0;
+
+  fprintf(fp,"<?xml version=\"1.0\"?>\n"
+          "<VTKFile type=\"PolyData\" version=\"1.0\" byte_order=\"%s\" "
+          "header_type=\"UInt64\">\n"
+          "  <PolyData>\n"
+          "    <Piece NumberOfPoints=\"%d\" NumberOfVerts=\"%d\" "
+          "NumberOfLines=\"0\" NumberOfStrips=\"0\" NumberOfPolys=\"0\">\n",
+          byte_order(),npoints,npoints);
+
+  fprintf(fp,"      <PointData>\n");
+  for (size_t i = 0; i < pointdata.size(); i++) {
+    blocks.push_back(data_block(pointdata[i],npoints));
+    write_array_header(fp,pointdata[i].name.c_str(),pointdata[i].ncomp,
+                       pointdata[i].type,pos,blocks.back(),8);
+  }
+  fprintf(fp,"      </PointData>\n");
+
+  fprintf(fp,"      <Points>\n");
+  blocks.push_back(data_block(Array("Points",3,FLOAT64,x,stride,offset),npoints));
+  write_array_header(fp,NULL,3,FLOAT64,pos,blocks.back(),8);
+  fprintf(fp,"      </Points>\n");
+
+  fprintf(fp,"      <Verts>\n");
+  blocks.push_back(sequence_block(INT32,npoints,0,1));
+  write_array_header(fp,"connectivity",1,INT32,pos,blocks.back(),8);
+  blocks.push_back(sequence_block(INT32,npoints,1,1));
+  write_array_header(fp,"offsets",1,INT32,pos,blocks.back(),8);
+  fprintf(fp,"      </Verts>\n");
+
+  fprintf(fp,"    </Piece>\n"
+          "  </PolyData>\n");
+
+  bool ok = write_blocks(fp,blocks);
+  fprintf(fp,"</VTKFile>\n");
+  if (fclose(fp)) ok = false;
+  return ok;
+}
+
+/* ----------------------------------------------------------------------
+   UnstructuredGrid piece of triangles
+------------------------------------------------------------------------- */
+
+bool VTKXMLWriter::write_triangles(const char *file, int ntri,
+                                   const double *nodes, int stride,
+                                   const std::vector<Array> &celldata)
+{
+  FILE *fp = fopen(file,"wb");
+  if (!fp) return false;
+
+  std::vector<Block> blocks;
+  bigint pos = 0;
+
+  fprintf(fp,"<?xml version=\"1.0\"?>\n"
+          "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"%s\" "
+          "header_type=\"UInt64\">\n"
+          "  <UnstructuredGrid>\n"
+          "    <Piece NumberOfPoints=\"%d\" NumberOfCells=\"%d\">\n",
+          byte_order(),3*ntri,ntri);
+
+  fprintf(fp,"      <CellData>\n");
+  for (size_t i = 0; i < celldata.size(); i++) {
+    blocks.push_back(data_block(celldata[i],ntri));
+    write_array_header(fp,celldata[i].name.c_str(),celldata[i].ncomp,
+                       celldata[i].type,pos,blocks.back(),8);
+  }
+  fprintf(fp,"      </CellData>\n");
+
+  // 3 points of 3 coords per triangle are read as one tuple of 9
+
+  fprintf(fp,"      <Points>\n");
+  blocks.push_back(data_block(Array("Points",9,FLOAT64,nodes,stride,0),ntri));
+  write_array_header(fp,NULL,3,FLOAT64,pos,blocks.back(),8);
+  fprintf(fp,"      </Points>\n");
+
+  // VTK_TRIANGLE = 5
+
+  fprintf(fp,"      <Cells>\n");
+  blocks.push_back(sequence_block(INT32,3*ntri,0,1));
+  write_array_header(fp,"connectivity",1,INT32,pos,blocks.back(),8);
+  blocks.push_back(sequence_block(INT32,ntri,3,3));
+  write_array_header(fp,"offsets",1,INT32,pos,blocks.back(),8);
+  blocks.push_back(constant_block(UINT8,ntri,5));
+  write_array_header(fp,"types",1,UINT8,pos,blocks.back(),8);
+  fprintf(fp,"      </Cells>\n");
+
+  fprintf(fp,"    </Piece>\n"
+          "  </UnstructuredGrid>\n");
+
+  bool ok = write_blocks(fp,blocks);
+  fprintf(fp,"</VTKFile>\n");
+  if (fclose(fp)) ok = false;
+  return ok;
+}
+
+/* ---------------------------------------------------------------------- */
+
+bool VTKXMLWriter::write_points_index(const char *file, const char *piecebase,
+                                      int npieces, const std::vector<Array> &pointdata)
+{
+  return write_index(file,piecebase,"PPolyData","PPointData",".vtp",
+                     npieces,pointdata,true);
+}
+
+/* ---------------------------------------------------------------------- */
+
+bool VTKXMLWriter::write_triangles_index(const char *file, const char *piecebase,
+                                         int npieces, const std::vector<Array> &celldata)
+{
+  return write_index(file,piecebase,"PUnstructuredGrid","PCellData",".vtu",
+                     npieces,celldata,false);
+}
+
+/* ----------------------------------------------------------------------
+   piece file of proc ipiece, e.g. dump_1000_3.vtp for base dump_1000
+------------------------------------------------------------------------- */
+
+std::string VTKXMLWriter::piece_name(const char *piecebase, int ipiece,
+                                     const char *suffix)
+{
+  char num[16];
+  sprintf(num,"_%d",ipiece);
+  return std::string(piecebase) + num + suffix;
+}
+
+/* ---------------------------------------------------------------------- */
+
+std::string VTKXMLWriter::file_base(const char *filename, bigint ntimestep,
+                                    int padflag, const char *suffix)
+{
+  std::string name(filename);
+  const size_t star = name.find('*');
+  if (star != std::string::npos) {
+    char step[32];
+    if (padflag == 0) sprintf(step,BIGINT_FORMAT,ntimestep);
+    else {
+      char bif[8],pad[16];
+      strcpy(bif,BIGINT_FORMAT);
+      sprintf(pad,"%%0%d%s",padflag,&bif[1]);
+      sprintf(step,pad,ntimestep);
+    }
+    name.replace(star,1,step);
+  }
+
+  const size_t n = strlen(suffix);
+  if (name.size() >= n && name.compare(name.size()-n,n,suffix) == 0)
+    name.erase(name.size()-n);
+  return name;
+}
+
+/* ----------------------------------------------------------------------
+   index lists pieces without their directory, they are next to the index
+------------------------------------------------------------------------- */
+
+bool VTKXMLWriter::write_index(const char *file, const char *piecebase,
+                               const char *grid, const char *data,
+                               const char *suffix, int npieces,
+                               const std::vector<Array> &arrays, bool polydata)
+{
+  FILE *fp = fopen(file,"w");
+  if (!fp) return false;
+
+  const char *base = strrchr(piecebase,'/');
+  base = base ? base+1 : piecebase;
+
+  fprintf(fp,"<?xml version=\"1.0\"?>\n"
+          "<VTKFile type=\"%s\" version=\"1.0\" byte_order=\"%s\" "
+          "header_type=\"UInt64\">\n"
+          "  <%s GhostLevel=\"0\">\n",grid,byte_order(),grid);
+
+  fprintf(fp,"    <%s>\n",data);
+  for (size_t i = 0; i < arrays.size(); i++)
+    fprintf(fp,"      <PDataArray type=\"%s\" Name=\"%s\" "
+            "NumberOfComponents=\"%d\"/>\n",type_name(arrays[i].type),
+            arrays[i].name.c_str(),arrays[i].ncomp);
+  fprintf(fp,"    </%s>\n",data);
+
+  fprintf(fp,"    <PPoints>\n"
+          "      <PDataArray type=\"Float64\" NumberOfComponents=\"3\"/>\n"
+          "    </PPoints>\n");
+  if (!polydata)
+    fprintf(fp,"    <PCells>\n"
+            "      <PDataArray type=\"Int32\" Name=\"connectivity\"/>\n"
+            "      <PDataArray type=\"Int32\" Name=\"offsets\"/>\n"
+            "      <PDataArray type=\"UInt8\" Name=\"types\"/>\n"
+            "    </PCells>\n");
+
+  for (int i = 0; i < npieces; i++)
+    fprintf(fp,"    <Piece Source=\"%s\"/>\n",
+            piece_name(base,i,suffix).c_str());
+
+  fprintf(fp,"  </%s>\n"
+          "</VTKFile>\n",grid);
+
+  return fclose(fp) == 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+const char *VTKXMLWriter::type_name(DataType type)
+{
+  if (type == INT32) return "Int32";
+  if (type == UINT8) return "UInt8";
+  return "Float64";
+}
+
+/* ---------------------------------------------------------------------- */
+
+int VTKXMLWriter::type_size(DataType type)
+{
+  if (type == INT32) return 4;
+  if (type == UINT8) return 1;
+  return 8;
+}
+
+/* ---------------------------------------------------------------------- */
+
+const char *VTKXMLWriter::byte_order()
+{
+  const int one = 1;
+  return (*reinterpret_cast<const char*>(&one) == 1) ? "LittleEndian" : "BigEndian";
+}
+
+/* ---------------------------------------------------------------------- */
+
+bigint VTKXMLWriter::Block::nbytes() const
+{
+  return ntuple*ncomp*type_size(type);
+}
+
+/* ---------------------------------------------------------------------- */
+
+VTKXMLWriter::Block VTKXMLWriter::data_block(const Array &array, bigint ntuple)
+{
+  Block b;
+  b.kind = Block::DATA;
+  b.type = array.type;
+  b.ncomp = array.ncomp;
+  b.ntuple = ntuple;
+  b.data = array.data;
+  b.stride = array.stride;
+  b.offset = array.offset;
+  b.first = b.step = 0;
+  return b;
+}
+
+/* ---------------------------------------------------------------------- */
+
+VTKXMLWriter::Block VTKXMLWriter::sequence_block(DataType type, bigint n,
+                                                 int first, int step)
+{
+  Block b;
+  b.kind = Block::SEQUENCE;
+  b.type = type;
+  b.ncomp = 1;
+  b.ntuple = n;
+  b.data = NULL;
+  b.stride = b.offset = 0;
+  b.first = first;
+  b.step = step;
+  return b;
+}
+
+/* ---------------------------------------------------------------------- */
+
+VTKXMLWriter::Block VTKXMLWriter::constant_block(DataType type, bigint n,
+                                                 int value)
+{
+  Block b = sequence_block(type,n,value,0);
+  b.kind = Block::CONSTANT;
+  return b;
+}
+
+/* ----------------------------------------------------------------------
+   DataArray tag of a block, pos = offset of the block in the appended
+     data, advanced past the block and its 8 byte size header
+------------------------------------------------------------------------- */
+
+void VTKXMLWriter::write_array_header(FILE *fp, const char *name, int ncomp,
+                                      DataType type, bigint &pos,
+                                      const Block &block, int indent)
+{
+  fprintf(fp,"%*s<DataArray type=\"%s\"",indent,"",type_name(type));
+  if (name) fprintf(fp," Name=\"%s\"",name);
+  fprintf(fp," NumberOfComponents=\"%d\" format=\"appended\" "
+          "offset=\"" BIGINT_FORMAT "\"/>\n",ncomp,pos);
+  pos += sizeof(uint64_t) + block.nbytes();
+}
+
+/* ---------------------------------------------------------------------- */
+
+bool VTKXMLWriter::write_blocks(FILE *fp, const std::vector<Block> &blocks)
+{
+  fprintf(fp,"  <AppendedData encoding=\"raw\">\n   _");
+  bool ok = true;
+  for (size_t i = 0; i < blocks.size() && ok; i++)
+    ok = write_block(fp,blocks[i]);
+  fprintf(fp,"\n  </AppendedData>\n");
+  return ok;
+}
+
+/* ----------------------------------------------------------------------
+   size header, then values converted to the block type in chunks
+------------------------------------------------------------------------- */
+
+bool VTKXMLWriter::write_block(FILE *fp, const Block &b)
+{
+  const uint64_t nbytes = b.nbytes();
+  if (fwrite(&nbytes,sizeof(uint64_t),1,fp) != 1) return false;
+
+  const int size = type_size(b.type);
+  const bigint nvalues = b.ntuple*b.ncomp;
+
+  // contiguous doubles can be written directly
+
+  if (b.kind == Block::DATA && b.type == FLOAT64 && b.stride == b.ncomp) {
+    if (nvalues == 0) return true;
+    return fwrite(b.data + b.offset,sizeof(double),nvalues,fp) ==
+      static_cast<size_t>(nvalues);
+  }
+
+  char chunk[CHUNK*8];
+  bigint n = 0;
+  while (n < nvalues) {
+    const int m = (nvalues-n < CHUNK) ? static_cast<int>(nvalues-n) : CHUNK;
+    for (int k = 0; k < m; k++) {
+      const bigint iv = n + k;
+      double value;
+      if (b.kind == Block::DATA)
+        value = b.data[(iv/b.ncomp)*b.stride + b.offset + iv%b.ncomp];
+      else if (b.kind == Block::SEQUENCE)
+        value = b.first + static_cast<double>(iv)*b.step;
+      else
+        value = b.first;
+
+      if (b.type == FLOAT64) {
+        memcpy(&chunk[8*k],&value,8);
+      } else if (b.type == INT32) {
+        const int32_t ivalue = static_cast<int32_t>(value);
+        memcpy(&chunk[4*k],&ivalue,4);
+      } else {
+        chunk[k] = static_cast<char>(static_cast<unsigned char>(value));
+      }
+    }
+    if (fwrite(chunk,size,m,fp) != static_cast<size_t>(m)) return false;
+    n += m;
+  }
+  return true;
+}
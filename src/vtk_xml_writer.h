@@ -0,0 +1,119 @@
+/* ----------------------------------------------------------------------
+   LIGGGHTS - LAMMPS Improved for General Granular and Granular Heat
+   Transfer Simulations
+
+   LIGGGHTS is part of the CFDEMproject
+   www.liggghts.com | www.cfdem.com
+
+   Christoph Kloss, christoph.kloss@cfdem.com
+   Copyright 2009-2012 JKU Linz
+   Copyright 2012-     DCS Computing GmbH, Linz
+
+   LIGGGHTS is based on LAMMPS
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   This software is distributed under the GNU General Public License.
+
+   See the README file in the top-level directory.
+------------------------------------------------------------------------- */
+
+#ifndef LMP_VTK_XML_WRITER_H
+#define LMP_VTK_XML_WRITER_H
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include "lmptype.h"
+
+namespace LAMMPS_NS {
+
+/* ----------------------------------------------------------------------
+   writer for VTK XML files with raw appended binary data, no VTK library
+   each proc writes its own piece (.vtp or .vtu), proc 0 additionally
+     writes the parallel index (.pvtp or .pvtu) that lists all pieces
+   data is read from strided double buffers, as packed by dumps
+------------------------------------------------------------------------- */
+
+class VTKXMLWriter {
+ public:
+  enum DataType {FLOAT64, INT32, UINT8};
+
+  // component c of tuple i is data[i*stride + offset + c]
+
+  struct Array {
+    std::string name;
+    int ncomp;
+    DataType type;
+    const double *data;
+    int stride,offset;
+
+    Array(const char *_name, int _ncomp, DataType _type,
+          const double *_data, int _stride, int _offset) :
+      name(_name), ncomp(_ncomp), type(_type),
+      data(_data), stride(_stride), offset(_offset) {}
+  };
+
+  // points with one vertex cell each, as PolyData
+
+  static bool write_points(const char *file, int npoints,
+                           const double *x, int stride, int offset,
+                           const std::vector<Array> &pointdata);
+
+  // triangles with 3 own nodes each, as UnstructuredGrid
+  // nodes of triangle i are the 9 values from nodes[i*stride]
+
+  static bool write_triangles(const char *file, int ntri,
+                              const double *nodes, int stride,
+                              const std::vector<Array> &celldata);
+
+  // parallel index of npieces piece files
+  // pieces are named by piece_name(), relative to the index file
+
+  static bool write_points_index(const char *file, const char *piecebase,
+                                 int npieces, const std::vector<Array> &pointdata);
+  static bool write_triangles_index(const char *file, const char *piecebase,
+                                    int npieces, const std::vector<Array> &celldata);
+
+  static std::string piece_name(const char *piecebase, int ipiece,
+                                const char *suffix);
+
+  // dump filename with '*' replaced by timestep and suffix removed
+
+  static std::string file_base(const char *filename, bigint ntimestep,
+                               int padflag, const char *suffix);
+
+ private:
+  struct Block {
+    enum Kind {DATA, SEQUENCE, CONSTANT} kind;
+    DataType type;
+    int ncomp;
+    bigint ntuple;
+    const double *data;
+    int stride,offset;
+    int first,step;              // SEQUENCE: first + i*step, CONSTANT: first
+
+    bigint nbytes() const;
+  };
+
+  static const char *type_name(DataType);
+  static int type_size(DataType);
+  static const char *byte_order();
+
+  static Block data_block(const Array &, bigint);
+  static Block sequence_block(DataType, bigint, int, int);
+  static Block constant_block(DataType, bigint, int);
+
+  static void write_array_header(FILE *, const char *, int, DataType,
+                                 bigint &, const Block &, int);
+  static bool write_blocks(FILE *, const std::vector<Block> &);
+  static bool write_block(FILE *, const Block &);
+  static bool write_index(const char *, const char *, const char *,
+                          const char *, const char *, int,
+                          const std::vector<Array> &, bool);
+};
+
+}
+
+#endif
@@ -147,6 +147,8 @@ void WriteRestart::command(int narg, char **arg)
 
 void WriteRestart::write(char *file)
 {
+  double time_start = MPI_Wtime();
+
   // special case where reneighboring is not done in integrator
   //   on timestep restart file is written (due to build_once being set)
   // if box is changing, must be reset, else restart file will have
@@ -182,6 +184,16 @@ void WriteRestart::write(char *file)
   if (strchr(file,'%')) multiproc = 1;
   else multiproc = 0;
 
+  // check if filename ends in ".mpiio"
+  // if so, all procs write their chunk collectively via MPI-IO
+
+  int mpiioflag = 0;
+  int nfile = strlen(file);
+  if (nfile > 6 && strcmp(&file[nfile-6],".mpiio") == 0) mpiioflag = 1;
+  if (multiproc && mpiioflag)
+    error->all(FLERR,
+               "Restart file MPI-IO output not allowed with % in filename");
+
   // open single restart file or base file for multiproc case
 
   if (me == 0) {
@@ -296,6 +308,10 @@ void WriteRestart::write(char *file)
     }
   }
 
+  double time_pack = MPI_Wtime();
+
+  // if MPI-IO file:
+  //   all procs write their chunk at precomputed offsets, see write_mpiio()
   // if single file:
   //   write one chunk of atoms per proc to file
   //   proc 0 pings each proc, receives its chunk, writes to file
@@ -303,7 +319,10 @@ void WriteRestart::write(char *file)
   // else if one file per proc:
   //   each proc opens its own file and writes its chunk directly
 
-  if (multiproc == 0) {
+  if (mpiioflag) {
+    write_mpiio(file,buf,send_size);
+
+  } else if (multiproc == 0) {
     int tmp,recv_size;
     MPI_Status status;
     MPI_Request request;
@@ -349,6 +368,22 @@ void WriteRestart::write(char *file)
 
   memory->destroy(buf);
 
+  // restart time breakdown, pack = header + fix data + atom data
+
+  double time_end = MPI_Wtime();
+  double time_io = time_end - time_pack;
+  double time_io_max;
+  MPI_Allreduce(&time_io,&time_io_max,1,MPI_DOUBLE,MPI_MAX,world);
+
+  bigint nbytes = static_cast<bigint> (send_size) * sizeof(double);
+  bigint nbytes_all;
+  MPI_Allreduce(&nbytes,&nbytes_all,1,MPI_LMP_BIGINT,MPI_SUM,world);
+
+  if (me == 0 && logfile)
+    fprintf(logfile,"Restart time = %g secs (pack %g, write %g) "
+            "for %g Mbytes of atom data\n",time_end-time_start,
+            time_pack-time_start,time_io_max,nbytes_all/1024.0/1024.0);
+
   // invoke any fixes that write their own restart file
 
   for (int ifix = 0; ifix < modify->nfix; ifix++)
@@ -356,6 +391,63 @@ void WriteRestart::write(char *file)
       modify->fix[ifix]->write_restart_file(file);
 }
 
+/* ----------------------------------------------------------------------
+   write chunks of all procs collectively via MPI-IO
+   proc 0 first appends an index to the header: # of chunks and size of
+     each chunk, so the file can be read by any # of procs in parallel
+   chunks follow the index in the order of the procs, without size prefix
+------------------------------------------------------------------------- */
+
+void WriteRestart::write_mpiio(char *file, double *buf, int send_size)
+{
+  int *sizes = NULL;
+  if (me == 0) memory->create(sizes,nprocs,"write_restart:sizes");
+  MPI_Gather(&send_size,1,MPI_INT,sizes,1,MPI_INT,0,world);
+
+  bigint headeroffset;
+  if (me == 0) {
+    fwrite(&nprocs,sizeof(int),1,fp);
+    fwrite(sizes,sizeof(int),nprocs,fp);
+    headeroffset = ftell(fp);
+    fclose(fp);
+    memory->destroy(sizes);
+  }
+
+  // header must be complete before any proc opens the file
+
+  MPI_Bcast(&headeroffset,1,MPI_LMP_BIGINT,0,world);
+
+  bigint nbytes = static_cast<bigint> (send_size) * sizeof(double);
+  bigint offset;
+  MPI_Scan(&nbytes,&offset,1,MPI_LMP_BIGINT,MPI_SUM,world);
+  offset += headeroffset - nbytes;
+
+  MPI_File fh;
+  MPI_Status status;
+  int err = MPI_File_open(world,file,MPI_MODE_WRONLY,MPI_INFO_NULL,&fh);
+  mpiio_check(err,file);
+
+  err = MPI_File_write_at_all(fh,offset,buf,send_size,MPI_DOUBLE,&status);
+  MPI_File_close(&fh);
+  mpiio_check(err,file);
+}
+
+/* ----------------------------------------------------------------------
+   error if an MPI-IO call failed on any proc
+------------------------------------------------------------------------- */
+
+void WriteRestart::mpiio_check(int err, char *file)
+{
+  int flag = (err == MPI_SUCCESS) ? 0 : 1;
+  int flag_all;
+  MPI_Allreduce(&flag,&flag_all,1,MPI_INT,MPI_MAX,world);
+  if (flag_all) {
+    char str[128];
+    sprintf(str,"Cannot write restart file %s via MPI-IO",file);
+    error->all(FLERR,str);
+  }
+}
+
 /* ----------------------------------------------------------------------
    proc 0 writes out problem description
 ------------------------------------------------------------------------- */
@@ -52,6 +52,8 @@ class WriteRestart : protected Pointers {
   void header();
   void type_arrays();
   void force_fields();
+  void write_mpiio(char *, double *, int);
+  void mpiio_check(int, char *);
 
   void write_int(int, int);
   void write_double(int, double);
@@ -86,4 +88,12 @@ E: Cannot open restart file %s
 
 Self-explanatory.
 
+E: Restart file MPI-IO output not allowed with % in filename
+
+A file ending in .mpiio is always written as a single file.
+
+E: Cannot write restart file %s via MPI-IO
+
+The collective write of the per-processor chunks failed.
+
 */